@@ -17,6 +17,15 @@ static U32 min(const U32 a, const U32 b) {
   return (a < b) ? a : b;
 }
 
+//! Number of words added per block by addWordsAligned
+static const U32 WORDS_PER_BLOCK = 4;
+
+//! Value of a four-byte big-endian word
+static inline U32 wordValue(const U8 *const word) {
+  return (static_cast<U32>(word[0]) << 24) | (static_cast<U32>(word[1]) << 16) |
+    (static_cast<U32>(word[2]) << 8) | static_cast<U32>(word[3]);
+}
+
 namespace CFDP {
 
   Checksum ::
@@ -90,8 +99,7 @@ namespace CFDP {
     }
 
     // Add the middle words aligned
-    for ( ; index + 4 <= length; index += 4)
-      addWordAligned(&data[index]);
+    index += this->addWordsAligned(&data[index], length - index);
 
     // Add the last word unaligned if necessary
     if (index < length) {
@@ -105,11 +113,39 @@ namespace CFDP {
 
   }
 
+  U32 Checksum ::
+    addWordsAligned(
+        const U8 *const words,
+        const U32 length
+    )
+  {
+    // Add the words of whole blocks into one accumulator per word of the
+    // block. There is no dependency between accumulators, so the additions
+    // can proceed in parallel and compilers can vectorize the loop. Addition
+    // modulo 2^32 is associative, so the result is the same as adding each
+    // word in turn.
+    U32 sums[WORDS_PER_BLOCK] = { 0 };
+    U32 index = 0;
+    for ( ; index + 4 * WORDS_PER_BLOCK <= length; index += 4 * WORDS_PER_BLOCK) {
+      for (U32 word = 0; word < WORDS_PER_BLOCK; ++word) {
+        sums[word] += wordValue(&words[index + 4 * word]);
+      }
+    }
+    for (U32 word = 0; word < WORDS_PER_BLOCK; ++word) {
+      this->m_value += sums[word];
+    }
+
+    // Add the remaining whole words one at a time
+    for ( ; index + 4 <= length; index += 4) {
+      this->addWordAligned(&words[index]);
+    }
+    return index;
+  }
+
   void Checksum ::
     addWordAligned(const U8 *const word)
   {
-    for (U8 i = 0; i < 4; ++i)
-      addByteAtOffset(word[i], i);
+    this->m_value += wordValue(word);
   }
 
   void Checksum ::
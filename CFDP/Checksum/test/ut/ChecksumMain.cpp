@@ -49,6 +49,35 @@ TEST(Checksum, ThreePackets) {
   ASSERT_EQ(expectedValue, checksum.getValue());
 }
 
+// Reference checksum adding one byte at a time at its position in the word
+static U32 referenceValue(const U8 *const bytes, const U32 offset, const U32 length) {
+  U32 value = 0;
+  for (U32 i = 0; i < length; ++i) {
+    value += static_cast<U32>(bytes[i]) << (8 * (3 - (offset + i) % 4));
+  }
+  return value;
+}
+
+TEST(Checksum, PacketSizes) {
+  U8 file[4096];
+  for (U32 i = 0; i < sizeof(file); ++i) {
+    file[i] = static_cast<U8>(i * 131 + 7);
+  }
+  // Split the file into packets of realistic sizes, starting at each alignment
+  const U32 packetSizes[] = { 1, 3, 15, 17, 64, 123, 500, 1019, 1024 };
+  for (U32 size : packetSizes) {
+    for (U32 start = 0; start < 4; ++start) {
+      Checksum checksum;
+      for (U32 offset = start; offset < sizeof(file); offset += size) {
+        const U32 length = FW_MIN(size, static_cast<U32>(sizeof(file)) - offset);
+        checksum.update(&file[offset], offset, length);
+      }
+      ASSERT_EQ(referenceValue(&file[start], start, sizeof(file) - start), checksum.getValue())
+        << "packet size " << size << " start " << start;
+    }
+  }
+}
+
 int main(int argc, char **argv) {
   ::testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
@@ -0,0 +1,216 @@
+// ======================================================================
+// \title  LinuxShmDriver.cpp
+// \brief  cpp file for LinuxShmDriver component implementation class
+//
+// \copyright
+// Copyright 2009-2024, by the California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#include <Drv/LinuxShmDriver/LinuxShmDriver.hpp>
+#include <Fw/Types/Assert.hpp>
+#include <Os/TaskString.hpp>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <cerrno>
+
+namespace Drv {
+
+namespace {
+//! Start of the shared memory, followed by the rings of side A and side B
+struct ShmHeader {
+    alignas(64) std::atomic<U32> capacity;  //!< Capacity of the rings, set by the first driver to open
+};
+}  // namespace
+
+// ----------------------------------------------------------------------
+// Construction, initialization, and destruction
+// ----------------------------------------------------------------------
+
+LinuxShmDriver ::LinuxShmDriver(const char* const compName)
+    : LinuxShmDriverComponentBase(compName),
+      m_region(nullptr),
+      m_regionSize(0),
+      m_allocationSize(0),
+      m_quitReadThread(false) {}
+
+void LinuxShmDriver ::init(const NATIVE_INT_TYPE instance) {
+    LinuxShmDriverComponentBase::init(instance);
+}
+
+LinuxShmDriver ::~LinuxShmDriver() {
+    this->close();
+}
+
+bool LinuxShmDriver ::open(const char* const name, const Side side, const U32 capacity, const U32 allocationSize) {
+    FW_ASSERT(name != nullptr);
+    FW_ASSERT(this->m_region == nullptr);
+    FW_ASSERT((capacity >= 64) && ((capacity & (capacity - 1)) == 0), capacity);
+    this->m_name = name;
+    this->m_allocationSize = allocationSize;
+    Fw::LogStringArg logName(name);
+
+    const U32 ringSize = ShmRing::regionSize(capacity);
+    const U32 regionSize = sizeof(ShmHeader) + 2 * ringSize;
+    int fd = ::shm_open(name, O_RDWR | O_CREAT, S_IRUSR | S_IWUSR);
+    if (fd == -1) {
+        this->log_WARNING_HI_OpenError(logName, errno);
+        return false;
+    }
+    // Both drivers size the object alike, and new memory reads as zeros, which are empty rings
+    struct stat info;
+    if ((::fstat(fd, &info) == -1) ||
+        ((info.st_size < static_cast<off_t>(regionSize)) && (::ftruncate(fd, regionSize) == -1))) {
+        this->log_WARNING_HI_OpenError(logName, errno);
+        (void)::close(fd);
+        return false;
+    }
+    void* region = ::mmap(nullptr, regionSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    (void)::close(fd);
+    if (region == MAP_FAILED) {
+        this->log_WARNING_HI_OpenError(logName, errno);
+        return false;
+    }
+
+    // The drivers must agree on the layout
+    ShmHeader* header = static_cast<ShmHeader*>(region);
+    U32 existing = 0;
+    if (!header->capacity.compare_exchange_strong(existing, capacity) && (existing != capacity)) {
+        (void)::munmap(region, regionSize);
+        this->log_WARNING_HI_OpenError(logName, EINVAL);
+        return false;
+    }
+
+    U8* rings = static_cast<U8*>(region) + sizeof(ShmHeader);
+    this->m_sendRing.setup(rings + ((side == SIDE_A) ? 0 : ringSize), capacity);
+    this->m_recvRing.setup(rings + ((side == SIDE_A) ? ringSize : 0), capacity);
+    this->m_region = region;
+    this->m_regionSize = regionSize;
+    this->log_ACTIVITY_HI_Opened(logName, capacity);
+
+    if (this->isConnected_ready_OutputPort(0)) {
+        this->ready_out(0);
+    }
+    return true;
+}
+
+void LinuxShmDriver ::close() {
+    if (this->m_region != nullptr) {
+        this->m_sendRing.cleanup();
+        this->m_recvRing.cleanup();
+        int stat = ::munmap(this->m_region, this->m_regionSize);
+        FW_ASSERT(stat == 0, errno);
+        this->m_region = nullptr;
+        this->m_regionSize = 0;
+    }
+}
+
+bool LinuxShmDriver ::unlink(const char* const name) {
+    FW_ASSERT(name != nullptr);
+    return ::shm_unlink(name) == 0;
+}
+
+// ----------------------------------------------------------------------
+// Handler implementations for user-defined typed input ports
+// ----------------------------------------------------------------------
+
+ShmRing::Status LinuxShmDriver ::write(const Fw::Buffer& fwBuffer) {
+    if ((this->m_region == nullptr) || (fwBuffer.getData() == nullptr)) {
+        return ShmRing::RING_TOO_LARGE;
+    }
+    return this->m_sendRing.write(fwBuffer.getData(), fwBuffer.getSize());
+}
+
+Drv::SendStatus LinuxShmDriver ::send_handler(const NATIVE_INT_TYPE portNum, Fw::Buffer& fwBuffer) {
+    const ShmRing::Status status = this->write(fwBuffer);
+    // Only deallocate buffer when the caller is not asked to retry
+    if (status == ShmRing::RING_FULL) {
+        return SendStatus::SEND_RETRY;
+    }
+    if (this->isConnected_deallocate_OutputPort(0)) {
+        this->deallocate_out(0, fwBuffer);
+    }
+    return (status == ShmRing::RING_OK) ? SendStatus::SEND_OK : SendStatus::SEND_ERROR;
+}
+
+void LinuxShmDriver ::bufferSend_handler(const NATIVE_INT_TYPE portNum, Fw::Buffer& fwBuffer) {
+    const ShmRing::Status status = this->write(fwBuffer);
+    if (status != ShmRing::RING_OK) {
+        Fw::LogStringArg logName(this->m_name.toChar());
+        this->log_WARNING_HI_TransferDropped(logName, fwBuffer.getSize());
+    }
+    if (this->isConnected_deallocate_OutputPort(0)) {
+        this->deallocate_out(0, fwBuffer);
+    }
+}
+
+void LinuxShmDriver ::deliver(Fw::Buffer& fwBuffer, const RecvStatus& status) {
+    if (this->isConnected_recv_OutputPort(0)) {
+        this->recv_out(0, fwBuffer, status);
+    } else if ((status == RecvStatus::RECV_OK) && this->isConnected_bufferRecv_OutputPort(0)) {
+        this->bufferRecv_out(0, fwBuffer);
+    } else if (this->isConnected_deallocate_OutputPort(0)) {
+        this->deallocate_out(0, fwBuffer);
+    }
+}
+
+void LinuxShmDriver ::readTaskEntry(void* ptr) {
+    FW_ASSERT(ptr != nullptr);
+    LinuxShmDriver* comp = reinterpret_cast<LinuxShmDriver*>(ptr);
+    FW_ASSERT(comp->m_region != nullptr);
+    Fw::Buffer buff;
+    while (!comp->m_quitReadThread) {
+        // Keep the buffer while waiting, it is only passed on once filled
+        if (buff.getData() == nullptr) {
+            buff = comp->allocate_out(0, comp->m_allocationSize);
+            if (buff.getData() == nullptr) {
+                Fw::LogStringArg logName(comp->m_name.toChar());
+                comp->log_WARNING_HI_NoBuffers(logName);
+                // to avoid spinning, wait 50 ms
+                Os::Task::delay(50);
+                continue;
+            }
+        }
+
+        U32 size = buff.getSize();
+        const ShmRing::Status status = comp->m_recvRing.read(buff.getData(), size, READ_TIMEOUT_MS);
+        if (status == ShmRing::RING_OK) {
+            buff.setSize(size);
+            comp->deliver(buff, RecvStatus::RECV_OK);
+            buff = Fw::Buffer();
+        } else if (status == ShmRing::RING_TOO_SMALL) {
+            Fw::LogStringArg logName(comp->m_name.toChar());
+            comp->log_WARNING_HI_BufferTooSmall(logName, buff.getSize(), size);
+        }
+    }
+    // Return the unused buffer
+    if (buff.getData() != nullptr) {
+        buff.setSize(0);
+        comp->deliver(buff, RecvStatus::RECV_ERROR);
+    }
+}
+
+void LinuxShmDriver ::startReadThread(NATIVE_UINT_TYPE priority,
+                                      NATIVE_UINT_TYPE stackSize,
+                                      NATIVE_UINT_TYPE cpuAffinity) {
+    this->m_quitReadThread = false;
+    Os::TaskString task("ShmReader");
+    Os::Task::TaskStatus stat =
+        this->m_readTask.start(task, readTaskEntry, this, priority, stackSize, cpuAffinity);
+    FW_ASSERT(stat == Os::Task::TASK_OK, stat);
+}
+
+void LinuxShmDriver ::quitReadThread() {
+    this->m_quitReadThread = true;
+}
+
+Os::Task::TaskStatus LinuxShmDriver ::join(void** value_ptr) {
+    return m_readTask.join(value_ptr);
+}
+
+}  // end namespace Drv
@@ -0,0 +1,119 @@
+// ======================================================================
+// \title  LinuxShmDriver.hpp
+// \brief  hpp file for LinuxShmDriver component implementation class
+//
+// \copyright
+// Copyright 2009-2024, by the California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#ifndef LinuxShmDriver_HPP
+#define LinuxShmDriver_HPP
+
+#include <Drv/LinuxShmDriver/LinuxShmDriverComponentAc.hpp>
+#include <Drv/LinuxShmDriver/ShmRing.hpp>
+#include <Fw/Types/String.hpp>
+#include <Os/Task.hpp>
+
+#include <atomic>
+
+namespace Drv {
+
+//! The LinuxShmDriver passes buffers to a LinuxShmDriver in another process on the same host. Both drivers map a
+//! named POSIX shared memory object holding one ring per direction, so data is copied into the ring by the sender and
+//! out of it by the receive task without going through the kernel. Each buffer sent arrives as one buffer, so no
+//! framing is needed to recover transfers.
+class LinuxShmDriver : public LinuxShmDriverComponentBase {
+  public:
+    //! Side of the shared memory used by a driver. The two drivers sharing a name must use opposite sides.
+    enum Side {
+        SIDE_A,  //!< Sends on the first ring and receives on the second
+        SIDE_B   //!< Sends on the second ring and receives on the first
+    };
+
+    static const U32 READ_TIMEOUT_MS = 100;  //!< Time the receive task waits for data before checking for quitting
+
+    // ----------------------------------------------------------------------
+    // Construction, initialization, and destruction
+    // ----------------------------------------------------------------------
+
+    //! Construct object LinuxShmDriver
+    //!
+    LinuxShmDriver(const char* const compName /*!< The component name*/
+    );
+
+    //! Initialize object LinuxShmDriver
+    //!
+    void init(const NATIVE_INT_TYPE instance = 0 /*!< The instance number*/
+    );
+
+    //! Open the shared memory, creating it if the other driver did not yet. Signals ready when opened.
+    //! \return true if the shared memory was opened
+    bool open(const char* const name,      //!< Name of the shared memory object, starting with '/'
+              const Side side,             //!< Side of this driver
+              const U32 capacity,          //!< Bytes of each ring, a power of two. Buffers up to half fit.
+              const U32 allocationSize     //!< Size of the buffers allocated to receive into
+    );
+
+    //! Unmap the shared memory. The receive task must have been joined.
+    void close();
+
+    //! Remove a shared memory object, such that the next open starts with empty rings
+    //! \return true if the object was removed
+    static bool unlink(const char* const name);
+
+    //! start the receive thread
+    //!
+    void startReadThread(NATIVE_UINT_TYPE priority = Os::Task::TASK_DEFAULT,
+                         NATIVE_UINT_TYPE stackSize = Os::Task::TASK_DEFAULT,
+                         NATIVE_UINT_TYPE cpuAffinity = Os::Task::TASK_DEFAULT);
+
+    //! Quit thread
+    void quitReadThread();
+
+    //! Join thread
+    Os::Task::TaskStatus join(void** value_ptr);
+
+    //! Destroy object LinuxShmDriver
+    //!
+    ~LinuxShmDriver();
+
+  PRIVATE:
+    // ----------------------------------------------------------------------
+    // Handler implementations for user-defined typed input ports
+    // ----------------------------------------------------------------------
+
+    //! Handler implementation for send. Returns SEND_RETRY and keeps the buffer when the ring is full.
+    //!
+    Drv::SendStatus send_handler(const NATIVE_INT_TYPE portNum, /*!< The port number*/
+                                 Fw::Buffer& fwBuffer);
+
+    //! Handler implementation for bufferSend. Drops the buffer when the ring is full.
+    //!
+    void bufferSend_handler(const NATIVE_INT_TYPE portNum, /*!< The port number*/
+                            Fw::Buffer& fwBuffer);
+
+    //! Write a buffer to the send ring
+    ShmRing::Status write(const Fw::Buffer& fwBuffer);
+
+    //! Pass a received buffer on, or return it with an error status
+    void deliver(Fw::Buffer& fwBuffer, const RecvStatus& status);
+
+    //! This method will be called by the new thread to wait for data in the receive ring.
+    static void readTaskEntry(void* ptr);
+
+    Fw::String m_name;                  //!< Name of the shared memory object
+    void* m_region;                     //!< Mapped shared memory, nullptr if not opened
+    U32 m_regionSize;                   //!< Bytes of mapped shared memory
+    U32 m_allocationSize;               //!< Size of allocation request to memory manager
+    ShmRing m_sendRing;                 //!< Ring this driver writes to
+    ShmRing m_recvRing;                 //!< Ring this driver reads from
+    Os::Task m_readTask;                //!< Task reading the receive ring
+    std::atomic<bool> m_quitReadThread; //!< flag to quit thread
+};
+
+}  // end namespace Drv
+
+#endif
@@ -0,0 +1,139 @@
+// ======================================================================
+// \title  ShmRing.cpp
+// \brief  cpp file for a message ring in memory shared between processes
+//
+// \copyright
+// Copyright 2009-2024, by the California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#include <Drv/LinuxShmDriver/ShmRing.hpp>
+#include <Fw/Types/Assert.hpp>
+
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <cstring>
+#include <ctime>
+
+// The futex calls operate on the control words in place
+static_assert(sizeof(std::atomic<U32>) == sizeof(U32), "std::atomic<U32> must have the layout of U32");
+static_assert(ATOMIC_INT_LOCK_FREE == 2, "std::atomic<U32> must be lock free to be shared between processes");
+
+namespace Drv {
+
+namespace {
+void futexWait(std::atomic<U32>& word, const U32 expected, const U32 timeoutMs) {
+    struct timespec timeout;
+    timeout.tv_sec = static_cast<time_t>(timeoutMs / 1000);
+    timeout.tv_nsec = static_cast<long>(timeoutMs % 1000) * 1000000;
+    // Returns at once if the word changed, and may wake spuriously, so callers check the word again
+    (void)syscall(SYS_futex, reinterpret_cast<U32*>(&word), FUTEX_WAIT, expected, &timeout, nullptr, 0);
+}
+
+void futexWake(std::atomic<U32>& word) {
+    (void)syscall(SYS_futex, reinterpret_cast<U32*>(&word), FUTEX_WAKE, 1, nullptr, nullptr, 0);
+}
+}  // namespace
+
+const U32 ShmRing::WRAP_MARKER;
+
+ShmRing::ShmRing() : m_control(nullptr), m_data(nullptr), m_capacity(0) {}
+
+U32 ShmRing::regionSize(const U32 capacity) {
+    return sizeof(Control) + capacity;
+}
+
+void ShmRing::setup(void* region, const U32 capacity) {
+    FW_ASSERT(region != nullptr);
+    FW_ASSERT((reinterpret_cast<POINTER_CAST>(region) % alignof(Control)) == 0);
+    FW_ASSERT((capacity >= 64) && ((capacity & (capacity - 1)) == 0), capacity);
+    this->m_control = static_cast<Control*>(region);
+    this->m_data = static_cast<U8*>(region) + sizeof(Control);
+    this->m_capacity = capacity;
+}
+
+void ShmRing::cleanup() {
+    this->m_control = nullptr;
+    this->m_data = nullptr;
+    this->m_capacity = 0;
+}
+
+U32 ShmRing::align(const U32 size) {
+    return (size + sizeof(U32) - 1) & ~static_cast<U32>(sizeof(U32) - 1);
+}
+
+ShmRing::Status ShmRing::write(const U8* data, const U32 size) {
+    FW_ASSERT(this->m_control != nullptr);
+    FW_ASSERT(data != nullptr);
+    // Up to half the ring, a message fits in an empty ring wherever the positions are
+    if (size > this->m_capacity / 2 - sizeof(U32)) {
+        return RING_TOO_LARGE;
+    }
+    const U32 needed = sizeof(U32) + align(size);
+    const U32 head = this->m_control->head.load(std::memory_order_relaxed);
+    const U32 tail = this->m_control->tail.load(std::memory_order_acquire);
+    U32 offset = head & (this->m_capacity - 1);
+    const U32 contiguous = this->m_capacity - offset;
+    const U32 padding = (needed > contiguous) ? contiguous : 0;
+    if (padding + needed > this->m_capacity - (head - tail)) {
+        return RING_FULL;
+    }
+    if (padding > 0) {
+        std::memcpy(this->m_data + offset, &WRAP_MARKER, sizeof(U32));
+        offset = 0;
+    }
+    std::memcpy(this->m_data + offset, &size, sizeof(U32));
+    std::memcpy(this->m_data + offset + sizeof(U32), data, size);
+
+    // Publishing the message and checking for a sleeping consumer pairs with the consumer announcing it sleeps and
+    // checking for messages, such that one of both sees the other
+    this->m_control->head.store(head + padding + needed, std::memory_order_seq_cst);
+    if (this->m_control->waiting.load(std::memory_order_seq_cst) != 0) {
+        futexWake(this->m_control->head);
+    }
+    return RING_OK;
+}
+
+ShmRing::Status ShmRing::read(U8* data, U32& size, const U32 timeoutMs) {
+    FW_ASSERT(this->m_control != nullptr);
+    FW_ASSERT(data != nullptr);
+    while (true) {
+        const U32 tail = this->m_control->tail.load(std::memory_order_relaxed);
+        U32 head = this->m_control->head.load(std::memory_order_acquire);
+        if (head == tail) {
+            this->m_control->waiting.store(1, std::memory_order_seq_cst);
+            head = this->m_control->head.load(std::memory_order_seq_cst);
+            if (head == tail) {
+                futexWait(this->m_control->head, head, timeoutMs);
+            }
+            this->m_control->waiting.store(0, std::memory_order_relaxed);
+            head = this->m_control->head.load(std::memory_order_acquire);
+            if (head == tail) {
+                return RING_EMPTY;
+            }
+        }
+
+        const U32 offset = tail & (this->m_capacity - 1);
+        U32 messageSize = 0;
+        std::memcpy(&messageSize, this->m_data + offset, sizeof(U32));
+        if (messageSize == WRAP_MARKER) {
+            this->m_control->tail.store(tail + (this->m_capacity - offset), std::memory_order_release);
+            continue;
+        }
+        FW_ASSERT(messageSize <= this->m_capacity / 2 - sizeof(U32), messageSize);
+
+        Status status = RING_TOO_SMALL;
+        if (messageSize <= size) {
+            std::memcpy(data, this->m_data + offset + sizeof(U32), messageSize);
+            status = RING_OK;
+        }
+        size = messageSize;
+        this->m_control->tail.store(tail + sizeof(U32) + align(messageSize), std::memory_order_release);
+        return status;
+    }
+}
+
+}  // end namespace Drv
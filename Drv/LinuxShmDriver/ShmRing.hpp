@@ -0,0 +1,83 @@
+// ======================================================================
+// \title  ShmRing.hpp
+// \brief  hpp file for a message ring in memory shared between processes
+//
+// \copyright
+// Copyright 2009-2024, by the California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#ifndef Drv_ShmRing_HPP
+#define Drv_ShmRing_HPP
+
+#include <FpConfig.hpp>
+#include <atomic>
+
+namespace Drv {
+
+/**
+ * \brief single producer, single consumer ring of messages in shared memory
+ *
+ * The ring keeps message boundaries: each write is read back as one message. Messages are stored as a U32 size
+ * followed by the data, padded to 4 bytes. A message that does not fit before the end of the ring is preceded by a wrap
+ * marker and stored from the start. Positions are free running counters, such that the capacity must be a power of
+ * two.
+ *
+ * The consumer sleeps on a futex on the write position, and the producer only wakes it when it announced it is
+ * sleeping. The futex is not process private, such that producer and consumer may live in different processes that
+ * map the same memory. Zeroed memory is an empty ring.
+ */
+class ShmRing {
+  public:
+    enum Status {
+        RING_OK,         //!< Message written or read
+        RING_FULL,       //!< Not enough space for the message, retry once the consumer read
+        RING_TOO_LARGE,  //!< Message can never fit in the ring
+        RING_EMPTY,      //!< No message arrived before the timeout
+        RING_TOO_SMALL   //!< Destination too small for the message, which was dropped
+    };
+
+    //! Control words of a ring, each on its own cache line such that producer and consumer do not share one
+    struct Control {
+        alignas(64) std::atomic<U32> head;     //!< Write position, advanced by the producer
+        alignas(64) std::atomic<U32> tail;     //!< Read position, advanced by the consumer
+        alignas(64) std::atomic<U32> waiting;  //!< Set by the consumer before it sleeps on head
+    };
+
+    ShmRing();
+
+    //! \return the bytes of shared memory used by a ring of the given capacity
+    static U32 regionSize(const U32 capacity);
+
+    //! Attach to a ring in shared memory
+    void setup(void* region,     //!< Memory of regionSize(capacity) bytes, aligned to 64 bytes
+               const U32 capacity  //!< Bytes of message storage, a power of two
+    );
+
+    //! Detach from the ring
+    void cleanup();
+
+    //! Write a message, waking the consumer if it sleeps. Never blocks.
+    Status write(const U8* data, const U32 size);
+
+    //! Read the next message, waiting for one up to a timeout
+    Status read(U8* data,             //!< Destination of the message
+                U32& size,            //!< In: size of the destination. Out: size of the message
+                const U32 timeoutMs  //!< Time to wait for a message
+    );
+
+  private:
+    static const U32 WRAP_MARKER = 0xFFFFFFFF;  //!< Size word telling the message continues at the start of the ring
+
+    //! \return size rounded up to the 4 byte alignment of messages
+    static U32 align(const U32 size);
+
+    Control* m_control;  //!< Control words in shared memory
+    U8* m_data;          //!< Message storage in shared memory
+    U32 m_capacity;      //!< Bytes of message storage
+};
+}  // end namespace Drv
+
+#endif  // Drv_ShmRing_HPP
@@ -0,0 +1,20 @@
+// ----------------------------------------------------------------------
+// TestMain.cpp
+// ----------------------------------------------------------------------
+
+#include "LinuxShmDriverTester.hpp"
+
+TEST(Nominal, Messaging) {
+    Drv::LinuxShmDriverTester tester;
+    tester.test_messaging();
+}
+
+TEST(OffNominal, RingFull) {
+    Drv::LinuxShmDriverTester tester;
+    tester.test_ring_full();
+}
+
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,206 @@
+// ======================================================================
+// \title  LinuxShmDriverTester.cpp
+// \brief  cpp file for LinuxShmDriverTester of LinuxShmDriver
+//
+// \copyright
+// Copyright 2009-2024, by the California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+#include "LinuxShmDriverTester.hpp"
+#include <Os/Log.hpp>
+
+#include <unistd.h>
+#include <cstdio>
+#include <cstring>
+
+Os::Log logger;
+
+namespace Drv {
+
+// ----------------------------------------------------------------------
+// Construction and destruction
+// ----------------------------------------------------------------------
+
+LinuxShmDriverTester ::LinuxShmDriverTester()
+    : LinuxShmDriverGTestBase("Tester", MAX_HISTORY_SIZE),
+      component("LinuxShmDriver"),
+      peer("LinuxShmDriverPeer"),
+      m_data_buffer(m_data_storage, 0),
+      m_received(0),
+      m_errors(0),
+      m_messageSize(0),
+      m_peerRunning(false) {
+    this->initComponents();
+    this->connectPorts();
+    // The peer receives what the component sends and hands it to the tester
+    this->peer.init(TEST_INSTANCE_ID);
+    this->peer.set_allocate_OutputPort(0, this->get_from_allocate(0));
+    this->peer.set_recv_OutputPort(0, this->get_from_recv(0));
+    (void)snprintf(m_name, sizeof(m_name), "/fprime_shm_ut_%d", static_cast<int>(::getpid()));
+    ::memset(m_data_storage, 0, sizeof(m_data_storage));
+}
+
+LinuxShmDriverTester ::~LinuxShmDriverTester() {
+    this->close();
+    (void)LinuxShmDriver::unlink(m_name);
+}
+
+// ----------------------------------------------------------------------
+// Tests
+// ----------------------------------------------------------------------
+
+void LinuxShmDriverTester ::test_messaging() {
+    const U32 iterations = 1000;
+    this->open(4096);
+    ASSERT_EVENTS_Opened_SIZE(1);
+    ASSERT_from_ready_SIZE(1);
+    this->peer.startReadThread();
+    m_peerRunning = true;
+
+    // Sizes vary such that messages wrap around the end of the ring at different offsets
+    for (U32 i = 0; i < iterations; i++) {
+        const U32 size = 1 + (i * 37) % SEND_DATA_BUFFER_SIZE;
+        this->fillMessage(i, size);
+        Drv::SendStatus status = SendStatus::SEND_RETRY;
+        while (status == SendStatus::SEND_RETRY) {
+            status = invoke_to_send(0, m_data_buffer);
+            if (status == SendStatus::SEND_RETRY) {
+                Os::Task::delay(1);
+            }
+        }
+        ASSERT_EQ(status, SendStatus::SEND_OK);
+    }
+    ASSERT_TRUE(this->waitForMessages(iterations));
+    ASSERT_EQ(m_errors, 0u);
+    ASSERT_from_deallocate_SIZE(iterations);
+}
+
+void LinuxShmDriverTester ::test_ring_full() {
+    // Each message takes 64 bytes of the ring: a size word and 60 bytes of data
+    const U32 capacity = 256;
+    m_messageSize = 60;
+    this->open(capacity);
+
+    // Nothing reads the ring yet, such that it fills up
+    for (U32 i = 0; i < capacity / 64; i++) {
+        this->fillMessage(i, m_messageSize);
+        ASSERT_EQ(invoke_to_send(0, m_data_buffer), SendStatus::SEND_OK);
+    }
+    this->fillMessage(capacity / 64, m_messageSize);
+    ASSERT_EQ(invoke_to_send(0, m_data_buffer), SendStatus::SEND_RETRY);
+    // The caller keeps a buffer it is asked to resend
+    ASSERT_from_deallocate_SIZE(capacity / 64);
+
+    // A full ring drops buffers sent without a status
+    invoke_to_bufferSend(0, m_data_buffer);
+    ASSERT_EVENTS_TransferDropped_SIZE(1);
+    ASSERT_EVENTS_TransferDropped(0, m_name, m_messageSize);
+    ASSERT_from_deallocate_SIZE(capacity / 64 + 1);
+
+    // Buffers over half the ring never fit
+    m_data_buffer.setSize(capacity / 2);
+    ASSERT_EQ(invoke_to_send(0, m_data_buffer), SendStatus::SEND_ERROR);
+    ASSERT_from_deallocate_SIZE(capacity / 64 + 2);
+
+    // Once drained, the ring takes messages again and keeps their order while positions wrap
+    this->peer.startReadThread();
+    m_peerRunning = true;
+    ASSERT_TRUE(this->waitForMessages(capacity / 64));
+    const U32 total = 100;
+    for (U32 i = capacity / 64; i < total; i++) {
+        this->fillMessage(i, m_messageSize);
+        Drv::SendStatus status = SendStatus::SEND_RETRY;
+        while (status == SendStatus::SEND_RETRY) {
+            status = invoke_to_send(0, m_data_buffer);
+            if (status == SendStatus::SEND_RETRY) {
+                Os::Task::delay(1);
+            }
+        }
+        ASSERT_EQ(status, SendStatus::SEND_OK);
+    }
+    ASSERT_TRUE(this->waitForMessages(total));
+    ASSERT_EQ(m_errors, 0u);
+}
+
+// ----------------------------------------------------------------------
+// Helper methods
+// ----------------------------------------------------------------------
+
+void LinuxShmDriverTester ::open(const U32 capacity) {
+    // Start from empty rings, whatever an earlier run left behind
+    (void)LinuxShmDriver::unlink(m_name);
+    ASSERT_TRUE(this->component.open(m_name, LinuxShmDriver::SIDE_A, capacity, SEND_DATA_BUFFER_SIZE));
+    ASSERT_TRUE(this->peer.open(m_name, LinuxShmDriver::SIDE_B, capacity, SEND_DATA_BUFFER_SIZE));
+}
+
+void LinuxShmDriverTester ::fillMessage(const U32 index, const U32 size) {
+    FW_ASSERT(size <= sizeof(m_data_storage), size);
+    for (U32 j = 0; j < size; j++) {
+        m_data_storage[j] = static_cast<U8>(index + j);
+    }
+    m_data_buffer.setData(m_data_storage);
+    m_data_buffer.setSize(size);
+}
+
+bool LinuxShmDriverTester ::waitForMessages(const U32 count) {
+    // Up to 5 seconds
+    for (U32 i = 0; (i < 500) && (m_received < count); i++) {
+        Os::Task::delay(10);
+    }
+    return m_received == count;
+}
+
+void LinuxShmDriverTester ::close() {
+    if (m_peerRunning) {
+        this->peer.quitReadThread();
+        (void)this->peer.join(nullptr);
+        m_peerRunning = false;
+    }
+    this->peer.close();
+    this->component.close();
+}
+
+// ----------------------------------------------------------------------
+// Handlers for typed from ports
+// ----------------------------------------------------------------------
+
+void LinuxShmDriverTester ::from_recv_handler(const NATIVE_INT_TYPE portNum,
+                                              Fw::Buffer& recvBuffer,
+                                              const RecvStatus& recvStatus) {
+    // Called from the peer receive task, so results go to atomics rather than the port history
+    if (recvStatus == RecvStatus::RECV_OK) {
+        const U32 index = m_received;
+        const U32 size = (m_messageSize != 0) ? m_messageSize : 1 + (index * 37) % SEND_DATA_BUFFER_SIZE;
+        bool valid = (recvBuffer.getSize() == size);
+        for (U32 j = 0; valid && (j < size); j++) {
+            valid = (recvBuffer.getData()[j] == static_cast<U8>(index + j));
+        }
+        if (not valid) {
+            m_errors++;
+        }
+        m_received++;
+    }
+    delete[] recvBuffer.getData();
+}
+
+void LinuxShmDriverTester ::from_ready_handler(const NATIVE_INT_TYPE portNum) {
+    this->pushFromPortEntry_ready();
+}
+
+Fw::Buffer LinuxShmDriverTester ::from_allocate_handler(const NATIVE_INT_TYPE portNum, U32 size) {
+    // Called from the peer receive task
+    Fw::Buffer buffer(new U8[size], size);
+    return buffer;
+}
+
+void LinuxShmDriverTester ::from_deallocate_handler(const NATIVE_INT_TYPE portNum, Fw::Buffer& fwBuffer) {
+    this->pushFromPortEntry_deallocate(fwBuffer);
+}
+
+void LinuxShmDriverTester ::from_bufferRecv_handler(const NATIVE_INT_TYPE portNum, Fw::Buffer& fwBuffer) {
+    this->pushFromPortEntry_bufferRecv(fwBuffer);
+}
+
+}  // end namespace Drv
@@ -0,0 +1,132 @@
+// ======================================================================
+// \title  LinuxShmDriver/test/ut/LinuxShmDriverTester.hpp
+// \brief  hpp file for LinuxShmDriver test harness implementation class
+//
+// \copyright
+// Copyright 2009-2024, by the California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#ifndef LINUXSHMDRIVERTESTER_HPP
+#define LINUXSHMDRIVERTESTER_HPP
+
+#include "LinuxShmDriverGTestBase.hpp"
+#include "Drv/LinuxShmDriver/LinuxShmDriver.hpp"
+
+#include <atomic>
+
+#define SEND_DATA_BUFFER_SIZE 1024
+
+namespace Drv {
+
+class LinuxShmDriverTester : public LinuxShmDriverGTestBase {
+    // Maximum size of histories storing events, telemetry, and port outputs
+    static const NATIVE_INT_TYPE MAX_HISTORY_SIZE = 1000;
+    // Instance ID supplied to the component instance under test
+    static const NATIVE_INT_TYPE TEST_INSTANCE_ID = 0;
+
+    // ----------------------------------------------------------------------
+    // Construction and destruction
+    // ----------------------------------------------------------------------
+
+  public:
+    //! Construct object LinuxShmDriverTester
+    //!
+    LinuxShmDriverTester();
+
+    //! Destroy object LinuxShmDriverTester
+    //!
+    ~LinuxShmDriverTester();
+
+  public:
+    // ----------------------------------------------------------------------
+    // Tests
+    // ----------------------------------------------------------------------
+
+    //! Send buffers of varying size to the peer driver and check they arrive whole and in order
+    void test_messaging();
+
+    //! Fill the ring, check full and oversized sends, then drain it
+    void test_ring_full();
+
+  private:
+    // ----------------------------------------------------------------------
+    // Handlers for typed from ports
+    // ----------------------------------------------------------------------
+
+    //! Handler for from_recv
+    //!
+    void from_recv_handler(const NATIVE_INT_TYPE portNum, /*!< The port number*/
+                           Fw::Buffer& recvBuffer,
+                           const RecvStatus& recvStatus);
+
+    //! Handler for from_ready
+    //!
+    void from_ready_handler(const NATIVE_INT_TYPE portNum /*!< The port number*/
+    );
+
+    //! Handler for from_allocate
+    //!
+    Fw::Buffer from_allocate_handler(const NATIVE_INT_TYPE portNum, /*!< The port number*/
+                                     U32 size);
+
+    //! Handler for from_deallocate
+    //!
+    void from_deallocate_handler(const NATIVE_INT_TYPE portNum, /*!< The port number*/
+                                 Fw::Buffer& fwBuffer);
+
+    //! Handler for from_bufferRecv
+    //!
+    void from_bufferRecv_handler(const NATIVE_INT_TYPE portNum, /*!< The port number*/
+                                 Fw::Buffer& fwBuffer);
+
+  private:
+    // ----------------------------------------------------------------------
+    // Helper methods
+    // ----------------------------------------------------------------------
+
+    //! Connect ports
+    //!
+    void connectPorts();
+
+    //! Initialize components
+    //!
+    void initComponents();
+
+    //! Open the component and its peer on a fresh shared memory object
+    void open(const U32 capacity);
+
+    //! Fill the send buffer with the message of an index
+    void fillMessage(const U32 index, const U32 size);
+
+    //! Wait until the peer received a number of messages
+    //! \return true if they arrived in time
+    bool waitForMessages(const U32 count);
+
+    //! Stop the peer receive task and unmap both drivers
+    void close();
+
+  private:
+    // ----------------------------------------------------------------------
+    // Variables
+    // ----------------------------------------------------------------------
+
+    //! The component under test
+    //!
+    LinuxShmDriver component;
+    //! The driver on the other side of the shared memory
+    LinuxShmDriver peer;
+    char m_name[64];
+    Fw::Buffer m_data_buffer;
+    U8 m_data_storage[SEND_DATA_BUFFER_SIZE];
+    std::atomic<U32> m_received;  //!< messages the peer received
+    std::atomic<U32> m_errors;    //!< messages the peer received that did not match
+    U32 m_messageSize;            //!< size of each message when fixed, 0 if sizes vary by index
+    bool m_peerRunning;
+};
+
+}  // end namespace Drv
+
+#endif
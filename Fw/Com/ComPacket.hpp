@@ -26,6 +26,7 @@ namespace Fw {
                 FW_PACKET_PACKETIZED_TLM, // !< Packetized telemetry packet type
                 FW_PACKET_DP, //!< Data product packet
                 FW_PACKET_IDLE, // !< Idle packet
+                FW_PACKET_LOG_BATCH, //!< Batch of log records, each with its own ID, time tag and argument length
                 FW_PACKET_UNKNOWN = 0xFF // !< Unknown packet
             } ComPacketType;
 
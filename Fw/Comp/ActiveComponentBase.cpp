@@ -30,16 +30,46 @@ namespace Fw {
 
     };
 
+#if FW_PROFILING == 1
+    ActiveComponentBase* ActiveComponentBase::s_firstProfiled = nullptr;
+
+    ActiveComponentBase::ActiveComponentBase(const char* name) :
+        QueuedComponentBase(name), m_profiled(false), m_nextProfiled(nullptr) {
+
+    }
+#else
     ActiveComponentBase::ActiveComponentBase(const char* name) : QueuedComponentBase(name) {
 
     }
+#endif
 
     ActiveComponentBase::~ActiveComponentBase() {
         DEBUG_PRINT("ActiveComponent %s destructor.\n",this->getObjName());
+#if FW_PROFILING == 1
+        // Unlink from the profiled components
+        for (ActiveComponentBase** link = &s_firstProfiled; *link != nullptr; link = &(*link)->m_nextProfiled) {
+            if (*link == this) {
+                *link = this->m_nextProfiled;
+                break;
+            }
+        }
+#endif
     }
 
     void ActiveComponentBase::init(NATIVE_INT_TYPE instance) {
         QueuedComponentBase::init(instance);
+#if FW_PROFILING == 1
+        // Link at the end of the profiled components such that they are listed in initialization order. Components
+        // are initialized before any task is started, so the list is not locked.
+        if (!this->m_profiled) {
+            ActiveComponentBase** link = &s_firstProfiled;
+            while (*link != nullptr) {
+                link = &(*link)->m_nextProfiled;
+            }
+            *link = this;
+            this->m_profiled = true;
+        }
+#endif
     }
 
 #if FW_OBJECT_TO_STRING == 1 && FW_OBJECT_NAMES == 1
@@ -100,6 +130,11 @@ namespace Fw {
             return;
         }
         ActiveComponentBase::MsgDispatchStatus loopStatus = comp->doDispatch();
+#if FW_PROFILING == 1
+        if (loopStatus == ActiveComponentBase::MSG_DISPATCH_OK) {
+            comp->recordDispatch();
+        }
+#endif
         switch (loopStatus) {
             case ActiveComponentBase::MSG_DISPATCH_OK: // if normal message processing, continue
                 break;
@@ -131,6 +166,11 @@ namespace Fw {
         bool quitLoop = false;
         while (!quitLoop) {
             MsgDispatchStatus loopStatus = this->doDispatch();
+#if FW_PROFILING == 1
+            if (loopStatus == MSG_DISPATCH_OK) {
+                this->recordDispatch();
+            }
+#endif
             switch (loopStatus) {
                 case MSG_DISPATCH_OK: // if normal message processing, continue
                     break;
@@ -150,4 +190,30 @@ namespace Fw {
     void ActiveComponentBase::finalizer() {
     }
 
+#if FW_PROFILING == 1
+    void ActiveComponentBase::recordDispatch() {
+        // Handler time runs from the message leaving the queue, excluding the time blocked waiting for it
+        Os::IntervalTimer::RawTime now;
+        Os::IntervalTimer::getRawTime(now);
+        this->m_handlerProfile.record(Os::IntervalTimer::getDiffUsec(now, this->m_queue.getLastReceiveTime()));
+        this->m_latencyProfile.record(this->m_queue.getLastWaitUsec());
+    }
+
+    const ProfileHistogram& ActiveComponentBase::getHandlerProfile() const {
+        return this->m_handlerProfile;
+    }
+
+    const ProfileHistogram& ActiveComponentBase::getLatencyProfile() const {
+        return this->m_latencyProfile;
+    }
+
+    ActiveComponentBase* ActiveComponentBase::getFirstProfiled() {
+        return s_firstProfiled;
+    }
+
+    ActiveComponentBase* ActiveComponentBase::getNextProfiled() const {
+        return this->m_nextProfiled;
+    }
+#endif
+
 }
@@ -15,6 +15,9 @@
 #include <Fw/Comp/QueuedComponentBase.hpp>
 #include <Fw/Deprecate.hpp>
 #include <Os/Task.hpp>
+#if FW_PROFILING == 1
+#include <Fw/Types/ProfileHistogram.hpp>
+#endif
 
 namespace Fw {
 class ActiveComponentBase : public QueuedComponentBase {
@@ -31,6 +34,13 @@ class ActiveComponentBase : public QueuedComponentBase {
         ACTIVE_COMPONENT_EXIT  //!< message to exit active component task
     };
 
+#if FW_PROFILING == 1
+    const ProfileHistogram& getHandlerProfile() const;  //!< execution time of dispatched message handlers
+    const ProfileHistogram& getLatencyProfile() const;  //!< time dispatched messages waited on the queue
+    static ActiveComponentBase* getFirstProfiled();     //!< first initialized active component, or nullptr
+    ActiveComponentBase* getNextProfiled() const;       //!< next initialized active component, or nullptr
+#endif
+
   PROTECTED:
     explicit ActiveComponentBase(const char* name);  //!< Constructor
     virtual ~ActiveComponentBase();                  //!< Destructor
@@ -45,6 +55,14 @@ class ActiveComponentBase : public QueuedComponentBase {
   PRIVATE:
     static void s_baseTask(void*);      //!< function provided to task class for new thread.
     static void s_baseBareTask(void*);  //!< function provided to task class for new thread.
+#if FW_PROFILING == 1
+    void recordDispatch();                      //!< record the profile of a message just dispatched
+    ProfileHistogram m_handlerProfile;          //!< execution time of dispatched message handlers
+    ProfileHistogram m_latencyProfile;          //!< time dispatched messages waited on the queue
+    bool m_profiled;                            //!< set when linked into the list of profiled components
+    ActiveComponentBase* m_nextProfiled;        //!< next profiled component
+    static ActiveComponentBase* s_firstProfiled;  //!< first profiled component
+#endif
 };
 
 }  // namespace Fw
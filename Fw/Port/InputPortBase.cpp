@@ -1,6 +1,7 @@
 #include <FpConfig.hpp>
 #include <Fw/Port/InputPortBase.hpp>
 #include <Fw/Types/Assert.hpp>
+#include <cinttypes>
 #include <cstdio>
 
 namespace Fw {
@@ -30,8 +31,14 @@ namespace Fw {
 #if FW_OBJECT_NAMES == 1 
         FW_ASSERT(size > 0);
         FW_ASSERT(buffer != nullptr);
+#if FW_PORT_TRACING == 1 && FW_PROFILING == 1
+        PlatformIntType status = snprintf(buffer, size, "InputPort: %s->%s calls: %" PRIu32, this->m_objName.toChar(),
+                                        this->isConnected() ? this->m_connObj->getObjName() : "None",
+                                        this->getCallCount());
+#else
         PlatformIntType status = snprintf(buffer, size, "InputPort: %s->%s", this->m_objName.toChar(),
                                         this->isConnected() ? this->m_connObj->getObjName() : "None");
+#endif
         if (status < 0) {
             buffer[0] = 0;
         }
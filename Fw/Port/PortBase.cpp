@@ -1,4 +1,5 @@
 #include <Fw/Port/PortBase.hpp>
+#include <Fw/Port/PortTrace.hpp>
 #include <FpConfig.hpp>
 #include <Fw/Logger/Logger.hpp>
 #include <cstdio>
@@ -24,13 +25,21 @@ namespace Fw {
 #if FW_PORT_TRACING == 1
                 ,m_trace(false),
                 m_ovr_trace(false)
+#if FW_PORT_TRACE_RECORDING == 1
+                ,m_traceId(PortTrace::registerPort(this))
+#endif
+#if FW_PROFILING == 1
+                ,m_calls(0)
+#endif
 #endif
     {
 
     }
 
     PortBase::~PortBase() {
-
+#if FW_PORT_TRACING == 1 && FW_PORT_TRACE_RECORDING == 1
+        PortTrace::unregisterPort(this->m_traceId);
+#endif
     }
 
     void PortBase::init() {
@@ -45,6 +54,14 @@ namespace Fw {
 #if FW_PORT_TRACING == 1
 
     void PortBase::trace() {
+#if FW_PROFILING == 1
+        this->m_calls++;
+#endif
+#if FW_PORT_TRACE_RECORDING == 1
+        PortTrace::record(this->m_traceId);
+#endif
+
+#if FW_PORT_TRACE_TEXT == 1
         bool do_trace = false;
 
         if (this->m_ovr_trace) {
@@ -62,7 +79,14 @@ namespace Fw {
             Fw::Logger::logMsg("Trace: %p\n", reinterpret_cast<POINTER_CAST>(this), 0, 0, 0, 0, 0);
 #endif
         }
+#endif
+    }
+
+#if FW_PORT_TRACE_RECORDING == 1
+    U32 PortBase::getTraceId() const {
+        return this->m_traceId;
     }
+#endif
 
     void PortBase::setTrace(bool trace) {
         PortBase::s_trace = trace;
@@ -73,6 +97,12 @@ namespace Fw {
         this->m_trace = trace;
     }
 
+#if FW_PROFILING == 1
+    U32 PortBase::getCallCount() const {
+        return this->m_calls;
+    }
+#endif
+
 #endif // FW_PORT_TRACING
 
 #if FW_OBJECT_NAMES == 1
@@ -16,11 +16,17 @@ namespace Fw {
     class PortBase : public Fw::ObjBase {
         public:
 #if FW_PORT_TRACING == 1
-            static void setTrace(bool trace); // !< turn tracing on or off
-            void ovrTrace(bool ovr, bool trace); // !< override tracing for a particular port
+            static void setTrace(bool trace); // !< turn text tracing on or off, requires FW_PORT_TRACE_TEXT
+            void ovrTrace(bool ovr, bool trace); // !< override text tracing for a particular port
 #endif
 
             bool isConnected();
+#if FW_PORT_TRACING == 1 && FW_PROFILING == 1
+            U32 getCallCount() const; // !< number of calls through the port
+#endif
+#if FW_PORT_TRACING == 1 && FW_PORT_TRACE_RECORDING == 1
+            U32 getTraceId() const; // !< identifier of the port in trace records
+#endif
         protected:
             // Should only be accessed by derived classes
             PortBase(); // Constructor
@@ -39,9 +45,15 @@ namespace Fw {
 
         private:
 #if FW_PORT_TRACING == 1
-            static bool s_trace; // !< global tracing is active
-            bool m_trace; // !< local trace flag
-            bool m_ovr_trace; // !< flag to override global trace
+            static bool s_trace; // !< global text tracing is active
+            bool m_trace; // !< local text trace flag
+            bool m_ovr_trace; // !< flag to override global text trace
+#if FW_PORT_TRACE_RECORDING == 1
+            U32 m_traceId; // !< identifier of the port in trace records
+#endif
+#if FW_PROFILING == 1
+            U32 m_calls; // !< number of calls through the port
+#endif
 #endif
             // Disable constructors
             PortBase(PortBase*);
@@ -0,0 +1,160 @@
+#include <Fw/Port/PortTrace.hpp>
+#include <Fw/Types/Assert.hpp>
+#include <atomic>
+
+#if FW_PORT_TRACE_RECORDING == 1
+
+namespace Fw {
+
+    namespace {
+        //! Ring written by a single thread and read by snapshots
+        struct Ring {
+            std::atomic<bool> owned; //!< a thread is recording into the ring
+            std::atomic<U32> next; //!< index of the next record to write, counting all records ever written
+            PortTrace::Record records[FW_PORT_TRACE_RING_SIZE]; //!< most recent records
+        };
+
+        Ring s_rings[FW_PORT_TRACE_RINGS];
+        std::atomic<U32> s_claimed(0); //!< number of rings ever claimed, rings are claimed lowest first
+        std::atomic<U32> s_released(0); //!< number of rings released by exiting threads
+        std::atomic<U32> s_dropped(0);
+        std::atomic<bool> s_enabled(false);
+        std::atomic<PortTrace::Clock> s_clock(nullptr);
+
+        ObjBase* s_ports[FW_PORT_TRACE_MAX_PORTS];
+        std::atomic<U32> s_numPorts(0);
+
+        //! Ring of a thread, released when the thread exits
+        struct RingOwner {
+            Ring* ring = nullptr; //!< ring of this thread, once claimed
+            bool full = false; //!< this thread found every ring owned
+            U32 released = 0; //!< rings released before this thread last found every ring owned
+
+            ~RingOwner() {
+                if (this->ring != nullptr) {
+                    this->ring->owned.store(false, std::memory_order_release);
+                    s_released.fetch_add(1);
+                }
+            }
+        };
+
+        thread_local RingOwner t_owner;
+
+        //! Claim the lowest ring no thread owns
+        //! \return the ring, or nullptr when every ring is owned
+        Ring* claimRing() {
+            for (U32 index = 0; index < FW_PORT_TRACE_RINGS; index++) {
+                bool owned = false;
+                if (s_rings[index].owned.compare_exchange_strong(owned, true, std::memory_order_acquire)) {
+                    U32 claimed = s_claimed.load();
+                    while ((claimed <= index) && !s_claimed.compare_exchange_weak(claimed, index + 1)) {
+                    }
+                    return &s_rings[index];
+                }
+            }
+            return nullptr;
+        }
+    }
+
+    void PortTrace::setClock(Clock clock) {
+        s_clock.store(clock);
+    }
+
+    void PortTrace::setEnabled(bool enabled) {
+        s_enabled.store(enabled);
+    }
+
+    void PortTrace::record(U32 port) {
+        if (!s_enabled.load(std::memory_order_relaxed)) {
+            return;
+        }
+        RingOwner& owner = t_owner;
+        Ring* ring = owner.ring;
+        if (ring == nullptr) {
+            // A thread that found every ring owned only looks again once another thread released one
+            const U32 released = s_released.load();
+            if (!owner.full || (owner.released != released)) {
+                ring = claimRing();
+            }
+            if (ring == nullptr) {
+                owner.full = true;
+                owner.released = released;
+                s_dropped.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+            owner.ring = ring;
+        }
+        const Clock clock = s_clock.load(std::memory_order_relaxed);
+        // Only this thread writes the ring, publish the record after it is complete
+        const U32 next = ring->next.load(std::memory_order_relaxed);
+        Record& record = ring->records[next % FW_PORT_TRACE_RING_SIZE];
+        record.time = (clock == nullptr) ? 0 : clock();
+        record.port = port;
+        ring->next.store(next + 1, std::memory_order_release);
+    }
+
+    U32 PortTrace::snapshot(U32 ring, Record* records, U32 capacity) {
+        FW_ASSERT(ring < PortTrace::getRingCount(), ring);
+        FW_ASSERT(records != nullptr);
+        const Ring& source = s_rings[ring];
+
+        // One slot is left for the record the writer may be writing, which is not yet complete
+        const U32 end = source.next.load(std::memory_order_acquire);
+        U32 count = (end < FW_PORT_TRACE_RING_SIZE - 1) ? end : FW_PORT_TRACE_RING_SIZE - 1;
+        count = (count < capacity) ? count : capacity;
+        const U32 start = end - count;
+        for (U32 i = 0; i < count; i++) {
+            records[i] = source.records[(start + i) % FW_PORT_TRACE_RING_SIZE];
+        }
+
+        // The writer may have lapped the oldest records while they were copied
+        const U32 after = source.next.load(std::memory_order_acquire);
+        const U32 lapped = after + 1 - start;
+        if (lapped > FW_PORT_TRACE_RING_SIZE) {
+            const U32 skip = lapped - FW_PORT_TRACE_RING_SIZE;
+            if (skip >= count) {
+                return 0;
+            }
+            for (U32 i = skip; i < count; i++) {
+                records[i - skip] = records[i];
+            }
+            count -= skip;
+        }
+        return count;
+    }
+
+    U32 PortTrace::getRingCount() {
+        return s_claimed.load();
+    }
+
+    U32 PortTrace::getDropped() {
+        return s_dropped.load();
+    }
+
+    U32 PortTrace::registerPort(ObjBase* port) {
+        FW_ASSERT(port != nullptr);
+        // Ports are usually constructed before tasks start, but identifiers stay unique if they are not
+        const U32 id = s_numPorts.fetch_add(1);
+        if (id < FW_PORT_TRACE_MAX_PORTS) {
+            s_ports[id] = port;
+        }
+        return id;
+    }
+
+    U32 PortTrace::getPortCount() {
+        return s_numPorts.load();
+    }
+
+    void PortTrace::unregisterPort(U32 port) {
+        if (port < FW_PORT_TRACE_MAX_PORTS) {
+            s_ports[port] = nullptr;
+        }
+    }
+
+    ObjBase* PortTrace::getPort(U32 port) {
+        return (port < FW_PORT_TRACE_MAX_PORTS) ? s_ports[port] : nullptr;
+    }
+
+}
+
+#endif
@@ -0,0 +1,66 @@
+#ifndef FW_PORT_TRACE_HPP
+#define FW_PORT_TRACE_HPP
+
+#include <FpConfig.hpp>
+#include <Fw/Obj/ObjBase.hpp>
+
+#if FW_PORT_TRACE_RECORDING == 1
+
+namespace Fw {
+
+    //! \class PortTrace
+    //! \brief Flight recorder of port calls
+    //!
+    //! Each thread calling through ports claims its own ring of FW_PORT_TRACE_RING_SIZE records on its first call, so
+    //! recording takes no lock and does no formatting. Rings hold the most recent calls of their thread. A thread
+    //! releases its ring when it exits, and the next thread to claim the ring continues after the records left in it.
+    //! Threads beyond FW_PORT_TRACE_RINGS running at once are not recorded. Timestamps come from a clock set by the
+    //! project, as the framework has no clock of its own.
+    class PortTrace {
+        public:
+            //! A recorded port call
+            struct Record {
+                U64 time; //!< time of the call in microseconds, from the trace clock
+                U32 port; //!< trace identifier of the port called
+            };
+
+            typedef U64 (*Clock)(); //!< returns the current time in microseconds
+
+            static void setClock(Clock clock); //!< set the clock used to stamp records, nullptr stamps 0
+            static void setEnabled(bool enabled); //!< start or stop recording, recording is off by default
+
+            //! Record a call through a port on the calling thread's ring
+            static void record(U32 port /*!< trace identifier of the port */);
+
+            //! Copy the records of a ring, oldest first. At most FW_PORT_TRACE_RING_SIZE - 1 records are kept, as one
+            //! slot holds the record being written. Records overwritten while copying are left out.
+            //! \return number of records copied
+            static U32 snapshot(U32 ring, /*!< ring to copy, less than getRingCount() */
+                                Record* records, /*!< (output) storage for the records */
+                                U32 capacity /*!< number of records that fit in storage */);
+
+            static U32 getRingCount(); //!< number of rings claimed by threads, including rings since released
+            static U32 getDropped(); //!< number of calls not recorded as their thread had no ring
+
+            //! Assign a trace identifier to a port
+            //! \return the identifier
+            static U32 registerPort(ObjBase* port /*!< the port */);
+
+            static U32 getPortCount(); //!< number of trace identifiers assigned, including ports since destroyed
+
+            //! Forget a port that is being destroyed
+            static void unregisterPort(U32 port /*!< trace identifier of the port */);
+
+            //! Look up a port by trace identifier
+            //! \return the port, or nullptr when unknown or destroyed
+            static ObjBase* getPort(U32 port /*!< trace identifier of the port */);
+
+        private:
+            PortTrace(); //!< not instantiated
+    };
+
+}
+
+#endif
+
+#endif
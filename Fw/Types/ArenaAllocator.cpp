@@ -0,0 +1,106 @@
+/**
+ * \file
+ * \brief Implementation of the arena allocator
+ *
+ * \copyright
+ * Copyright 2009-2024, by the California Institute of Technology.
+ * ALL RIGHTS RESERVED.  United States Government Sponsorship
+ * acknowledged.
+ *
+ */
+
+#include <Fw/Types/ArenaAllocator.hpp>
+#include <Fw/Types/Assert.hpp>
+
+namespace Fw {
+
+ArenaAllocator::ArenaAllocator()
+    : m_allocator(nullptr),
+      m_identifier(0),
+      m_arena(nullptr),
+      m_capacity(0),
+      m_used(0),
+      m_highWater(0),
+      m_failures(0) {}
+
+ArenaAllocator::~ArenaAllocator() {
+    FW_ASSERT(this->m_arena == nullptr);
+}
+
+bool ArenaAllocator::setup(MemAllocator& allocator, const NATIVE_UINT_TYPE identifier, const NATIVE_UINT_TYPE size) {
+    FW_ASSERT(this->m_arena == nullptr);
+    FW_ASSERT(size > 0, size);
+    NATIVE_UINT_TYPE allocated = size;
+    bool recoverable = false;
+    void* memory = allocator.allocate(identifier, allocated, recoverable);
+    if ((memory == nullptr) || (allocated < size)) {
+        if (memory != nullptr) {
+            allocator.deallocate(identifier, memory);
+        }
+        return false;
+    }
+    this->m_allocator = &allocator;
+    this->m_identifier = identifier;
+    this->m_arena = static_cast<U8*>(memory);
+    this->m_capacity = size;
+    this->m_used = 0;
+    this->m_highWater = 0;
+    this->m_failures = 0;
+    return true;
+}
+
+void ArenaAllocator::cleanup() {
+    if (this->m_arena != nullptr) {
+        FW_ASSERT(this->m_allocator != nullptr);
+        this->m_allocator->deallocate(this->m_identifier, this->m_arena);
+        this->m_arena = nullptr;
+        this->m_capacity = 0;
+        this->m_used = 0;
+    }
+}
+
+void* ArenaAllocator::allocate(const NATIVE_UINT_TYPE identifier, NATIVE_UINT_TYPE& size, bool& recoverable) {
+    // scratch memory is never recoverable
+    recoverable = false;
+
+    // The arena start is aligned by its allocator, so aligning offsets aligns addresses
+    const NATIVE_UINT_TYPE start = (this->m_used + ALIGNMENT - 1) & ~(ALIGNMENT - 1);
+    if ((this->m_arena == nullptr) || (start > this->m_capacity) || (size > this->m_capacity - start)) {
+        this->m_failures++;
+        size = 0;
+        return nullptr;
+    }
+    this->m_used = start + size;
+    if (this->m_used > this->m_highWater) {
+        this->m_highWater = this->m_used;
+    }
+    return this->m_arena + start;
+}
+
+void ArenaAllocator::deallocate(const NATIVE_UINT_TYPE identifier, void* ptr) {
+    // Released in bulk by reset
+    FW_ASSERT((ptr == nullptr) || ((static_cast<U8*>(ptr) >= this->m_arena) &&
+                                   (static_cast<U8*>(ptr) <= this->m_arena + this->m_capacity)));
+}
+
+void ArenaAllocator::reset() {
+    this->m_used = 0;
+}
+
+NATIVE_UINT_TYPE ArenaAllocator::getCapacity() const {
+    return this->m_capacity;
+}
+
+NATIVE_UINT_TYPE ArenaAllocator::getUsed() const {
+    return this->m_used;
+}
+
+NATIVE_UINT_TYPE ArenaAllocator::getHighWater() const {
+    return this->m_highWater;
+}
+
+NATIVE_UINT_TYPE ArenaAllocator::getFailures() const {
+    return this->m_failures;
+}
+
+} /* namespace Fw */
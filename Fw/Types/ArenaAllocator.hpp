@@ -0,0 +1,78 @@
+/**
+ * \file
+ * \brief A MemAllocator implementation class handing out scratch memory from a fixed arena.
+ *
+ * \copyright
+ * Copyright 2009-2024, by the California Institute of Technology.
+ * ALL RIGHTS RESERVED.  United States Government Sponsorship
+ * acknowledged.
+ *
+ */
+
+#ifndef TYPES_ARENAALLOCATOR_HPP_
+#define TYPES_ARENAALLOCATOR_HPP_
+
+#include <Fw/Types/MemAllocator.hpp>
+
+namespace Fw {
+
+//! Fw::ArenaAllocator is an implementation of the Fw::MemAllocator interface for scratch memory that lives for one
+//! cycle of a rate group. Memory is handed out from a fixed arena by advancing an offset, so allocation takes constant
+//! time and never fails partially. Individual deallocations do nothing; the whole arena is released at once by
+//! reset(), typically at the end of each cycle. The arena itself is taken from another allocator at setup.
+//!
+//! The arena is not thread safe and is meant to be used from the thread of a single component.
+class ArenaAllocator : public MemAllocator {
+  public:
+    static const NATIVE_UINT_TYPE ALIGNMENT = 8;  //!< Alignment of each allocation, suitable for U64 and F64
+
+    //! Constructor with no arguments
+    //!
+    ArenaAllocator();
+
+    //! Destructor, the arena must have been released with cleanup()
+    virtual ~ArenaAllocator();
+
+    //! Take the arena from an allocator
+    //! \return true if the full arena could be allocated
+    bool setup(MemAllocator& allocator, //!< allocator providing the arena
+               const NATIVE_UINT_TYPE identifier, //!< identifier of the arena with the allocator
+               const NATIVE_UINT_TYPE size //!< size of the arena in bytes
+    );
+
+    //! Return the arena to the allocator it was taken from
+    void cleanup();
+
+    //! Allocate memory from the arena
+    //! \param identifier: identifier to use with allocation, unused
+    //! \param size: size of memory to be allocated, set to 0 when the arena cannot hold it
+    //! \param recoverable: (output) is this memory recoverable after a reset. Always false.
+    //! \return the memory, or nullptr when the arena cannot hold it
+    void* allocate(const NATIVE_UINT_TYPE identifier, NATIVE_UINT_TYPE& size, bool& recoverable);
+
+    //! Deallocation does nothing, memory is released by reset()
+    //! \param identifier: identifier used at allocation
+    //! \param ptr: pointer to memory being deallocated
+    void deallocate(const NATIVE_UINT_TYPE identifier, void* ptr);
+
+    //! Release all allocations at once. Memory handed out before must no longer be used.
+    void reset();
+
+    NATIVE_UINT_TYPE getCapacity() const;  //!< size of the arena in bytes
+    NATIVE_UINT_TYPE getUsed() const;  //!< bytes allocated since the last reset, including alignment padding
+    NATIVE_UINT_TYPE getHighWater() const;  //!< most bytes allocated between two resets since setup
+    NATIVE_UINT_TYPE getFailures() const;  //!< number of allocations the arena could not hold since setup
+
+  private:
+    MemAllocator* m_allocator;  //!< allocator the arena was taken from
+    NATIVE_UINT_TYPE m_identifier;  //!< identifier of the arena with the allocator
+    U8* m_arena;  //!< start of the arena
+    NATIVE_UINT_TYPE m_capacity;  //!< size of the arena
+    NATIVE_UINT_TYPE m_used;  //!< offset of the next allocation
+    NATIVE_UINT_TYPE m_highWater;  //!< largest offset reached
+    NATIVE_UINT_TYPE m_failures;  //!< failed allocations
+};
+
+} /* namespace Fw */
+
+#endif /* TYPES_ARENAALLOCATOR_HPP_ */
@@ -0,0 +1,152 @@
+/**
+ * \file
+ * \brief Implementation of the huge page allocator
+ *
+ * \copyright
+ * Copyright 2009-2024, by the California Institute of Technology.
+ * ALL RIGHTS RESERVED.  United States Government Sponsorship
+ * acknowledged.
+ *
+ */
+
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <Fw/Types/Assert.hpp>
+#include <Fw/Types/HugePageAllocator.hpp>
+
+#ifndef MPOL_BIND
+#define MPOL_BIND 2  // from linux/mempolicy.h, mbind is called directly to avoid a dependency on libnuma
+#endif
+
+namespace Fw {
+
+HugePageAllocator::HugePageAllocator(const I32 numaNode, const bool lock)
+    : m_numaNode(numaNode), m_lock(lock), m_hugeTlb(false) {
+    FW_ASSERT((numaNode == ANY_NODE) || ((numaNode >= 0) && (numaNode < static_cast<I32>(sizeof(unsigned long) * 8))),
+              numaNode);
+    for (NATIVE_UINT_TYPE i = 0; i < MAX_ALLOCATIONS; i++) {
+        this->m_allocations[i].addr = nullptr;
+        this->m_allocations[i].length = 0;
+    }
+}
+
+HugePageAllocator::~HugePageAllocator() {}
+
+void* HugePageAllocator::allocate(const NATIVE_UINT_TYPE identifier, NATIVE_UINT_TYPE& size, bool& recoverable) {
+    // huge page memory is never recoverable
+    recoverable = false;
+
+    NATIVE_UINT_TYPE slot = 0;
+    while ((slot < MAX_ALLOCATIONS) && (this->m_allocations[slot].addr != nullptr)) {
+        slot++;
+    }
+    if ((slot == MAX_ALLOCATIONS) || (size == 0) || (size > (static_cast<NATIVE_UINT_TYPE>(-1) - HUGE_PAGE_SIZE))) {
+        size = 0;
+        return nullptr;
+    }
+
+    const NATIVE_UINT_TYPE length = ((size + HUGE_PAGE_SIZE - 1) / HUGE_PAGE_SIZE) * HUGE_PAGE_SIZE;
+    void* addr = this->map(length);
+    if (addr == nullptr) {
+        size = 0;
+        return nullptr;
+    }
+    if (!this->prepare(addr, length)) {
+        int stat = munmap(addr, length);
+        FW_ASSERT(stat == 0, stat);
+        size = 0;
+        return nullptr;
+    }
+    this->m_allocations[slot].addr = addr;
+    this->m_allocations[slot].length = length;
+    return addr;
+}
+
+void HugePageAllocator::deallocate(const NATIVE_UINT_TYPE identifier, void* ptr) {
+    for (NATIVE_UINT_TYPE i = 0; i < MAX_ALLOCATIONS; i++) {
+        if ((ptr != nullptr) && (this->m_allocations[i].addr == ptr)) {
+            int stat = munmap(ptr, this->m_allocations[i].length);
+            FW_ASSERT(stat == 0, stat);
+            this->m_allocations[i].addr = nullptr;
+            this->m_allocations[i].length = 0;
+            return;
+        }
+    }
+}
+
+bool HugePageAllocator::isHugeTlb() const {
+    return this->m_hugeTlb;
+}
+
+void* HugePageAllocator::map(const NATIVE_UINT_TYPE length) {
+#ifdef MAP_HUGETLB
+    // Reserved huge pages are faulted in by the mapping itself, unless they must first be placed on a node
+    int flags = MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB;
+#ifdef MAP_POPULATE
+    if (this->m_numaNode == ANY_NODE) {
+        flags |= MAP_POPULATE;
+    }
+#endif
+    void* reserved = mmap(nullptr, length, PROT_READ | PROT_WRITE, flags, -1, 0);
+    if (reserved != MAP_FAILED) {
+        this->m_hugeTlb = true;
+        return reserved;
+    }
+#endif
+    this->m_hugeTlb = false;
+
+    // No reserved huge pages, map one extra huge page to align the memory such that it can use transparent huge pages
+    const NATIVE_UINT_TYPE padded = length + HUGE_PAGE_SIZE;
+    void* region = mmap(nullptr, padded, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (region == MAP_FAILED) {
+        return nullptr;
+    }
+    const POINTER_CAST start = reinterpret_cast<POINTER_CAST>(region);
+    const POINTER_CAST aligned = (start + HUGE_PAGE_SIZE - 1) & ~static_cast<POINTER_CAST>(HUGE_PAGE_SIZE - 1);
+    const NATIVE_UINT_TYPE head = static_cast<NATIVE_UINT_TYPE>(aligned - start);
+    const NATIVE_UINT_TYPE tail = padded - head - length;
+    if (head > 0) {
+        int stat = munmap(region, head);
+        FW_ASSERT(stat == 0, stat);
+    }
+    if (tail > 0) {
+        int stat = munmap(reinterpret_cast<void*>(aligned + length), tail);
+        FW_ASSERT(stat == 0, stat);
+    }
+    void* addr = reinterpret_cast<void*>(aligned);
+#ifdef MADV_HUGEPAGE
+    (void)madvise(addr, length, MADV_HUGEPAGE);
+#endif
+    return addr;
+}
+
+bool HugePageAllocator::prepare(void* addr, const NATIVE_UINT_TYPE length) {
+    // Placement applies to pages faulted in afterwards, so it is set before anything is touched
+    if (this->m_numaNode != ANY_NODE) {
+#ifdef SYS_mbind
+        const unsigned long nodeMask = 1UL << this->m_numaNode;
+        if (syscall(SYS_mbind, addr, length, MPOL_BIND, &nodeMask, sizeof(nodeMask) * 8, 0) != 0) {
+            return false;
+        }
+#else
+        return false;
+#endif
+    }
+    // Locking faults in every page
+    if (this->m_lock) {
+        return mlock(addr, length) == 0;
+    }
+    if (this->m_hugeTlb && (this->m_numaNode == ANY_NODE)) {
+        return true;  // faulted in by MAP_POPULATE
+    }
+    const long pageSize = sysconf(_SC_PAGESIZE);
+    const NATIVE_UINT_TYPE stride = (pageSize > 0) ? static_cast<NATIVE_UINT_TYPE>(pageSize) : 4096;
+    volatile U8* bytes = static_cast<volatile U8*>(addr);
+    for (NATIVE_UINT_TYPE offset = 0; offset < length; offset += stride) {
+        bytes[offset] = 0;
+    }
+    return true;
+}
+
+} /* namespace Fw */
@@ -0,0 +1,79 @@
+/**
+ * \file
+ * \brief A MemAllocator implementation class that backs memory with huge pages on Linux.
+ *
+ * \copyright
+ * Copyright 2009-2024, by the California Institute of Technology.
+ * ALL RIGHTS RESERVED.  United States Government Sponsorship
+ * acknowledged.
+ *
+ */
+
+#ifndef TYPES_HUGEPAGEALLOCATOR_HPP_
+#define TYPES_HUGEPAGEALLOCATOR_HPP_
+
+#include <Fw/Types/MemAllocator.hpp>
+
+namespace Fw {
+
+//! Fw::HugePageAllocator is an implementation of the Fw::MemAllocator interface for large buffer pools. Memory is
+//! mapped from the reserved huge pages of the system (MAP_HUGETLB) and, when none are reserved, from regular pages
+//! aligned to huge page boundaries and marked for transparent huge pages. Fewer, larger pages reduce the TLB misses
+//! of accesses spread over the pool.
+//!
+//! All pages are faulted in by allocate, so the pool does not take page faults when first used. Optionally the
+//! memory is placed on one NUMA node and locked such that it is never paged out.
+class HugePageAllocator : public MemAllocator {
+  public:
+    static const NATIVE_UINT_TYPE HUGE_PAGE_SIZE = 2 * 1024 * 1024;  //!< Size of a huge page, allocations are rounded up
+    static const NATIVE_UINT_TYPE MAX_ALLOCATIONS = 8;  //!< Number of allocations an allocator can hold at once
+    static const I32 ANY_NODE = -1;  //!< Place memory on the NUMA node of the thread first touching it
+
+    //! Constructor
+    //!
+    HugePageAllocator(const I32 numaNode = ANY_NODE, //!< NUMA node to place memory on, or ANY_NODE
+                      const bool lock = false //!< lock memory such that it is never paged out
+    );
+
+    //! Destructor
+    virtual ~HugePageAllocator();
+
+    //! Allocate memory backed by huge pages
+    //! \param identifier: identifier to use with allocation
+    //! \param size: size of memory to be allocated
+    //! \param recoverable: (output) is this memory recoverable after a reset. Always false.
+    void* allocate(const NATIVE_UINT_TYPE identifier, NATIVE_UINT_TYPE& size, bool& recoverable);
+
+    //! Deallocation of memory allocated by this allocator
+    //! \param identifier: identifier used at allocation
+    //! \param ptr: pointer to memory being deallocated
+    void deallocate(const NATIVE_UINT_TYPE identifier, void* ptr);
+
+    //! Whether the last allocation is mapped from reserved huge pages rather than transparent huge pages
+    bool isHugeTlb() const;
+
+  private:
+    //! Map memory from reserved huge pages, or from regular pages aligned to a huge page
+    //! \return the memory, or nullptr on failure
+    void* map(const NATIVE_UINT_TYPE length /*!< length to map, a multiple of HUGE_PAGE_SIZE */);
+
+    //! Place, lock and fault in mapped memory
+    //! \return true on success
+    bool prepare(void* addr, /*!< mapped memory */
+                 const NATIVE_UINT_TYPE length /*!< length of the memory */
+    );
+
+    struct Allocation {
+        void* addr;  //!< start of the mapping, nullptr when unused
+        NATIVE_UINT_TYPE length;  //!< length of the mapping
+    };
+
+    const I32 m_numaNode;  //!< NUMA node to place memory on
+    const bool m_lock;  //!< lock memory
+    bool m_hugeTlb;  //!< last allocation uses reserved huge pages
+    Allocation m_allocations[MAX_ALLOCATIONS];  //!< live allocations, for unmapping
+};
+
+} /* namespace Fw */
+
+#endif /* TYPES_HUGEPAGEALLOCATOR_HPP_ */
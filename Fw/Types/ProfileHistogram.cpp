@@ -0,0 +1,65 @@
+#include <Fw/Types/ProfileHistogram.hpp>
+#include <Fw/Types/Assert.hpp>
+
+namespace Fw {
+
+ProfileHistogram::ProfileHistogram() {
+    this->reset();
+}
+
+void ProfileHistogram::record(U32 usec) {
+    // Bucket index is the number of significant bits, limited to the last bucket
+    U32 index = 0;
+    for (U32 value = usec; (value != 0) && (index < (NUM_BUCKETS - 1)); value >>= 1) {
+        index++;
+    }
+    this->m_buckets[index]++;
+    this->m_count++;
+    this->m_total += usec;
+    if (usec > this->m_max) {
+        this->m_max = usec;
+    }
+}
+
+void ProfileHistogram::reset() {
+    this->m_count = 0;
+    this->m_total = 0;
+    this->m_max = 0;
+    for (U32 i = 0; i < NUM_BUCKETS; i++) {
+        this->m_buckets[i] = 0;
+    }
+}
+
+U32 ProfileHistogram::getCount() const {
+    return this->m_count;
+}
+
+U64 ProfileHistogram::getTotal() const {
+    return this->m_total;
+}
+
+U32 ProfileHistogram::getMax() const {
+    return this->m_max;
+}
+
+U32 ProfileHistogram::getBucket(U32 index) const {
+    FW_ASSERT(index < NUM_BUCKETS, index);
+    return this->m_buckets[index];
+}
+
+U32 ProfileHistogram::getPercentile(U32 percent) const {
+    FW_ASSERT(percent <= 100, percent);
+    // Number of durations at or below the percentile, rounded up such that any percentile above 0 covers a sample
+    const U64 target = (static_cast<U64>(this->m_count) * percent + 99) / 100;
+    U64 seen = 0;
+    for (U32 i = 0; i < NUM_BUCKETS; i++) {
+        seen += this->m_buckets[i];
+        if ((seen >= target) && (seen > 0)) {
+            const U32 upper = (i == 0) ? 0 : ((i < (NUM_BUCKETS - 1)) ? ((1U << i) - 1) : this->m_max);
+            return (upper < this->m_max) ? upper : this->m_max;
+        }
+    }
+    return 0;
+}
+
+}  // namespace Fw
@@ -0,0 +1,66 @@
+/**
+ * \file
+ * \brief Histogram of microsecond durations used to profile dispatch times
+ *
+ * \copyright
+ * Copyright 2009-2024, by the California Institute of Technology.
+ * ALL RIGHTS RESERVED.  United States Government Sponsorship
+ * acknowledged.
+ *
+ */
+
+#ifndef FW_PROFILE_HISTOGRAM_HPP
+#define FW_PROFILE_HISTOGRAM_HPP
+
+#include <FpConfig.hpp>
+
+namespace Fw {
+
+//! \class ProfileHistogram
+//! \brief Records durations into power-of-two microsecond buckets
+//!
+//! Bucket 0 counts durations of 0 microseconds and bucket i counts durations in [2^(i-1), 2^i) microseconds. The
+//! last bucket also counts every longer duration. Recording is constant time and allocation free. The histogram is
+//! written by a single thread, readers on other threads may observe a partially updated sample.
+class ProfileHistogram {
+  public:
+    static const U32 NUM_BUCKETS = 24;  //!< Last bucket starts at 2^22 microseconds (~4 seconds)
+
+    ProfileHistogram();  //!< Constructs an empty histogram
+
+    //! Record a duration
+    void record(U32 usec  //!< duration in microseconds
+    );
+
+    //! Remove all recorded durations
+    void reset();
+
+    //! \return number of recorded durations
+    U32 getCount() const;
+
+    //! \return sum of all recorded durations in microseconds
+    U64 getTotal() const;
+
+    //! \return longest recorded duration in microseconds
+    U32 getMax() const;
+
+    //! \return count of durations recorded in a bucket
+    U32 getBucket(U32 index  //!< bucket index, less than NUM_BUCKETS
+    ) const;
+
+    //! Get the upper bound of the bucket holding a percentile of the recorded durations. The result is limited to the
+    //! longest recorded duration and is 0 when nothing has been recorded.
+    //! \return duration in microseconds
+    U32 getPercentile(U32 percent  //!< percentile from 0 to 100
+    ) const;
+
+  private:
+    U32 m_count;                 //!< number of recorded durations
+    U64 m_total;                 //!< sum of recorded durations
+    U32 m_max;                   //!< longest recorded duration
+    U32 m_buckets[NUM_BUCKETS];  //!< duration counts per bucket
+};
+
+}  // namespace Fw
+
+#endif
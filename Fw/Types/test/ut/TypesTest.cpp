@@ -1,9 +1,14 @@
 #include <FpConfig.hpp>
+#include <Fw/Types/ArenaAllocator.hpp>
 #include <Fw/Types/Assert.hpp>
+#ifdef TGT_OS_TYPE_LINUX
+#include <Fw/Types/HugePageAllocator.hpp>
+#endif
 #include <Fw/Types/InternalInterfaceString.hpp>
 #include <Fw/Types/MallocAllocator.hpp>
 #include <Fw/Types/ObjectName.hpp>
 #include <Fw/Types/PolyType.hpp>
+#include <Fw/Types/ProfileHistogram.hpp>
 #include <Fw/Types/Serializable.hpp>
 #include <Fw/Types/String.hpp>
 #include <Os/InterruptLock.hpp>
@@ -1227,6 +1232,92 @@ TEST(AllocatorTest, MallocAllocatorTest) {
     allocator.deallocate(100, ptr);
 }
 
+TEST(AllocatorTest, ArenaAllocatorTest) {
+    Fw::MallocAllocator backing;
+    Fw::ArenaAllocator arena;
+    ASSERT_TRUE(arena.setup(backing, 0, 100));
+    ASSERT_EQ(100u, arena.getCapacity());
+
+    // Allocations are aligned and packed one after another
+    bool recoverable = true;
+    NATIVE_UINT_TYPE size = 3;
+    U8* first = static_cast<U8*>(arena.allocate(1, size, recoverable));
+    ASSERT_NE(first, nullptr);
+    ASSERT_EQ(3u, size);
+    ASSERT_FALSE(recoverable);
+    size = 16;
+    U8* second = static_cast<U8*>(arena.allocate(2, size, recoverable));
+    ASSERT_EQ(second, first + Fw::ArenaAllocator::ALIGNMENT);
+    ASSERT_EQ(24u, arena.getUsed());
+
+    // Requests the arena cannot hold fail whole
+    size = 80;
+    ASSERT_EQ(arena.allocate(3, size, recoverable), nullptr);
+    ASSERT_EQ(0u, size);
+    ASSERT_EQ(1u, arena.getFailures());
+    size = 76;
+    ASSERT_EQ(arena.allocate(4, size, recoverable), first + 24);
+    ASSERT_EQ(100u, arena.getUsed());
+
+    // Deallocation does nothing, reset releases everything and keeps the high water mark
+    arena.deallocate(1, first);
+    ASSERT_EQ(100u, arena.getUsed());
+    arena.reset();
+    ASSERT_EQ(0u, arena.getUsed());
+    ASSERT_EQ(100u, arena.getHighWater());
+    size = 10;
+    ASSERT_EQ(arena.allocate(5, size, recoverable), first);
+    ASSERT_EQ(100u, arena.getHighWater());
+    arena.cleanup();
+
+    // A new arena starts its statistics over
+    ASSERT_TRUE(arena.setup(backing, 0, 8));
+    size = 1;
+    ASSERT_NE(arena.allocate(6, size, recoverable), nullptr);
+    ASSERT_EQ(1u, arena.getHighWater());
+    arena.cleanup();
+}
+
+#ifdef TGT_OS_TYPE_LINUX
+TEST(AllocatorTest, HugePageAllocatorTest) {
+    // Works with or without reserved huge pages, falling back to transparent huge pages
+    Fw::HugePageAllocator allocator;
+    NATIVE_UINT_TYPE size = 3 * 1024 * 1024;
+    bool recoverable = true;
+    U8* first = static_cast<U8*>(allocator.allocate(10, size, recoverable));
+    ASSERT_NE(first, nullptr);
+    ASSERT_EQ(3u * 1024 * 1024, size);
+    ASSERT_FALSE(recoverable);
+    ASSERT_EQ(reinterpret_cast<POINTER_CAST>(first) % Fw::HugePageAllocator::HUGE_PAGE_SIZE, 0u);
+    first[0] = 1;
+    first[size - 1] = 2;
+
+    // Allocations are tracked individually
+    NATIVE_UINT_TYPE secondSize = 100;
+    U8* second = static_cast<U8*>(allocator.allocate(11, secondSize, recoverable));
+    ASSERT_NE(second, nullptr);
+    ASSERT_EQ(100u, secondSize);
+    second[99] = 3;
+    allocator.deallocate(10, first);
+    ASSERT_EQ(second[99], 3);
+    allocator.deallocate(11, second);
+
+    // Running out of slots fails the allocation
+    void* ptrs[Fw::HugePageAllocator::MAX_ALLOCATIONS];
+    for (NATIVE_UINT_TYPE i = 0; i < Fw::HugePageAllocator::MAX_ALLOCATIONS; i++) {
+        NATIVE_UINT_TYPE small = 1;
+        ptrs[i] = allocator.allocate(i, small, recoverable);
+        ASSERT_NE(ptrs[i], nullptr);
+    }
+    NATIVE_UINT_TYPE extra = 1;
+    ASSERT_EQ(allocator.allocate(99, extra, recoverable), nullptr);
+    ASSERT_EQ(0u, extra);
+    for (NATIVE_UINT_TYPE i = 0; i < Fw::HugePageAllocator::MAX_ALLOCATIONS; i++) {
+        allocator.deallocate(i, ptrs[i]);
+    }
+}
+#endif
+
 TEST(Nominal, string_copy) {
     const char* copy_string = "abc123\n";  // Length of 7
     char buffer_out_test[10];
@@ -1288,6 +1379,45 @@ TEST(OffNominal, string_len_zero) {
     ASSERT_EQ(Fw::StringUtils::string_length(test_string, 0), 0);
 }
 
+TEST(Nominal, ProfileHistogram) {
+    Fw::ProfileHistogram histogram;
+    ASSERT_EQ(histogram.getCount(), 0);
+    ASSERT_EQ(histogram.getPercentile(50), 0);
+
+    // Bucket 0 holds 0, bucket i holds [2^(i-1), 2^i)
+    histogram.record(0);
+    histogram.record(1);
+    histogram.record(2);
+    histogram.record(3);
+    histogram.record(1000);
+    ASSERT_EQ(histogram.getCount(), 5);
+    ASSERT_EQ(histogram.getTotal(), 1006);
+    ASSERT_EQ(histogram.getMax(), 1000);
+    ASSERT_EQ(histogram.getBucket(0), 1);
+    ASSERT_EQ(histogram.getBucket(1), 1);
+    ASSERT_EQ(histogram.getBucket(2), 2);
+    ASSERT_EQ(histogram.getBucket(10), 1);
+
+    // Percentiles report the bucket upper bound, limited to the longest duration
+    ASSERT_EQ(histogram.getPercentile(0), 0);
+    ASSERT_EQ(histogram.getPercentile(20), 0);
+    ASSERT_EQ(histogram.getPercentile(40), 1);
+    ASSERT_EQ(histogram.getPercentile(60), 3);
+    ASSERT_EQ(histogram.getPercentile(80), 3);
+    ASSERT_EQ(histogram.getPercentile(100), 1000);
+
+    // Long durations collect in the last bucket
+    histogram.record(0xFFFFFFFF);
+    ASSERT_EQ(histogram.getBucket(Fw::ProfileHistogram::NUM_BUCKETS - 1), 1);
+    ASSERT_EQ(histogram.getPercentile(100), 0xFFFFFFFF);
+
+    histogram.reset();
+    ASSERT_EQ(histogram.getCount(), 0);
+    ASSERT_EQ(histogram.getTotal(), 0);
+    ASSERT_EQ(histogram.getMax(), 0);
+    ASSERT_EQ(histogram.getBucket(2), 0);
+}
+
 int main(int argc, char** argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
@@ -27,6 +27,16 @@ SystemResources::SystemResourcesStatus SystemResources::getCpuTicks(CpuTicks& cp
     return SYSTEM_RESOURCES_OK;
 }
 
+SystemResources::SystemResourcesStatus SystemResources::getSnapshot(Snapshot& snapshot, bool threads) {
+    // Always 100 percent on a single CPU, no threads reported
+    snapshot.total.used = 1;
+    snapshot.total.total = 1;
+    snapshot.cpu[0] = snapshot.total;
+    snapshot.cpuCount = 1;
+    snapshot.threadCount = 0;
+    return SYSTEM_RESOURCES_OK;
+}
+
 
 SystemResources::SystemResourcesStatus SystemResources::getMemUtil(MemUtil& memory_util) {
     // Always 100 percent
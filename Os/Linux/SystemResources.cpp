@@ -10,14 +10,19 @@
 //
 // ======================================================================
 #include <cstdio>
+#include <cstdlib>
 #include <cstring>
+#include <dirent.h>
 #include <sys/sysinfo.h>
 #include <Os/SystemResources.hpp>
 #include <Fw/Types/Assert.hpp>
 
 constexpr char PROC_STAT_PATH[] = "/proc/stat";
+constexpr char PROC_TASK_PATH[] = "/proc/self/task";
 constexpr char READ_ONLY[] = "r";
 constexpr int LINE_SIZE = 256;
+constexpr int TASK_LINE_SIZE = 512;
+constexpr int TASK_PATH_SIZE = 64;
 char proc_stat_line[LINE_SIZE];
 
 namespace Os {
@@ -112,6 +117,103 @@ namespace Os {
         return SYSTEM_RESOURCES_OK;
     }
 
+    SystemResources::SystemResourcesStatus readThreadTicks(const char* task_id, SystemResources::ThreadTicks& thread) {
+        char path[TASK_PATH_SIZE];
+        char line[TASK_LINE_SIZE];
+        unsigned long user_ticks = 0;
+        unsigned long system_ticks = 0;
+
+        if (snprintf(path, sizeof(path), "%s/%s/stat", PROC_TASK_PATH, task_id) >= static_cast<int>(sizeof(path))) {
+            return SystemResources::SYSTEM_RESOURCES_ERROR;
+        }
+        // Threads may exit between listing and reading, which is reported as an error and skipped by the caller
+        FILE* fp = fopen(path, READ_ONLY);
+        if (fp == nullptr) {
+            return SystemResources::SYSTEM_RESOURCES_ERROR;
+        }
+        char* result = fgets(line, sizeof(line), fp);
+        fclose(fp);
+        if (result == nullptr) {
+            return SystemResources::SYSTEM_RESOURCES_ERROR;
+        }
+
+        // Format: tid (name) state ppid pgrp session tty_nr tpgid flags minflt cminflt majflt cmajflt utime stime ...
+        // The name may itself contain spaces and parentheses, so it is delimited by the first '(' and the last ')'
+        const char* name_start = strchr(line, '(');
+        const char* name_end = strrchr(line, ')');
+        if ((name_start == nullptr) || (name_end == nullptr) || (name_end < name_start)) {
+            return SystemResources::SYSTEM_RESOURCES_ERROR;
+        }
+        if (sscanf(name_end + 1, " %*c %*d %*d %*d %*d %*d %*u %*u %*u %*u %*u %lu %lu", &user_ticks,
+                   &system_ticks) != 2) {
+            return SystemResources::SYSTEM_RESOURCES_ERROR;
+        }
+        FwSizeType name_size = static_cast<FwSizeType>(name_end - name_start - 1);
+        name_size = (name_size < (sizeof(thread.name) - 1)) ? name_size : (sizeof(thread.name) - 1);
+        memcpy(thread.name, name_start + 1, name_size);
+        thread.name[name_size] = '\0';
+        thread.id = static_cast<U32>(strtoul(line, nullptr, 10));
+        thread.ticks = static_cast<FwSizeType>(user_ticks) + static_cast<FwSizeType>(system_ticks);
+        return SystemResources::SYSTEM_RESOURCES_OK;
+    }
+
+    SystemResources::SystemResourcesStatus getThreadTicks(SystemResources::Snapshot& snapshot) {
+        DIR* dir = opendir(PROC_TASK_PATH);
+        if (dir == nullptr) {
+            return SystemResources::SYSTEM_RESOURCES_ERROR;
+        }
+        struct dirent* entry = nullptr;
+        while ((snapshot.threadCount < SystemResourcesCfg::MAX_THREADS) && ((entry = readdir(dir)) != nullptr)) {
+            // Skip "." and ".."
+            if ((entry->d_name[0] < '0') || (entry->d_name[0] > '9')) {
+                continue;
+            }
+            if (readThreadTicks(entry->d_name, snapshot.threads[snapshot.threadCount]) ==
+                SystemResources::SYSTEM_RESOURCES_OK) {
+                snapshot.threadCount++;
+            }
+        }
+        closedir(dir);
+        return SystemResources::SYSTEM_RESOURCES_OK;
+    }
+
+    SystemResources::SystemResourcesStatus SystemResources::getSnapshot(Snapshot& snapshot, bool threads) {
+        char line[LINE_SIZE];
+        U32 cpu_data[4] = {0};
+        FILE* fp = nullptr;
+
+        snapshot.cpuCount = 0;
+        snapshot.threadCount = 0;
+        if (openProcStatFile(fp) != SYSTEM_RESOURCES_OK) {
+            return SYSTEM_RESOURCES_ERROR;
+        }
+        // First line is the aggregate of all CPUs, followed by one line per CPU in index order
+        if (readProcStatLine(fp, line) != SYSTEM_RESOURCES_OK || strncmp(line, "cpu ", 4) != 0 ||
+            parseCpuData(line, cpu_data) != SYSTEM_RESOURCES_OK) {
+            fclose(fp);
+            return SYSTEM_RESOURCES_ERROR;
+        }
+        snapshot.total.used = getCpuUsed(cpu_data);
+        snapshot.total.total = getCpuTotal(cpu_data);
+
+        while ((snapshot.cpuCount < SystemResourcesCfg::MAX_CPUS) &&
+               (readProcStatLine(fp, line) == SYSTEM_RESOURCES_OK) && (strncmp(line, "cpu", 3) == 0)) {
+            if (parseCpuData(line, cpu_data) != SYSTEM_RESOURCES_OK) {
+                fclose(fp);
+                return SYSTEM_RESOURCES_ERROR;
+            }
+            snapshot.cpu[snapshot.cpuCount].used = getCpuUsed(cpu_data);
+            snapshot.cpu[snapshot.cpuCount].total = getCpuTotal(cpu_data);
+            snapshot.cpuCount++;
+        }
+        fclose(fp);
+
+        if (threads) {
+            return getThreadTicks(snapshot);
+        }
+        return SYSTEM_RESOURCES_OK;
+    }
+
 
     U64 getMemoryTotal(FwSizeType total_ram, FwSizeType memory_unit) {
         return static_cast<U64>(total_ram)*static_cast<U64>(memory_unit);
@@ -118,6 +118,36 @@ SystemResources::SystemResourcesStatus SystemResources::getCpuTicks(CpuTicks& cp
     return (stat == KERN_SUCCESS) ? SYSTEM_RESOURCES_OK : SYSTEM_RESOURCES_ERROR;
 }
 
+SystemResources::SystemResourcesStatus SystemResources::getSnapshot(Snapshot& snapshot, bool threads) {
+    processor_cpu_load_info_t cpu_load_info;
+    U32 cpu_count = 0;
+
+    snapshot.total.used = 0;
+    snapshot.total.total = 0;
+    snapshot.cpuCount = 0;
+    // Per-thread ticks are not supported on macOS
+    snapshot.threadCount = 0;
+    if (KERN_SUCCESS != cpu_data_helper(cpu_load_info, cpu_count)) {
+        return SYSTEM_RESOURCES_ERROR;
+    }
+    // All CPUs are read in a single call, then summed into the aggregate
+    for (U32 i = 0; i < cpu_count; i++) {
+        FwSizeType total = 0;
+        for (U32 j = 0; j < CPU_STATE_MAX; j++) {
+            total += cpu_load_info[i].cpu_ticks[j];
+        }
+        const FwSizeType used = total - cpu_load_info[i].cpu_ticks[CPU_STATE_IDLE];
+        snapshot.total.used += used;
+        snapshot.total.total += total;
+        if (i < SystemResourcesCfg::MAX_CPUS) {
+            snapshot.cpu[i].used = used;
+            snapshot.cpu[i].total = total;
+            snapshot.cpuCount++;
+        }
+    }
+    return SYSTEM_RESOURCES_OK;
+}
+
 
 SystemResources::SystemResourcesStatus SystemResources::getMemUtil(MemUtil& memory_util) {
     // Call out VM helper
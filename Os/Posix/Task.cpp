@@ -10,6 +10,7 @@
 #include <sched.h>
 #include <climits>
 #include <Fw/Logger/Logger.hpp>
+#include <Fw/Types/StringUtils.hpp>
 
 #ifdef TGT_OS_TYPE_LINUX 
 #include <features.h>
@@ -220,6 +221,13 @@ namespace Os {
             return status;
         }
         FW_ASSERT(tid != nullptr);
+#if TGT_OS_TYPE_LINUX && __GLIBC__
+        // Name the thread after the task such that per-thread resource usage can be attributed. Linux limits thread
+        // names to 15 characters, so longer names are truncated.
+        char thread_name[16];
+        (void) Fw::StringUtils::string_copy(thread_name, name.toChar(), sizeof(thread_name));
+        (void) pthread_setname_np(*tid, thread_name);
+#endif
 
         // Handle a successfully created task
         this->m_handle = reinterpret_cast<POINTER_CAST>(tid);
@@ -16,11 +16,35 @@
 #include <Fw/Obj/ObjBase.hpp>
 #include <Fw/Types/Serializable.hpp>
 #include <Os/QueueString.hpp>
+#if FW_PROFILING == 1
+#include <Os/IntervalTimer.hpp>
+#include <Os/Mutex.hpp>
+#endif
 
 namespace Os {
     // forward declaration for registry
     class QueueRegistry;
 
+#if FW_PROFILING == 1
+    //! Send times of the messages on a queue, in send order. Used to measure the time messages wait on the queue when
+    //! sent and received as serialized buffers. Exact for messages of equal priority, approximate otherwise.
+    class QueueStamps {
+        public:
+            QueueStamps();
+            ~QueueStamps();
+            bool setup(NATIVE_INT_TYPE depth); //!< allocate room for depth stamps, returns false on failure
+            bool push(); //!< stamp a message about to be sent, returns false when no stamp was stored
+            void unpush(); //!< remove the latest stamp when its message was not sent
+            bool pop(IntervalTimer::RawTime& stamp); //!< take the oldest stamp, returns false when there is none
+        private:
+            Mutex m_lock; //!< stamps are pushed by senders and popped by the receiver
+            IntervalTimer::RawTime* m_stamps; //!< stamp storage
+            U32 m_depth; //!< number of stamps that fit in storage
+            U32 m_head; //!< index of the oldest stamp
+            U32 m_count; //!< number of stored stamps
+    };
+#endif
+
     class Queue {
         public:
 
@@ -63,6 +87,10 @@ namespace Os {
 #if FW_QUEUE_REGISTRATION
             static void setQueueRegistry(QueueRegistry* reg); // !< set the queue registry
 #endif
+#if FW_PROFILING == 1
+            U32 getLastWaitUsec() const; //!< get the time the last serialized message received waited on the queue
+            const IntervalTimer::RawTime& getLastReceiveTime() const; //!< get the time the last serialized message was received
+#endif
 
         protected:
             //! Internal method used for creating allowing alternate implementations to implement different creation
@@ -78,6 +106,11 @@ namespace Os {
             static QueueRegistry* s_queueRegistry; //!< pointer to registry
 #endif
             static NATIVE_INT_TYPE s_numQueues; //!< tracks number of queues in the system
+#if FW_PROFILING == 1
+            QueueStamps m_stamps; //!< send times of queued serialized messages
+            U32 m_lastWaitUsec = 0; //!< time the last serialized message received waited on the queue
+            IntervalTimer::RawTime m_lastReceiveTime = {0, 0}; //!< time the last serialized message was received
+#endif
 
         private:
             Queue(Queue&); //!<  Disabled copy constructor
@@ -1,6 +1,7 @@
 #include <Os/Queue.hpp>
 #include <Fw/Types/Assert.hpp>
 #include <cstring>
+#include <new>
 
 namespace Os {
 
@@ -15,7 +16,17 @@ namespace Os {
         const U8* msgBuff = buffer.getBuffAddr();
         NATIVE_INT_TYPE buffLength = buffer.getBuffLength();
 
+#if FW_PROFILING == 1
+        // Stamp before sending such that the receiver never sees a message without its stamp
+        const bool stamped = this->m_stamps.push();
+        Queue::QueueStatus sendStat = this->send(msgBuff,buffLength,priority, block);
+        if (stamped && (QUEUE_OK != sendStat)) {
+            this->m_stamps.unpush();
+        }
+        return sendStat;
+#else
         return this->send(msgBuff,buffLength,priority, block);
+#endif
 
     }
 
@@ -27,6 +38,14 @@ namespace Os {
 
         Queue::QueueStatus recvStat = this->receive(msgBuff, buffCapacity, recvSize, priority, block);
 
+#if FW_PROFILING == 1
+        if (QUEUE_OK == recvStat) {
+            IntervalTimer::RawTime sendTime;
+            IntervalTimer::getRawTime(this->m_lastReceiveTime);
+            this->m_lastWaitUsec = this->m_stamps.pop(sendTime) ?
+                IntervalTimer::getDiffUsec(this->m_lastReceiveTime, sendTime) : 0;
+        }
+#endif
         if (QUEUE_OK == recvStat) {
             if (buffer.setBuffLen(recvSize) == Fw::FW_SERIALIZE_OK) {
                 return QUEUE_OK;
@@ -41,7 +60,16 @@ namespace Os {
     Queue::QueueStatus Queue::create(const Fw::StringBase &name, NATIVE_INT_TYPE depth, NATIVE_INT_TYPE msgSize) {
         FW_ASSERT(depth > 0, depth);
         FW_ASSERT(msgSize > 0, depth);
+#if FW_PROFILING == 1
+        Queue::QueueStatus createStat = createInternal(name, depth, msgSize);
+        // Profiling is best-effort, messages are not stamped if room for the stamps cannot be allocated
+        if (QUEUE_OK == createStat) {
+            (void) this->m_stamps.setup(depth);
+        }
+        return createStat;
+#else
         return createInternal(name, depth, msgSize);
+#endif
     }
 
 
@@ -62,4 +90,69 @@ namespace Os {
         return this->m_name;
     }
 
+#if FW_PROFILING == 1
+
+    U32 Queue::getLastWaitUsec() const {
+        return this->m_lastWaitUsec;
+    }
+
+    const IntervalTimer::RawTime& Queue::getLastReceiveTime() const {
+        return this->m_lastReceiveTime;
+    }
+
+    QueueStamps::QueueStamps() : m_stamps(nullptr), m_depth(0), m_head(0), m_count(0) {
+    }
+
+    QueueStamps::~QueueStamps() {
+        delete[] this->m_stamps;
+    }
+
+    bool QueueStamps::setup(NATIVE_INT_TYPE depth) {
+        FW_ASSERT(depth > 0, depth);
+        this->m_lock.lock();
+        delete[] this->m_stamps;
+        this->m_stamps = new(std::nothrow) IntervalTimer::RawTime[depth];
+        this->m_depth = (this->m_stamps == nullptr) ? 0 : static_cast<U32>(depth);
+        this->m_head = 0;
+        this->m_count = 0;
+        this->m_lock.unLock();
+        return (this->m_stamps != nullptr);
+    }
+
+    bool QueueStamps::push() {
+        bool stored = false;
+        this->m_lock.lock();
+        // Senders blocked on a full queue may outnumber the slots, their messages go unstamped. Pairing recovers once
+        // the stamps run out before the messages do.
+        if (this->m_count < this->m_depth) {
+            IntervalTimer::getRawTime(this->m_stamps[(this->m_head + this->m_count) % this->m_depth]);
+            this->m_count++;
+            stored = true;
+        }
+        this->m_lock.unLock();
+        return stored;
+    }
+
+    void QueueStamps::unpush() {
+        this->m_lock.lock();
+        FW_ASSERT(this->m_count > 0);
+        this->m_count--;
+        this->m_lock.unLock();
+    }
+
+    bool QueueStamps::pop(IntervalTimer::RawTime& stamp) {
+        bool popped = false;
+        this->m_lock.lock();
+        if (this->m_count > 0) {
+            stamp = this->m_stamps[this->m_head];
+            this->m_head = (this->m_head + 1) % this->m_depth;
+            this->m_count--;
+            popped = true;
+        }
+        this->m_lock.unLock();
+        return popped;
+    }
+
+#endif
+
 }
@@ -13,6 +13,7 @@
 #define _SystemResources_hpp_
 
 #include <FpConfig.hpp>
+#include <SystemResourcesCfg.hpp>
 
 namespace Os {
 namespace SystemResources {
@@ -32,6 +33,20 @@ struct MemUtil {
     FwSizeType total;  //!< Filled with total non-volatile memory
 };
 
+struct ThreadTicks {
+    U32 id;                                           //!< Operating system identifier of the thread
+    char name[SystemResourcesCfg::THREAD_NAME_SIZE];  //!< Null-terminated thread name
+    FwSizeType ticks;                                 //!< Filled with CPU ticks used by the thread (system, user)
+};
+
+struct Snapshot {
+    CpuTicks total;                                        //!< Ticks summed across all CPUs
+    U32 cpuCount;                                          //!< Number of valid entries in cpu
+    CpuTicks cpu[SystemResourcesCfg::MAX_CPUS];            //!< Per-CPU ticks
+    U32 threadCount;                                       //!< Number of valid entries in threads
+    ThreadTicks threads[SystemResourcesCfg::MAX_THREADS];  //!< Per-thread ticks of this process
+};
+
 /**
  * \brief Request the count of the CPUs detected by the system
  *
@@ -60,6 +75,19 @@ SystemResourcesStatus getCpuTicks(CpuTicks& ticks, U32 cpu_index = 0);
  * \return:  SYSTEM_RESOURCES_ERROR when error occurs, SYSTEM_RESOURCES_OK otherwise.
  */
 SystemResourcesStatus getMemUtil(MemUtil& memory_util);
+
+/**
+ * \brief Get the CPU tick information for every CPU in a single pass
+ *
+ * Reads the aggregate and per-CPU ticks with a single read of the system's CPU statistics, and optionally the ticks
+ * used by each thread of this process. As with getCpuTicks, these are running accumulations and the caller shall
+ * difference sample-to-sample. CPUs and threads beyond the snapshot capacity are not reported individually.
+ *
+ * \param snapshot: (output) filled with the tick information
+ * \param threads: read per-thread ticks when true, otherwise threadCount is set to zero
+ * \return:  SYSTEM_RESOURCES_ERROR when error occurs, SYSTEM_RESOURCES_OK otherwise.
+ */
+SystemResourcesStatus getSnapshot(Snapshot& snapshot, bool threads = false);
 }  // namespace SystemResources
 }  // namespace Os
 
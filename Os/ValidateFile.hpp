@@ -13,7 +13,13 @@
 #ifndef _ValidateFile_hpp_
 #define _ValidateFile_hpp_
 
-#define VFILE_HASH_CHUNK_SIZE (256)
+#ifndef VFILE_HASH_CHUNK_SIZE
+#define VFILE_HASH_CHUNK_SIZE (256) //!< Size of the stack buffer files are read through when they cannot be mapped
+#endif
+
+#ifndef VFILE_HASH_MAP_SIZE
+#define VFILE_HASH_MAP_SIZE (8 * 1024 * 1024) //!< Size of the windows files are mapped in, a multiple of the page size
+#endif
 
 #include <Utils/Hash/HashBuffer.hpp>
 
@@ -58,6 +64,10 @@ namespace Os {
         Status createValidation(const char* fileName, const char* hashFileName);   //!< Create a validation of the file 'fileName' and store it in
                                                                                              //!< in a file 'hashFileName'
 
+        // for writers that hash data as they write it, avoiding a re-read of the file
+        Status createValidationFromHash(const char* hashFileName, const Utils::HashBuffer &hashBuffer); //!< Store a hash
+                                                                                                        //!< computed by the caller in a file 'hashFileName'
+
     }
 }
 
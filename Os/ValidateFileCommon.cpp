@@ -3,12 +3,67 @@
 #include <Utils/Hash/Hash.hpp>
 #include <Os/FileSystem.hpp>
 
+#if defined(TGT_OS_TYPE_LINUX) || defined(TGT_OS_TYPE_DARWIN)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 namespace Os {
 
+#if defined(TGT_OS_TYPE_LINUX) || defined(TGT_OS_TYPE_DARWIN)
+    // Hash a file by mapping it in windows rather than copying it through a buffer, with read-ahead hinted as the
+    // file is read sequentially. Returns false when the file cannot be mapped, leaving the caller to read it.
+    bool computeMappedHash(const char* fileName, Utils::HashBuffer &hashBuffer) {
+        const int fd = ::open(fileName, O_RDONLY);
+        if (fd < 0) {
+            return false;
+        }
+        struct stat fileStat;
+        if ((::fstat(fd, &fileStat) != 0) || !S_ISREG(fileStat.st_mode)) {
+            (void) ::close(fd);
+            return false;
+        }
+#ifdef POSIX_FADV_SEQUENTIAL
+        (void) ::posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
+
+        Utils::Hash hash;
+        hash.init();
+        bool mapped = true;
+        const off_t fileSize = fileStat.st_size;
+        for (off_t offset = 0; offset < fileSize; offset += VFILE_HASH_MAP_SIZE) {
+            const off_t remaining = fileSize - offset;
+            const size_t length = static_cast<size_t>((remaining < VFILE_HASH_MAP_SIZE) ? remaining : VFILE_HASH_MAP_SIZE);
+            void* window = ::mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, offset);
+            if (window == MAP_FAILED) {
+                mapped = false;
+                break;
+            }
+            (void) ::madvise(window, length, MADV_SEQUENTIAL);
+            hash.update(window, static_cast<NATIVE_INT_TYPE>(length));
+            (void) ::munmap(window, length);
+        }
+        (void) ::close(fd);
+
+        if (mapped) {
+            hash.final(hashBuffer);
+        }
+        return mapped;
+    }
+#endif
+
     File::Status computeHash(const char* fileName, Utils::HashBuffer &hashBuffer) {
 
         File::Status status;
 
+#if defined(TGT_OS_TYPE_LINUX) || defined(TGT_OS_TYPE_DARWIN)
+        if (computeMappedHash(fileName, hashBuffer)) {
+            return File::OP_OK;
+        }
+#endif
+
         // Open file:
         File file;
         status = file.open(fileName, File::OPEN_READ);
@@ -226,4 +281,14 @@ namespace Os {
         return createValidation(fileName, hashFileName, hashBuffer);
     }
 
+    ValidateFile::Status ValidateFile::createValidationFromHash(const char* hashFileName, const Utils::HashBuffer &hashBuffer) {
+
+        File::Status status = writeHash(hashFileName, hashBuffer);
+        if( File::OP_OK != status ) {
+            return translateStatus(status, HashFileType);
+        }
+
+        return ValidateFile::VALIDATION_OK;
+    }
+
 }
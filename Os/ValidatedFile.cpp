@@ -48,6 +48,18 @@ namespace Os {
     return status;
   }
 
+  Os::ValidateFile::Status ValidatedFile ::
+    createHashFile(const Utils::HashBuffer& hashBuffer)
+  {
+    this->m_hashBuffer = hashBuffer;
+    const Os::ValidateFile::Status status =
+      Os::ValidateFile::createValidationFromHash(
+         this->m_hashFileName.toChar(),
+         this->m_hashBuffer
+      );
+    return status;
+  }
+
   const Fw::StringBase& ValidatedFile ::
     getFileName() const
   {
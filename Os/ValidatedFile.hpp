@@ -39,6 +39,12 @@ namespace Os {
       //! \return Status
       Os::ValidateFile::Status createHashFile();
 
+      //! Create the hash file from a hash of the file computed by the caller, without reading the file
+      //! \return Status
+      Os::ValidateFile::Status createHashFile(
+          const Utils::HashBuffer& hashBuffer //!< The hash of the file
+      );
+
     public:
 
       //! Get the file name
@@ -21,6 +21,22 @@ void testTestSystemResources() {
     cpuIndex = 1000;
     sys_res_status = Os::SystemResources::getCpuTicks(cpuUtil, cpuIndex);
     ASSERT_EQ(sys_res_status, Os::SystemResources::SystemResourcesStatus::SYSTEM_RESOURCES_ERROR);
+
+    // Snapshot reports the same CPUs in a single call
+    Os::SystemResources::Snapshot snapshot;
+    sys_res_status = Os::SystemResources::getSnapshot(snapshot, true);
+    ASSERT_EQ(sys_res_status, Os::SystemResources::SystemResourcesStatus::SYSTEM_RESOURCES_OK);
+    ASSERT_EQ(snapshot.cpuCount, (cpuCount < Os::SystemResourcesCfg::MAX_CPUS) ? cpuCount : Os::SystemResourcesCfg::MAX_CPUS);
+    ASSERT_LE(snapshot.total.used, snapshot.total.total);
+    for (U32 i = 0; i < snapshot.cpuCount; i++) {
+        ASSERT_LE(snapshot.cpu[i].used, snapshot.cpu[i].total);
+        ASSERT_LE(snapshot.cpu[i].total, snapshot.total.total);
+    }
+    ASSERT_LE(snapshot.threadCount, Os::SystemResourcesCfg::MAX_THREADS);
+
+    sys_res_status = Os::SystemResources::getSnapshot(snapshot, false);
+    ASSERT_EQ(sys_res_status, Os::SystemResources::SystemResourcesStatus::SYSTEM_RESOURCES_OK);
+    ASSERT_EQ(snapshot.threadCount, 0u);
 }
 
 extern "C" {
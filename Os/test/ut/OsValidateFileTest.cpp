@@ -14,6 +14,7 @@ void testValidateFile(const char* fileName) {
     const char nonexistentFileName[] = "thisfiledoesnotexist";
     const char hashFileName[] = "hashed.hashed";
     const char hardtoaccessHashFileName[] = "thisdirdoesnotexist/hashed.hashed";
+    const char storedHashFileName[] = "stored.hashed";
     
     // Create a hash file:
     printf("Creating hash for file %s in %s\n", fileName, hashFileName);
@@ -79,6 +80,25 @@ void testValidateFile(const char* fileName) {
         return;
     }
 
+    // Store a hash computed elsewhere and validate against it:
+    printf("Storing hash of file %s in %s\n", fileName, storedHashFileName);
+    Utils::HashBuffer fileHash;
+    validateStatus = Os::ValidateFile::validate(fileName, hashFileName, fileHash);
+    EXPECT_EQ(Os::ValidateFile::VALIDATION_OK, validateStatus);
+    validateStatus = Os::ValidateFile::createValidationFromHash(storedHashFileName, fileHash);
+    if ( Os::ValidateFile::VALIDATION_OK != validateStatus ) {
+        printf("\tFailed to store hash in hash file %s.\n", storedHashFileName);
+        printf("\tReturn status: %d\n", validateStatus);
+        EXPECT_TRUE(0);
+        return;
+    }
+    validateStatus = Os::ValidateFile::validate(fileName, storedHashFileName);
+    EXPECT_EQ(Os::ValidateFile::VALIDATION_OK, validateStatus);
+    validateStatus = Os::ValidateFile::createValidationFromHash(hardtoaccessHashFileName, fileHash);
+    EXPECT_EQ(Os::ValidateFile::VALIDATION_FILE_DOESNT_EXIST, validateStatus);
+    fsStatus = Os::FileSystem::removeFile(storedHashFileName);
+    EXPECT_EQ(Os::FileSystem::OP_OK, fsStatus);
+
     // Remove hash file:
     printf("Removing hash file %s\n", hashFileName);
     fsStatus = Os::FileSystem::removeFile(hashFileName);
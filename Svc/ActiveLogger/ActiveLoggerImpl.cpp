@@ -17,7 +17,12 @@ namespace Svc {
     typedef ActiveLogger_FilterSeverity FilterSeverity;
 
     ActiveLoggerImpl::ActiveLoggerImpl(const char* name) : 
-        ActiveLoggerComponentBase(name)
+        ActiveLoggerComponentBase(name),
+        m_batchCount(0),
+        m_batchAge(0),
+        m_batchLatency(0),
+        m_numFilteredIDs(0),
+        m_throttleLimit(ACTIVE_LOGGER_THROTTLE_LIMIT_DEFAULT)
     {
         // set filter defaults
         this->m_filterState[FilterSeverity::WARNING_HI].enabled =
@@ -35,6 +40,11 @@ namespace Svc {
 
         memset(m_filteredIDs,0,sizeof(m_filteredIDs));
 
+        for (NATIVE_UINT_TYPE slot = 0; slot < ACTIVE_LOGGER_THROTTLE_SLOTS; slot++) {
+            this->m_throttleState[slot].id = 0;
+            this->m_throttleState[slot].suppressed = 0;
+        }
+
     }
 
     ActiveLoggerImpl::~ActiveLoggerImpl() {
@@ -47,6 +57,10 @@ namespace Svc {
         ActiveLoggerComponentBase::init(queueDepth,instance);
     }
 
+    void ActiveLoggerImpl::configureBatching(U32 latencyTicks) {
+        this->m_batchLatency = latencyTicks;
+    }
+
     void ActiveLoggerImpl::LogRecv_handler(NATIVE_INT_TYPE portNum, FwEventIdType id, Fw::Time &timeTag, const Fw::LogSeverity& severity, Fw::LogBuffer &args) {
 
         // make sure ID is not zero. Zero is reserved for ID filter.
@@ -90,12 +104,19 @@ namespace Svc {
                 return;
         }
 
-        // check ID filters
-        for (NATIVE_INT_TYPE entry = 0; entry < TELEM_ID_FILTER_SIZE; entry++) {
-            if (
-              (m_filteredIDs[entry] == id) &&
-              (severity != Fw::LogSeverity::FATAL)
-              ) {
+        // check ID filters and rate limits. FATAL events always pass.
+        if (severity != Fw::LogSeverity::FATAL) {
+            FwEventIdType reportId = 0;
+            U32 suppressed = 0;
+            this->m_filterLock.lock();
+            const bool pass = (0 != id) && (this->findFilteredId(id) == -1) &&
+                ((0 == this->m_throttleLimit) || this->throttle(id,timeTag,reportId,suppressed));
+            this->m_filterLock.unLock();
+            // report suppressed events once the lock is released, as the report is logged
+            if (suppressed > 0) {
+                this->log_WARNING_LO_ID_THROTTLED(reportId,suppressed);
+            }
+            if (!pass) {
                 return;
             }
         }
@@ -113,6 +134,18 @@ namespace Svc {
 
     void ActiveLoggerImpl::loqQueue_internalInterfaceHandler(FwEventIdType id, const Fw::Time &timeTag, const Fw::LogSeverity& severity, const Fw::LogBuffer &args) {
 
+        if (this->m_batchLatency > 0) {
+            if (this->batchEvent(id,timeTag,args)) {
+                // FATAL events are not delayed
+                if (Fw::LogSeverity::FATAL == severity.e) {
+                    this->sendBatch();
+                }
+                return;
+            }
+            // keep the order of events when one too large for a batch is sent on its own
+            this->sendBatch();
+        }
+
         // Serialize event
         this->m_logPacket.setId(id);
         this->m_logPacket.setTimeTag(timeTag);
@@ -126,6 +159,53 @@ namespace Svc {
         }
     }
 
+    bool ActiveLoggerImpl::batchEvent(FwEventIdType id, const Fw::Time &timeTag, const Fw::LogBuffer &args) {
+        // Each record holds the ID, time tag and arguments with their length
+        const Fw::Serializable::SizeType recordSize = sizeof(FwEventIdType) + Fw::Time::SERIALIZED_SIZE +
+            sizeof(FwSizeStoreType) + args.getBuffLength();
+        if ((this->m_batchCount > 0) &&
+            (recordSize > this->m_batchBuffer.getBuffCapacity() - this->m_batchBuffer.getBuffLength())) {
+            this->sendBatch();
+        }
+        if (0 == this->m_batchCount) {
+            this->m_batchBuffer.resetSer();
+            Fw::SerializeStatus stat = this->m_batchBuffer.serialize(
+                static_cast<FwPacketDescriptorType>(Fw::ComPacket::FW_PACKET_LOG_BATCH));
+            FW_ASSERT(Fw::FW_SERIALIZE_OK == stat,static_cast<NATIVE_INT_TYPE>(stat));
+        }
+        if (recordSize > this->m_batchBuffer.getBuffCapacity() - this->m_batchBuffer.getBuffLength()) {
+            return false;
+        }
+
+        Fw::SerializeStatus stat = this->m_batchBuffer.serialize(id);
+        FW_ASSERT(Fw::FW_SERIALIZE_OK == stat,static_cast<NATIVE_INT_TYPE>(stat));
+        stat = this->m_batchBuffer.serialize(timeTag);
+        FW_ASSERT(Fw::FW_SERIALIZE_OK == stat,static_cast<NATIVE_INT_TYPE>(stat));
+        stat = this->m_batchBuffer.serialize(args.getBuffAddr(),args.getBuffLength(),false);
+        FW_ASSERT(Fw::FW_SERIALIZE_OK == stat,static_cast<NATIVE_INT_TYPE>(stat));
+        this->m_batchCount++;
+        return true;
+    }
+
+    void ActiveLoggerImpl::sendBatch() {
+        if (this->m_batchCount > 0) {
+            if (this->isConnected_PktSend_OutputPort(0)) {
+                this->PktSend_out(0, this->m_batchBuffer,0);
+            }
+            this->m_batchCount = 0;
+            this->m_batchAge = 0;
+        }
+    }
+
+    void ActiveLoggerImpl::schedIn_handler(const NATIVE_INT_TYPE portNum, U32 context) {
+        if (this->m_batchCount > 0) {
+            this->m_batchAge++;
+            if (this->m_batchAge >= this->m_batchLatency) {
+                this->sendBatch();
+            }
+        }
+    }
+
     void ActiveLoggerImpl::SET_EVENT_FILTER_cmdHandler(FwOpcodeType opCode, U32 cmdSeq, FilterSeverity filterLevel, Enabled filterEnable) {
         this->m_filterState[filterLevel.e].enabled = filterEnable;
         this->cmdResponse_out(opCode,cmdSeq,Fw::CmdResponse::OK);
@@ -138,40 +218,66 @@ namespace Svc {
             Enabled idEnabled //!< ID filter state
         ) {
 
+        // ID 0 is reserved for the logger and never logged, so it is always considered filtered
         if (Enabled::ENABLED == idEnabled.e) { // add ID
-            // search list for existing entry
-            for (NATIVE_INT_TYPE entry = 0; entry < TELEM_ID_FILTER_SIZE; entry++) {
-                if (this->m_filteredIDs[entry] == ID) {
-                    this->cmdResponse_out(opCode,cmdSeq,Fw::CmdResponse::OK);
-                    this->log_ACTIVITY_HI_ID_FILTER_ENABLED(ID);
-                    return;
+            this->m_filterLock.lock();
+            // search for existing entry
+            bool added = (0 == ID) || (this->findFilteredId(ID) != -1);
+            // if not already a match, add it at the end of its probe sequence
+            if (!added && (this->m_numFilteredIDs < TELEM_ID_FILTER_SIZE)) {
+                NATIVE_UINT_TYPE slot = hashId(ID) % ID_FILTER_INDEX_SIZE;
+                while (this->m_filteredIDs[slot] != 0) {
+                    slot = (slot + 1) % ID_FILTER_INDEX_SIZE;
                 }
+                this->m_filteredIDs[slot] = ID;
+                this->m_numFilteredIDs++;
+                added = true;
             }
-            // if not already a match, search for an open slot
-            for (NATIVE_INT_TYPE entry = 0; entry < TELEM_ID_FILTER_SIZE; entry++) {
-                if (this->m_filteredIDs[entry] == 0) {
-                    this->m_filteredIDs[entry] = ID;
-                    this->cmdResponse_out(opCode,cmdSeq,Fw::CmdResponse::OK);
-                    this->log_ACTIVITY_HI_ID_FILTER_ENABLED(ID);
-                    return;
-                }
+            this->m_filterLock.unLock();
+            if (added) {
+                this->cmdResponse_out(opCode,cmdSeq,Fw::CmdResponse::OK);
+                this->log_ACTIVITY_HI_ID_FILTER_ENABLED(ID);
+            } else {
+                // if the filter is full, send an error event
+                this->log_WARNING_LO_ID_FILTER_LIST_FULL(ID);
+                this->cmdResponse_out(opCode,cmdSeq,Fw::CmdResponse::EXECUTION_ERROR);
             }
-            // if an empty slot was not found, send an error event
-            this->log_WARNING_LO_ID_FILTER_LIST_FULL(ID);
-            this->cmdResponse_out(opCode,cmdSeq,Fw::CmdResponse::EXECUTION_ERROR);
         } else { // remove ID
-            // search list for existing entry
-            for (NATIVE_INT_TYPE entry = 0; entry < TELEM_ID_FILTER_SIZE; entry++) {
-                if (this->m_filteredIDs[entry] == ID) {
-                    this->m_filteredIDs[entry] = 0; // zero entry
-                    this->cmdResponse_out(opCode,cmdSeq,Fw::CmdResponse::OK);
-                    this->log_ACTIVITY_HI_ID_FILTER_REMOVED(ID);
-                    return;
+            this->m_filterLock.lock();
+            // search for existing entry
+            NATIVE_INT_TYPE entry = (0 == ID) ? -1 : this->findFilteredId(ID);
+            const bool removed = (0 == ID) || (entry != -1);
+            if (entry != -1) {
+                // Empty the slot, then move back later IDs of the probe sequence that can no longer be reached
+                NATIVE_UINT_TYPE hole = static_cast<NATIVE_UINT_TYPE>(entry);
+                NATIVE_UINT_TYPE slot = hole;
+                this->m_filteredIDs[hole] = 0;
+                this->m_numFilteredIDs--;
+                while (true) {
+                    slot = (slot + 1) % ID_FILTER_INDEX_SIZE;
+                    if (this->m_filteredIDs[slot] == 0) {
+                        break;
+                    }
+                    // the ID stays if its home slot lies cyclically after the hole, up to its slot
+                    const NATIVE_UINT_TYPE home = hashId(this->m_filteredIDs[slot]) % ID_FILTER_INDEX_SIZE;
+                    const bool reachable = (hole <= slot) ? ((hole < home) && (home <= slot))
+                                                          : ((hole < home) || (home <= slot));
+                    if (!reachable) {
+                        this->m_filteredIDs[hole] = this->m_filteredIDs[slot];
+                        this->m_filteredIDs[slot] = 0;
+                        hole = slot;
+                    }
                 }
             }
-            // if it gets here, wasn't found
-            this->log_WARNING_LO_ID_FILTER_NOT_FOUND(ID);
-            this->cmdResponse_out(opCode,cmdSeq,Fw::CmdResponse::EXECUTION_ERROR);
+            this->m_filterLock.unLock();
+            if (removed) {
+                this->cmdResponse_out(opCode,cmdSeq,Fw::CmdResponse::OK);
+                this->log_ACTIVITY_HI_ID_FILTER_REMOVED(ID);
+            } else {
+                // if it gets here, wasn't found
+                this->log_WARNING_LO_ID_FILTER_NOT_FOUND(ID);
+                this->cmdResponse_out(opCode,cmdSeq,Fw::CmdResponse::EXECUTION_ERROR);
+            }
         }
 
     }
@@ -190,16 +296,127 @@ namespace Svc {
            );
         }
 
-        // iterate through ID filter
-        for (NATIVE_INT_TYPE entry = 0; entry < TELEM_ID_FILTER_SIZE; entry++) {
-            if (this->m_filteredIDs[entry] != 0) {
-                this->log_ACTIVITY_HI_ID_FILTER_ENABLED(this->m_filteredIDs[entry]);
+        // iterate through ID filter. The lock is released while logging, since logged events come back to LogRecv.
+        for (NATIVE_UINT_TYPE entry = 0; entry < ID_FILTER_INDEX_SIZE; entry++) {
+            this->m_filterLock.lock();
+            const FwEventIdType id = this->m_filteredIDs[entry];
+            this->m_filterLock.unLock();
+            if (id != 0) {
+                this->log_ACTIVITY_HI_ID_FILTER_ENABLED(id);
+            }
+        }
+
+        // report the rate limit and the events it suppressed that were not reported yet
+        if (this->m_throttleLimit > 0) {
+            this->log_ACTIVITY_HI_ID_THROTTLE_SET(this->m_throttleLimit);
+            for (NATIVE_UINT_TYPE slot = 0; slot < ACTIVE_LOGGER_THROTTLE_SLOTS; slot++) {
+                this->m_filterLock.lock();
+                const FwEventIdType id = this->m_throttleState[slot].id;
+                const U32 suppressed = this->m_throttleState[slot].suppressed;
+                this->m_throttleState[slot].suppressed = 0;
+                this->m_filterLock.unLock();
+                if ((id != 0) && (suppressed > 0)) {
+                    this->log_WARNING_LO_ID_THROTTLED(id,suppressed);
+                }
             }
         }
 
         this->cmdResponse_out(opCode,cmdSeq,Fw::CmdResponse::OK);
     }
 
+    void ActiveLoggerImpl::SET_ID_THROTTLE_cmdHandler(
+            FwOpcodeType opCode, //!< The opcode
+            U32 cmdSeq, //!< The command sequence number
+            U32 limit //!< Events each ID may pass per throttle interval
+        ) {
+        // start over with all IDs unlimited, such that buckets use the new limit
+        this->m_filterLock.lock();
+        this->m_throttleLimit = limit;
+        for (NATIVE_UINT_TYPE slot = 0; slot < ACTIVE_LOGGER_THROTTLE_SLOTS; slot++) {
+            this->m_throttleState[slot].id = 0;
+            this->m_throttleState[slot].suppressed = 0;
+        }
+        this->m_filterLock.unLock();
+        this->log_ACTIVITY_HI_ID_THROTTLE_SET(limit);
+        this->cmdResponse_out(opCode,cmdSeq,Fw::CmdResponse::OK);
+    }
+
+    U32 ActiveLoggerImpl::hashId(FwEventIdType id) {
+        // Event IDs are component base IDs plus small offsets, so mix the bits before reducing to a slot
+        const U32 hash = static_cast<U32>(id) * 2654435761U;
+        return hash ^ (hash >> 16);
+    }
+
+    NATIVE_INT_TYPE ActiveLoggerImpl::findFilteredId(FwEventIdType id) const {
+        NATIVE_UINT_TYPE slot = hashId(id) % ID_FILTER_INDEX_SIZE;
+        // The table is never full, so probing always ends at an empty slot
+        while (this->m_filteredIDs[slot] != 0) {
+            if (this->m_filteredIDs[slot] == id) {
+                return static_cast<NATIVE_INT_TYPE>(slot);
+            }
+            slot = (slot + 1) % ID_FILTER_INDEX_SIZE;
+        }
+        return -1;
+    }
+
+    bool ActiveLoggerImpl::throttle(FwEventIdType id, const Fw::Time& timeTag, FwEventIdType& reportId, U32& suppressed) {
+        const NATIVE_UINT_TYPE first = hashId(id) % ACTIVE_LOGGER_THROTTLE_SLOTS;
+        t_throttleState* available = nullptr;
+
+        reportId = 0;
+        suppressed = 0;
+        for (NATIVE_UINT_TYPE probe = 0; probe < ACTIVE_LOGGER_THROTTLE_PROBES; probe++) {
+            t_throttleState& state = this->m_throttleState[(first + probe) % ACTIVE_LOGGER_THROTTLE_SLOTS];
+            // times of different bases or contexts cannot be compared, so the slot's times are only valid in its own
+            const bool sameBase = (state.lastTime.getTimeBase() == timeTag.getTimeBase()) &&
+                                  (state.lastTime.getContext() == timeTag.getContext());
+            if (state.id == id) {
+                // a change of time base restarts the limit, full, in the new base
+                if (!sameBase) {
+                    state.bucket = Utils::TokenBucket(ACTIVE_LOGGER_THROTTLE_INTERVAL, this->m_throttleLimit,
+                                                      this->m_throttleLimit, this->m_throttleLimit, timeTag);
+                }
+                state.lastTime = timeTag;
+                if (!state.bucket.trigger(timeTag)) {
+                    state.suppressed++;
+                    return false;
+                }
+                // events suppressed since the last that passed are reported with this one
+                reportId = id;
+                suppressed = state.suppressed;
+                state.suppressed = 0;
+                return true;
+            }
+            if ((nullptr == available) && (0 == state.id)) {
+                available = &state;
+            } else if ((nullptr == available) && !sameBase) {
+                available = &state;
+            } else if (nullptr == available) {
+                // A slot is idle once its ID was quiet for an interval, or was last seen in another time base. The
+                // interval takes the time base and context of the slot, as times can only be added within one.
+                const Fw::Time interval(state.lastTime.getTimeBase(), state.lastTime.getContext(),
+                                        ACTIVE_LOGGER_THROTTLE_INTERVAL / 1000000,
+                                        ACTIVE_LOGGER_THROTTLE_INTERVAL % 1000000);
+                if (Fw::Time::add(state.lastTime,interval) <= timeTag) {
+                    available = &state;
+                }
+            }
+        }
+
+        // an ID that finds no slot is not limited until one becomes idle
+        if (available != nullptr) {
+            // events the previous ID of the slot suppressed are reported as it is evicted
+            reportId = available->id;
+            suppressed = available->suppressed;
+            available->id = id;
+            available->bucket = Utils::TokenBucket(ACTIVE_LOGGER_THROTTLE_INTERVAL, this->m_throttleLimit,
+                                                   this->m_throttleLimit, this->m_throttleLimit - 1, timeTag);
+            available->lastTime = timeTag;
+            available->suppressed = 0;
+        }
+        return true;
+    }
+
     void ActiveLoggerImpl::pingIn_handler(
           const NATIVE_INT_TYPE portNum,
           U32 key
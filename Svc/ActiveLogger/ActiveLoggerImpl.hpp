@@ -10,6 +10,8 @@
 
 #include <Svc/ActiveLogger/ActiveLoggerComponentAc.hpp>
 #include <Fw/Log/LogPacket.hpp>
+#include <Os/Mutex.hpp>
+#include <Utils/TokenBucket.hpp>
 #include <ActiveLoggerImplCfg.hpp>
 
 namespace Svc {
@@ -22,6 +24,13 @@ namespace Svc {
                     NATIVE_INT_TYPE queueDepth, /*!< The queue depth*/
                     NATIVE_INT_TYPE instance /*!< The instance number*/
                     ); //!< initialization function
+
+            //! Configure batching of events. Events are packed into one packet of type
+            //! Fw::ComPacket::FW_PACKET_LOG_BATCH until it is full or its latency expires.
+            //! Call before the component thread is started.
+            void configureBatching(
+                    U32 latencyTicks //!< schedIn calls an event may wait in a batch. 0 sends each event on its own
+                    );
         PROTECTED:
         PRIVATE:
             void LogRecv_handler(NATIVE_INT_TYPE portNum, FwEventIdType id, Fw::Time &timeTag, const Fw::LogSeverity& severity, Fw::LogBuffer &args);
@@ -45,6 +54,19 @@ namespace Svc {
                     U32 cmdSeq //!< The command sequence number
                 );
 
+            void SET_ID_THROTTLE_cmdHandler(
+                    FwOpcodeType opCode, //!< The opcode
+                    U32 cmdSeq, //!< The command sequence number
+                    U32 limit //!< Events each ID may pass per throttle interval
+                );
+
+            //! Handler implementation for schedIn
+            //!
+            void schedIn_handler(
+                const NATIVE_INT_TYPE portNum, /*!< The port number*/
+                U32 context /*!< The call order*/
+            );
+
             //! Handler implementation for pingIn
             //!
             void pingIn_handler(
@@ -61,9 +83,56 @@ namespace Svc {
             Fw::LogPacket m_logPacket; //!< packet buffer for assembling log packets
             Fw::ComBuffer m_comBuffer; //!< com buffer for sending event buffers
 
-            // array of filtered event IDs.
+            //! Add an event to the batch, sending the batch first if the event does not fit
+            //! \return true if the event was added, false if it is too large for a batch
+            bool batchEvent(FwEventIdType id, const Fw::Time &timeTag, const Fw::LogBuffer &args);
+
+            //! Send the batch if it holds events
+            void sendBatch();
+
+            // Batch state
+            Fw::ComBuffer m_batchBuffer; //!< com buffer events are packed into
+            U32 m_batchCount; //!< events in the batch
+            U32 m_batchAge; //!< schedIn calls since the first event of the batch
+            U32 m_batchLatency; //!< schedIn calls after which a batch is sent, 0 if events are not batched
+
+            //! Hash an event ID such that IDs of one component spread over the tables
+            static U32 hashId(FwEventIdType id);
+
+            //! Find a filtered event ID. Called with m_filterLock held.
+            //! \return the slot holding the ID, or -1 if the ID is not filtered
+            NATIVE_INT_TYPE findFilteredId(FwEventIdType id) const;
+
+            //! Rate limit an event of an ID. Called with m_filterLock held.
+            //! \return true if the event passes
+            bool throttle(
+                    FwEventIdType id, //!< The event ID
+                    const Fw::Time& timeTag, //!< The time of the event
+                    FwEventIdType& reportId, //!< ID of suppressed events to be reported
+                    U32& suppressed //!< Number of suppressed events to be reported, 0 if none
+                );
+
+            enum {
+                ID_FILTER_INDEX_SIZE = 2 * TELEM_ID_FILTER_SIZE //!< twice the filter size such that probe sequences stay short
+            };
+
+            // Open-addressed hash set of filtered event IDs, with linear probing.
             // value of 0 means no entry
-            FwEventIdType m_filteredIDs[TELEM_ID_FILTER_SIZE];
+            FwEventIdType m_filteredIDs[ID_FILTER_INDEX_SIZE];
+            NATIVE_INT_TYPE m_numFilteredIDs; //!< number of filtered event IDs
+
+            // Rate limit state of the event IDs seen recently. An ID is searched for in a window of
+            // ACTIVE_LOGGER_THROTTLE_PROBES slots from its hash, and takes over an unused or idle slot.
+            struct t_throttleState {
+                FwEventIdType id; //!< ID limited in the slot, 0 if unused
+                Utils::TokenBucket bucket; //!< events the ID may still pass
+                Fw::Time lastTime; //!< time of the last event of the ID
+                U32 suppressed; //!< events suppressed and not yet reported
+            } m_throttleState[ACTIVE_LOGGER_THROTTLE_SLOTS];
+            U32 m_throttleLimit; //!< events each ID may pass per interval, 0 if not limited
+
+            // Protects the ID filter and rate limits, which are checked on the threads of the components logging
+            Os::Mutex m_filterLock;
 
     };
 
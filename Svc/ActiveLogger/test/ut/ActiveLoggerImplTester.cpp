@@ -377,6 +377,10 @@ namespace Svc {
                 );
         ASSERT_EVENTS_SIZE(0);
 
+        // ID 0 is reserved for the logger and always filtered
+        this->sendEvent(0,Fw::Time(TB_NONE,1,0),Fw::LogSeverity::WARNING_HI);
+        ASSERT_EQ(0u,this->dispatchEvents(0));
+
     }
 
     void ActiveLoggerImplTester::runFilterDump() {
@@ -534,6 +538,202 @@ namespace Svc {
 
     }
 
+    void ActiveLoggerImplTester::runThrottle() {
+        U32 cmdSeq = 21;
+        const Fw::Time firstInterval(TB_NONE,1,0);
+        const Fw::Time secondInterval(TB_NONE,2,0);
+
+        // limit each ID to three events per interval
+        this->clearHistory();
+        this->clearEvents();
+        this->sendCmd_SET_ID_THROTTLE(0,cmdSeq,3);
+        this->m_impl.doDispatch();
+        ASSERT_CMD_RESPONSE_SIZE(1);
+        ASSERT_CMD_RESPONSE(
+                0,
+                ActiveLoggerImpl::OPCODE_SET_ID_THROTTLE,
+                cmdSeq,
+                Fw::CmdResponse::OK
+                );
+        ASSERT_EVENTS_SIZE(1);
+        ASSERT_EVENTS_ID_THROTTLE_SET_SIZE(1);
+        ASSERT_EVENTS_ID_THROTTLE_SET(0,3);
+
+        // the first three events of an interval pass, the next are suppressed before they are queued
+        this->clearEvents();
+        for (NATIVE_UINT_TYPE event = 0; event < 5; event++) {
+            this->sendEvent(7,firstInterval,Fw::LogSeverity::WARNING_HI);
+        }
+        ASSERT_EQ(3u,this->dispatchEvents(7));
+        ASSERT_EVENTS_SIZE(0);
+
+        // other IDs and FATAL events are not limited by the ID
+        this->sendEvent(8,firstInterval,Fw::LogSeverity::WARNING_HI);
+        ASSERT_EQ(1u,this->dispatchEvents(8));
+        this->sendEvent(7,firstInterval,Fw::LogSeverity::FATAL);
+        ASSERT_EQ(1u,this->dispatchEvents(7));
+
+        // the next interval passes events again and reports the suppressed ones
+        this->sendEvent(7,secondInterval,Fw::LogSeverity::WARNING_HI);
+        ASSERT_EQ(1u,this->dispatchEvents(7));
+        ASSERT_EVENTS_SIZE(1);
+        ASSERT_EVENTS_ID_THROTTLED_SIZE(1);
+        ASSERT_EVENTS_ID_THROTTLED(0,7,2);
+
+        // suppressed events not followed by one passing are reported by the filter dump
+        for (NATIVE_UINT_TYPE event = 0; event < 3; event++) {
+            this->sendEvent(7,secondInterval,Fw::LogSeverity::WARNING_HI);
+        }
+        ASSERT_EQ(2u,this->dispatchEvents(7));
+        this->clearHistory();
+        this->clearEvents();
+        this->sendCmd_DUMP_FILTER_STATE(0,cmdSeq);
+        this->m_impl.doDispatch();
+        ASSERT_CMD_RESPONSE_SIZE(1);
+        ASSERT_EVENTS_SIZE(FilterSeverity::NUM_CONSTANTS+2);
+        ASSERT_EVENTS_ID_THROTTLE_SET_SIZE(1);
+        ASSERT_EVENTS_ID_THROTTLE_SET(0,3);
+        ASSERT_EVENTS_ID_THROTTLED_SIZE(1);
+        ASSERT_EVENTS_ID_THROTTLED(0,7,1);
+
+        // a change of time base restarts the limit of the ID, full, in the new base
+        const Fw::Time otherBase(TB_PROC_TIME,0,0);
+        for (NATIVE_UINT_TYPE event = 0; event < 4; event++) {
+            this->sendEvent(7,otherBase,Fw::LogSeverity::WARNING_HI);
+        }
+        ASSERT_EQ(3u,this->dispatchEvents(7));
+
+        // as does a change of time context
+        const Fw::Time otherContext(TB_PROC_TIME,1,0,0);
+        for (NATIVE_UINT_TYPE event = 0; event < 3; event++) {
+            this->sendEvent(7,otherContext,Fw::LogSeverity::WARNING_HI);
+        }
+        ASSERT_EQ(3u,this->dispatchEvents(7));
+
+        // a limit of zero disables rate limiting
+        this->clearHistory();
+        this->clearEvents();
+        this->sendCmd_SET_ID_THROTTLE(0,cmdSeq,0);
+        this->m_impl.doDispatch();
+        ASSERT_CMD_RESPONSE(
+                0,
+                ActiveLoggerImpl::OPCODE_SET_ID_THROTTLE,
+                cmdSeq,
+                Fw::CmdResponse::OK
+                );
+        for (NATIVE_UINT_TYPE event = 0; event < 5; event++) {
+            this->sendEvent(7,secondInterval,Fw::LogSeverity::WARNING_HI);
+        }
+        ASSERT_EQ(5u,this->dispatchEvents(7));
+    }
+
+    void ActiveLoggerImplTester::runBatching() {
+
+        const Fw::Time timeTag(TB_NONE,1,2);
+        // records of sendEvent: ID, time tag, argument length and a U32 argument
+        const NATIVE_UINT_TYPE recordSize = sizeof(FwEventIdType) + Fw::Time::SERIALIZED_SIZE +
+            sizeof(FwSizeStoreType) + sizeof(U32);
+        const NATIVE_UINT_TYPE perBatch = (FW_COM_BUFFER_MAX_SIZE - sizeof(FwPacketDescriptorType)) / recordSize;
+        ASSERT_GT(perBatch,1u);
+
+        this->m_impl.configureBatching(2);
+
+        // events wait in the batch until the latency expires
+        this->m_receivedPacket = false;
+        for (NATIVE_UINT_TYPE event = 0; event < perBatch - 1; event++) {
+            this->sendEvent(static_cast<FwEventIdType>(10 + event),timeTag,Fw::LogSeverity::WARNING_HI);
+            this->m_impl.doDispatch();
+        }
+        this->invoke_to_schedIn(0,0);
+        this->m_impl.doDispatch();
+        ASSERT_FALSE(this->m_receivedPacket);
+        this->invoke_to_schedIn(0,0);
+        this->m_impl.doDispatch();
+        ASSERT_TRUE(this->m_receivedPacket);
+
+        // check the packet holds the events in order
+        FwPacketDescriptorType desc;
+        ASSERT_EQ(Fw::FW_SERIALIZE_OK,this->m_sentPacket.deserialize(desc));
+        ASSERT_EQ(static_cast<FwPacketDescriptorType>(Fw::ComPacket::FW_PACKET_LOG_BATCH),desc);
+        for (NATIVE_UINT_TYPE event = 0; event < perBatch - 1; event++) {
+            FwEventIdType id;
+            Fw::Time sentTime;
+            U8 args[sizeof(U32)];
+            NATIVE_UINT_TYPE size = sizeof(args);
+            ASSERT_EQ(Fw::FW_SERIALIZE_OK,this->m_sentPacket.deserialize(id));
+            ASSERT_EQ(static_cast<FwEventIdType>(10 + event),id);
+            ASSERT_EQ(Fw::FW_SERIALIZE_OK,this->m_sentPacket.deserialize(sentTime));
+            ASSERT_EQ(timeTag,sentTime);
+            ASSERT_EQ(Fw::FW_SERIALIZE_OK,this->m_sentPacket.deserialize(args,size,false));
+            ASSERT_EQ(sizeof(U32),size);
+        }
+        ASSERT_EQ(0u,this->m_sentPacket.getBuffLeft());
+
+        // a full batch is sent as the next event arrives, which starts a new batch
+        this->m_receivedPacket = false;
+        for (NATIVE_UINT_TYPE event = 0; event < perBatch; event++) {
+            this->sendEvent(10,timeTag,Fw::LogSeverity::WARNING_HI);
+            this->m_impl.doDispatch();
+        }
+        ASSERT_FALSE(this->m_receivedPacket);
+        this->sendEvent(11,timeTag,Fw::LogSeverity::WARNING_HI);
+        this->m_impl.doDispatch();
+        ASSERT_TRUE(this->m_receivedPacket);
+        ASSERT_EQ(sizeof(FwPacketDescriptorType) + perBatch * recordSize,this->m_sentPacket.getBuffLength());
+
+        // FATAL events send the batch at once
+        this->m_receivedPacket = false;
+        this->sendEvent(12,timeTag,Fw::LogSeverity::FATAL);
+        this->m_impl.doDispatch();
+        ASSERT_TRUE(this->m_receivedPacket);
+        ASSERT_EQ(sizeof(FwPacketDescriptorType) + 2 * recordSize,this->m_sentPacket.getBuffLength());
+
+        // nothing is sent while the batch is empty
+        this->m_receivedPacket = false;
+        for (NATIVE_UINT_TYPE tick = 0; tick < 3; tick++) {
+            this->invoke_to_schedIn(0,0);
+            this->m_impl.doDispatch();
+        }
+        ASSERT_FALSE(this->m_receivedPacket);
+
+        // without batching each event is sent on its own
+        this->m_impl.configureBatching(0);
+        this->sendEvent(13,timeTag,Fw::LogSeverity::WARNING_HI);
+        this->m_impl.doDispatch();
+        ASSERT_TRUE(this->m_receivedPacket);
+        ASSERT_EQ(Fw::FW_SERIALIZE_OK,this->m_sentPacket.deserialize(desc));
+        ASSERT_EQ(static_cast<FwPacketDescriptorType>(Fw::ComPacket::FW_PACKET_LOG),desc);
+    }
+
+    void ActiveLoggerImplTester::sendEvent(FwEventIdType id, const Fw::Time& timeTag, Fw::LogSeverity severity) {
+        Fw::LogBuffer buff;
+        Fw::SerializeStatus stat = buff.serialize(static_cast<U32>(10));
+        ASSERT_EQ(Fw::FW_SERIALIZE_OK,stat);
+        Fw::Time eventTime(timeTag);
+        this->invoke_to_LogRecv(0,id,eventTime,severity,buff);
+    }
+
+    NATIVE_UINT_TYPE ActiveLoggerImplTester::dispatchEvents(FwEventIdType id) {
+        // A FATAL marker is never filtered, so dispatching up to it empties the queue without blocking
+        static const FwEventIdType MARKER_ID = 0xFFFF;
+        this->sendEvent(MARKER_ID,Fw::Time(TB_NONE,0,0),Fw::LogSeverity::FATAL);
+
+        NATIVE_UINT_TYPE count = 0;
+        FwEventIdType sentId = 0;
+        do {
+            this->m_receivedPacket = false;
+            this->m_impl.doDispatch();
+            EXPECT_TRUE(this->m_receivedPacket);
+            FwPacketDescriptorType desc;
+            EXPECT_EQ(Fw::FW_SERIALIZE_OK,this->m_sentPacket.deserialize(desc));
+            EXPECT_EQ(Fw::FW_SERIALIZE_OK,this->m_sentPacket.deserialize(sentId));
+            if (sentId == id) {
+                count++;
+            }
+        } while (sentId != MARKER_ID);
+        return count;
+    }
+
     void ActiveLoggerImplTester::writeEvent(FwEventIdType id, Fw::LogSeverity severity, U32 value) {
         Fw::LogBuffer buff;
 
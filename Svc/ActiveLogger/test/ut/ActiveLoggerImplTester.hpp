@@ -27,6 +27,8 @@ namespace Svc {
             void runFilterDump();
             void runFilterInvalidCommands();
             void runEventFatal();
+            void runThrottle();
+            void runBatching();
             void runFileDump();
             void runFileDumpErrors();
 
@@ -53,6 +55,8 @@ namespace Svc {
             void runWithFilters(Fw::LogSeverity filter);
 
             void writeEvent(FwEventIdType id, Fw::LogSeverity severity, U32 value);
+            void sendEvent(FwEventIdType id, const Fw::Time& timeTag, Fw::LogSeverity severity);
+            NATIVE_UINT_TYPE dispatchEvents(FwEventIdType id); //!< dispatch queued events, returning those of an ID
             void readEvent(FwEventIdType id, Fw::LogSeverity severity, U32 value, Os::File& file);
 
             // open call modifiers
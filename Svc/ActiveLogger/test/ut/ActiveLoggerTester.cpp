@@ -23,6 +23,7 @@ void connectPorts(Svc::ActiveLoggerImpl& impl, Svc::ActiveLoggerImplTester& test
     impl.set_FatalAnnounce_OutputPort(0,tester.get_from_FatalAnnounce(0));
 
     tester.connect_to_LogRecv(0,impl.get_LogRecv_InputPort(0));
+    tester.connect_to_schedIn(0,impl.get_schedIn_InputPort(0));
 
     impl.set_Log_OutputPort(0,tester.get_from_Log(0));
     impl.set_LogText_OutputPort(0,tester.get_from_LogText(0));
@@ -150,6 +151,44 @@ TEST(ActiveLoggerTest,FatalTesting) {
 
 }
 
+TEST(ActiveLoggerTest,ThrottleTest) {
+
+    TEST_CASE(100.1.4,"Event ID rate limiting");
+
+    Svc::ActiveLoggerImpl impl("ActiveLoggerImpl");
+
+    impl.init(10,0);
+
+    Svc::ActiveLoggerImplTester tester(impl);
+
+    tester.init();
+
+    // connect ports
+    connectPorts(impl,tester);
+
+    tester.runThrottle();
+
+}
+
+TEST(ActiveLoggerTest,BatchTest) {
+
+    TEST_CASE(100.1.5,"Event batching");
+
+    Svc::ActiveLoggerImpl impl("ActiveLoggerImpl");
+
+    impl.init(10,0);
+
+    Svc::ActiveLoggerImplTester tester(impl);
+
+    tester.init();
+
+    // connect ports
+    connectPorts(impl,tester);
+
+    tester.runBatching();
+
+}
+
 int main(int argc, char* argv[]) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
@@ -108,16 +108,23 @@ namespace Svc {
         }
 
         // Call internal interface so that everything else is done on component thread,
-        // this helps ensure consistent ordering of the printed text:
+        // this helps ensure consistent ordering of the printed text. FATAL events write
+        // out the log file immediately, since the system may not be around much longer:
         Fw::InternalInterfaceString intText(textStr);
-        this->TextQueue_internalInterfaceInvoke(intText);
+        this->TextQueue_internalInterfaceInvoke(intText, Fw::LogSeverity::FATAL == severity.e);
+    }
+
+    void ActiveTextLogger::schedIn_handler(NATIVE_INT_TYPE portNum, U32 context)
+    {
+        // Write out any text gathered since the last call:
+        (void) this->m_log_file.flush();  // Ignoring return status
     }
 
     // ----------------------------------------------------------------------
     // Internal interface handlers
     // ----------------------------------------------------------------------
 
-    void ActiveTextLogger::TextQueue_internalInterfaceHandler(const Fw::InternalInterfaceString& text)
+    void ActiveTextLogger::TextQueue_internalInterfaceHandler(const Fw::InternalInterfaceString& text, bool flushLog)
     {
 
         // Print to console:
@@ -126,6 +133,10 @@ namespace Svc {
         // Print to file if there is one:
         (void) this->m_log_file.write_to_log(text.toChar(), text.length());  // Ignoring return status
 
+        if (flushLog) {
+            (void) this->m_log_file.flush();  // Ignoring return status
+        }
+
     }
 
     // ----------------------------------------------------------------------
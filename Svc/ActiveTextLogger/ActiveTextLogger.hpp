@@ -99,6 +99,13 @@ namespace Svc {
             Fw::TextLogString &text /*!< Text of log message*/
         );
 
+        //! Handler for input port schedIn
+        //
+        virtual void schedIn_handler(
+            NATIVE_INT_TYPE portNum, /*!< The port number*/
+            U32 context /*!< The call order*/
+        );
+
         // ----------------------------------------------------------------------
         // Internal interface handlers
         // ----------------------------------------------------------------------
@@ -106,7 +113,8 @@ namespace Svc {
         //! Internal Interface handler for TextQueue
         //!
         virtual void TextQueue_internalInterfaceHandler(
-            const Fw::InternalInterfaceString& text /*!< The text string*/
+            const Fw::InternalInterfaceString& text, /*!< The text string*/
+            bool flushLog /*!< Write out the log file after this text*/
         );
 
         // ----------------------------------------------------------------------
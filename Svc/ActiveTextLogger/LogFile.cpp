@@ -20,17 +20,16 @@ namespace Svc {
     // ----------------------------------------------------------------------
 
     LogFile::LogFile() :
-        m_fileName(), m_file(), m_maxFileSize(0), m_openFile(false), m_currentFileSize(0)
+        m_fileName(), m_file(), m_maxFileSize(0), m_openFile(false), m_currentFileSize(0),
+        m_bufferSize(0)
     {
 
     }
 
     LogFile::~LogFile()
     {
-        // Close the file if needed:
-        if (this->m_openFile) {
-            this->m_file.close();
-        }
+        // Write out pending text and close the file if needed:
+        this->close_log();
     }
 
     // ----------------------------------------------------------------------
@@ -55,38 +54,76 @@ namespace Svc {
                 (this->m_currentFileSize > (std::numeric_limits<U32>::max() - size)) ) {
 
                 status = false;
-                this->m_openFile = false;
-                this->m_file.close();
+                this->close_log();
             }
-            // Won't exceed max size, so write to file:
+            // Won't exceed max size, so add to the buffer:
             else {
 
-                FwSignedSizeType writeSize = size;
-                Os::File::Status stat = this->m_file.write(reinterpret_cast<const U8*>(buf),writeSize,Os::File::WAIT);
+                // Make room for the new text by writing out what is pending:
+                if (this->m_bufferSize + size > ACTIVE_TEXT_LOGGER_BUFFER_SIZE) {
+                    status = this->flush();
+                }
+
+                // Text too large to ever buffer goes directly to the file:
+                if (size >= ACTIVE_TEXT_LOGGER_BUFFER_SIZE) {
+                    status = this->write_to_file(buf, size) && status;
+                }
+                else {
+                    (void) memcpy(&this->m_buffer[this->m_bufferSize], buf, size);
+                    this->m_bufferSize += size;
+                }
+
+                this->m_currentFileSize += size;
+            }
+        }
 
-                // Assert that we are not trying to write to a file we never opened:
-                FW_ASSERT(stat != Os::File::NOT_OPENED);
+        return status;
+    }
 
-                // Only return a good status if the write was valid
-                status = (writeSize > 0);
+    bool LogFile::flush()
+    {
+        bool status = true;
 
-                this->m_currentFileSize += writeSize;
-            }
+        if (this->m_openFile && this->m_bufferSize > 0) {
+            status = this->write_to_file(this->m_buffer, this->m_bufferSize);
         }
 
+        // Pending text is dropped on failure, as it would be on an unbuffered write:
+        this->m_bufferSize = 0;
+
         return status;
     }
 
-
-    bool LogFile::set_log_file(const char* fileName, const U32 maxSize, const U32 maxBackups)
+    bool LogFile::write_to_file(const char *const buf, const U32 size)
     {
-        FW_ASSERT(fileName != nullptr);
+        FW_ASSERT(buf != nullptr);
 
-        // If there is already a previously open file then close it:
+        FwSignedSizeType writeSize = size;
+        Os::File::Status stat = this->m_file.write(reinterpret_cast<const U8*>(buf),writeSize,Os::File::WAIT);
+
+        // Assert that we are not trying to write to a file we never opened:
+        FW_ASSERT(stat != Os::File::NOT_OPENED);
+
+        // Only return a good status if the whole write was valid
+        return (stat == Os::File::OP_OK) && (writeSize == static_cast<FwSignedSizeType>(size));
+    }
+
+    void LogFile::close_log()
+    {
         if (this->m_openFile) {
+            (void) this->flush();
             this->m_openFile = false;
             this->m_file.close();
         }
+        this->m_bufferSize = 0;
+    }
+
+    bool LogFile::set_log_file(const char* fileName, const U32 maxSize, const U32 maxBackups)
+    {
+        FW_ASSERT(fileName != nullptr);
+
+        // If there is already a previously open file then close it:
+        this->close_log();
 
         // If file name is too large, return failure:
         U32 fileNameSize = Fw::StringUtils::string_length(fileName, Fw::String::STRING_SIZE);
@@ -148,6 +185,7 @@ namespace Svc {
         }
 
         this->m_currentFileSize = 0;
+        this->m_bufferSize = 0;
         this->m_maxFileSize = maxSize;
         this->m_fileName = fileNameFinal;
         this->m_openFile = true;
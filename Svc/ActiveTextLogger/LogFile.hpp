@@ -9,6 +9,7 @@
 #include <Fw/Types/String.hpp>
 #include <Os/File.hpp>
 #include <Os/FileSystem.hpp>
+#include <ActiveTextLoggerCfg.hpp>
 
 
 namespace Svc {
@@ -18,6 +19,10 @@ namespace Svc {
     //!
     //! The object is used for writing to a log file.  Making it a struct so all
     //! members are public, for ease of use in object composition.
+    //!
+    //! Text is gathered into an in-memory block and written to the file in
+    //! large chunks, rather than one write per line.  Call flush() to force
+    //! the pending text out to the file.
 
     struct LogFile {
 
@@ -50,6 +55,23 @@ namespace Svc {
         //!  \return true if writing to the file was successful, false otherwise
         bool write_to_log(const char *const buf, const U32 size);
 
+        //!  \brief Write any buffered text out to the log file
+        //!
+        //!  \return true if writing to the file was successful, false otherwise
+        bool flush();
+
+        //!  \brief Write the passed buf directly to the log file
+        //!
+        //!  \param buf The buffer of data to write
+        //!  \param size The size of buf
+        //!
+        //!  \return true if writing to the file was successful, false otherwise
+        bool write_to_file(const char *const buf, const U32 size);
+
+        //!  \brief Flush and close the log file, if there is one open
+        //!
+        void close_log();
+
         // ----------------------------------------------------------------------
         // Member Variables
         // ----------------------------------------------------------------------
@@ -66,8 +88,14 @@ namespace Svc {
         // True if there is currently an open file to write text logs to:
         bool m_openFile;
 
-        // Current size of the file:
+        // Current size of the file, including text not yet flushed:
         U32 m_currentFileSize;
+
+        // Text waiting to be written to the file:
+        char m_buffer[ACTIVE_TEXT_LOGGER_BUFFER_SIZE];
+
+        // Number of bytes of text held in m_buffer:
+        U32 m_bufferSize;
     };
 
 }
@@ -0,0 +1,25 @@
+// ----------------------------------------------------------------------
+// TestMain.cpp
+// ----------------------------------------------------------------------
+
+#include "ActiveTextLoggerTester.hpp"
+
+TEST(Nominal, Logging) {
+    Svc::ActiveTextLoggerTester tester;
+    tester.run_nominal_test();
+}
+
+TEST(OffNominal, LogFile) {
+    Svc::ActiveTextLoggerTester tester;
+    tester.run_off_nominal_test();
+}
+
+TEST(Nominal, BufferedWrites) {
+    Svc::ActiveTextLoggerTester tester;
+    tester.run_buffered_test();
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
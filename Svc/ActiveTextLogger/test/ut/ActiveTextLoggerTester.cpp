@@ -94,6 +94,9 @@ namespace Svc {
       ASSERT_EQ(512U, this->component.m_log_file.m_maxFileSize);
       U32 past_size = strlen(text.toChar())+32;
 
+      // Text is buffered until flushed:
+      this->flushLog();
+
       // Read file to verify contents:
       std::ifstream stream1("test_file");
       char oldLine[256];
@@ -125,6 +128,7 @@ namespace Svc {
       ASSERT_EQ(512U, this->component.m_log_file.m_maxFileSize);
 
       // Test predicted size matches actual:
+      this->flushLog();
       FwSignedSizeType fileSize = 0;
       Os::FileSystem::getFileSize("test_file",fileSize);
       ASSERT_EQ(fileSize,this->component.m_log_file.m_currentFileSize);
@@ -197,6 +201,9 @@ namespace Svc {
       ASSERT_EQ(45U, this->component.m_log_file.m_maxFileSize);
       U32 past_size = strlen(text.toChar())+33;
 
+      // Text is buffered until flushed:
+      this->flushLog();
+
       // Read file to verify contents:
       std::ifstream stream1("test_file_max");
       char oldLine[256];
@@ -347,10 +354,86 @@ namespace Svc {
 
   }
 
+  void ActiveTextLoggerTester ::
+  run_buffered_test()
+  {
+      printf("Testing buffered writes to file\n");
+
+      FwSignedSizeType fileSize = 0;
+      bool stat = this->component.set_log_file("test_file_buffered",4*ACTIVE_TEXT_LOGGER_BUFFER_SIZE);
+      ASSERT_TRUE(stat);
+
+      // Lines are held in memory until flushed:
+      FwEventIdType id = 1;
+      Fw::Time timeTag(TB_NONE,3,6);
+      Fw::LogSeverity severity = Fw::LogSeverity::ACTIVITY_HI;
+      Fw::TextLogString text("Buffered line");
+      this->invoke_to_TextLogger(0,id,timeTag,severity,text);
+      this->component.doDispatch();
+      this->invoke_to_TextLogger(0,id,timeTag,severity,text);
+      this->component.doDispatch();
+
+      U32 lineSize = strlen(text.toChar())+33;
+      ASSERT_EQ(2*lineSize, this->component.m_log_file.m_currentFileSize);
+      ASSERT_EQ(2*lineSize, this->component.m_log_file.m_bufferSize);
+      ASSERT_EQ(Os::FileSystem::OP_OK, Os::FileSystem::getFileSize("test_file_buffered",fileSize));
+      ASSERT_EQ(0, fileSize);
+
+      // Scheduled flush writes them out together:
+      this->flushLog();
+      ASSERT_EQ(0U, this->component.m_log_file.m_bufferSize);
+      ASSERT_EQ(Os::FileSystem::OP_OK, Os::FileSystem::getFileSize("test_file_buffered",fileSize));
+      ASSERT_EQ(2*lineSize, static_cast<U32>(fileSize));
+
+      // Filling the buffer writes out what is held before adding more:
+      U32 lines = 0;
+      while (this->component.m_log_file.m_bufferSize + lineSize <= ACTIVE_TEXT_LOGGER_BUFFER_SIZE) {
+          this->invoke_to_TextLogger(0,id,timeTag,severity,text);
+          this->component.doDispatch();
+          ++lines;
+      }
+      ASSERT_EQ(Os::FileSystem::OP_OK, Os::FileSystem::getFileSize("test_file_buffered",fileSize));
+      ASSERT_EQ(2*lineSize, static_cast<U32>(fileSize));
+      this->invoke_to_TextLogger(0,id,timeTag,severity,text);
+      this->component.doDispatch();
+      ASSERT_EQ(lineSize, this->component.m_log_file.m_bufferSize);
+      ASSERT_EQ(Os::FileSystem::OP_OK, Os::FileSystem::getFileSize("test_file_buffered",fileSize));
+      ASSERT_EQ((2+lines)*lineSize, static_cast<U32>(fileSize));
+
+      // FATAL events are written out immediately:
+      severity = Fw::LogSeverity::FATAL;
+      this->invoke_to_TextLogger(0,id,timeTag,severity,text);
+      this->component.doDispatch();
+      ASSERT_EQ(0U, this->component.m_log_file.m_bufferSize);
+      ASSERT_EQ(Os::FileSystem::OP_OK, Os::FileSystem::getFileSize("test_file_buffered",fileSize));
+      ASSERT_EQ(this->component.m_log_file.m_currentFileSize, static_cast<U32>(fileSize));
+
+      // Text held when the file is closed is not lost:
+      severity = Fw::LogSeverity::ACTIVITY_HI;
+      this->invoke_to_TextLogger(0,id,timeTag,severity,text);
+      this->component.doDispatch();
+      U32 expectedSize = this->component.m_log_file.m_currentFileSize;
+      stat = this->component.set_log_file("test_file_buffered",50);
+      ASSERT_TRUE(stat);
+      ASSERT_EQ(Os::FileSystem::OP_OK, Os::FileSystem::getFileSize("test_file_buffered",fileSize));
+      ASSERT_EQ(expectedSize, static_cast<U32>(fileSize));
+
+      // Clean up:
+      remove("test_file_buffered");
+      remove("test_file_buffered0");
+  }
+
   // ----------------------------------------------------------------------
   // Helper methods
   // ----------------------------------------------------------------------
 
+  void ActiveTextLoggerTester ::
+    flushLog()
+  {
+    this->invoke_to_schedIn(0, 0);
+    this->component.doDispatch();
+  }
+
   void ActiveTextLoggerTester ::
     connectPorts()
   {
@@ -361,6 +444,12 @@ namespace Svc {
         this->component.get_TextLogger_InputPort(0)
     );
 
+    // schedIn
+    this->connect_to_schedIn(
+        0,
+        this->component.get_schedIn_InputPort(0)
+    );
+
 
 
 
@@ -37,6 +37,7 @@ namespace Svc {
 
       void run_nominal_test();
       void run_off_nominal_test();
+      void run_buffered_test();
 
     private:
 
@@ -44,6 +45,10 @@ namespace Svc {
       // Helper methods
       // ----------------------------------------------------------------------
 
+      //! Invoke schedIn and dispatch it, writing buffered text to the file
+      //!
+      void flushLog();
+
       //! Connect ports
       //!
       void connectPorts();
@@ -148,6 +148,12 @@ namespace Svc {
           //! The number of bytes written to the current file
           U32 m_bytesWritten;
 
+          //! The hash of the bytes written to the current file
+          Utils::Hash m_hash;
+
+          //! Whether m_hash covers the file; false when a failed write may have left unknown bytes in it
+          bool m_hashValid;
+
       }; // class File
 
     public:
@@ -32,7 +32,8 @@ namespace Svc {
       m_maxSize(0),
       m_sizeOfSize(0),
       m_mode(Mode::CLOSED),
-      m_bytesWritten(0)
+      m_bytesWritten(0),
+      m_hashValid(false)
   {
   }
 
@@ -156,6 +157,9 @@ namespace Svc {
       this->m_fileCounter++;
       // Reset bytes written
       this->m_bytesWritten = 0;
+      // Hash the file as it is written
+      this->m_hash.init();
+      this->m_hashValid = true;
       // Set mode
       this->m_mode = File::Mode::OPEN;
     }
@@ -204,6 +208,12 @@ namespace Svc {
     FW_ASSERT(length > 0, length);
     FwSignedSizeType size = length;
     const Os::File::Status fileStatus = this->m_osFile.write(reinterpret_cast<const U8*>(data), size);
+    if (fileStatus == Os::File::OP_OK) {
+      this->m_hash.update(data, static_cast<NATIVE_INT_TYPE>(size));
+    }
+    else {
+      this->m_hashValid = false;
+    }
     bool status;
     if (fileStatus == Os::File::OP_OK && size == static_cast<NATIVE_INT_TYPE>(length)) {
       this->m_bytesWritten += length;
@@ -222,8 +232,16 @@ namespace Svc {
     writeHashFile()
   {
     Os::ValidatedFile validatedFile(this->m_name.toChar());
-    const Os::ValidateFile::Status status =
-      validatedFile.createHashFile();
+    Os::ValidateFile::Status status;
+    if (this->m_hashValid) {
+      Utils::HashBuffer hashBuffer;
+      this->m_hash.final(hashBuffer);
+      status = validatedFile.createHashFile(hashBuffer);
+    }
+    else {
+      // The file contents are unknown after a failed write, so hash what was written
+      status = validatedFile.createHashFile();
+    }
     if (status !=  Os::ValidateFile::VALIDATION_OK) {
       const Fw::String &hashFileName = validatedFile.getHashFileName();
       Fw::LogStringArg logStringArg(hashFileName.toChar());
@@ -27,6 +27,7 @@ namespace Svc {
         CmdSequencerComponentBase(name),
         m_FPrimeSequence(*this),
         m_sequence(&this->m_FPrimeSequence),
+        m_cacheHitCount(0),
         m_loadCmdCount(0),
         m_cancelCmdCount(0),
         m_errorCount(0),
@@ -36,6 +37,7 @@ namespace Svc {
         m_totalExecutedCount(0),
         m_sequencesCompletedCount(0),
         m_timeout(0),
+        m_timerWheelArmed(false),
         m_blockState(Svc::CmdSequencer_BlockState::NO_BLOCK),
         m_opCode(0),
         m_cmdSeq(0),
@@ -53,6 +55,12 @@ namespace Svc {
         this->m_timeout = timeout;
     }
 
+    void CmdSequencerComponentImpl ::
+      setStreaming(const bool streaming)
+    {
+      this->m_FPrimeSequence.setStreaming(streaming);
+    }
+
     void CmdSequencerComponentImpl ::
       setSequenceFormat(Sequence& sequence)
     {
@@ -84,6 +92,23 @@ namespace Svc {
         this->m_sequence->deallocateBuffer(allocator);
     }
 
+    void CmdSequencerComponentImpl ::
+      allocateCache(
+          const NATIVE_INT_TYPE identifier,
+          Fw::MemAllocator& allocator,
+          const NATIVE_UINT_TYPE entries,
+          const NATIVE_UINT_TYPE entrySize
+      )
+    {
+        this->m_cache.allocate(identifier, allocator, entries, entrySize);
+    }
+
+    void CmdSequencerComponentImpl ::
+      deallocateCache(Fw::MemAllocator& allocator)
+    {
+        this->m_cache.deallocate(allocator);
+    }
+
     CmdSequencerComponentImpl::~CmdSequencerComponentImpl() {
 
     }
@@ -141,12 +166,18 @@ namespace Svc {
             return;
         }
 
-        // load commands
-        if (not this->loadFile(fileName)) {
+        // load commands from the file, replacing any copy kept in memory
+        this->m_cache.remove(fileName);
+        if (not this->loadFile(fileName, false)) {
             this->cmdResponse_out(opCode, cmdSeq, Fw::CmdResponse::EXECUTION_ERROR);
             return;
         }
 
+        // keep the validated sequence, if memory was given for it
+        if (this->m_cache.save(*this->m_sequence)) {
+            this->log_ACTIVITY_LO_CS_SequenceCached(this->m_sequence->getLogFileName());
+        }
+
         // clear the buffer
         this->m_sequence->clear();
 
@@ -240,14 +271,34 @@ namespace Svc {
         }
     }
 
+    void CmdSequencerComponentImpl::CS_CACHE_CLEAR_cmdHandler(
+        const FwOpcodeType opCode, const U32 cmdSeq) {
+        this->m_cache.clear();
+        this->log_ACTIVITY_HI_CS_CacheCleared();
+        this->cmdResponse_out(opCode, cmdSeq, Fw::CmdResponse::OK);
+    }
+
     // ----------------------------------------------------------------------
     // Private helper methods
     // ----------------------------------------------------------------------
 
     bool CmdSequencerComponentImpl ::
-      loadFile(const Fw::CmdStringArg& fileName)
+      loadFile(const Fw::CmdStringArg& fileName, const bool useCache)
     {
-      const bool status = this->m_sequence->loadFile(fileName);
+      bool status;
+      if (useCache and this->m_cache.restore(fileName, *this->m_sequence)) {
+        // The copy was validated when kept, only the time may no longer match
+        Sequence::Header header = this->m_sequence->getHeader();
+        status = header.validateTime(*this);
+        if (status) {
+          ++this->m_cacheHitCount;
+          this->tlmWrite_CS_CacheHits(this->m_cacheHitCount);
+        } else {
+          this->m_sequence->clear();
+        }
+      } else {
+        status = this->m_sequence->loadFile(fileName);
+      }
       if (status) {
         Fw::LogStringArg& logFileName = this->m_sequence->getLogFileName();
         this->log_ACTIVITY_LO_CS_SequenceLoaded(logFileName);
@@ -267,6 +318,7 @@ namespace Svc {
         this->m_runMode = STOPPED;
         this->m_cmdTimer.clear();
         this->m_cmdTimeoutTimer.clear();
+        this->updateTimerWheel();
         this->m_executedCount = 0;
         // write sequence done port with error, if connected
         if (this->isConnected_seqDone_OutputPort(0)) {
@@ -304,8 +356,7 @@ namespace Svc {
                 this->commandComplete(opcode);
                 if (not this->m_sequence->hasMoreRecords()) {
                     // No data left
-                    this->m_runMode = STOPPED;
-                    this->sequenceComplete();
+                    this->sequenceEnd();
                 } else {
                     this->performCmd_Step();
                 }
@@ -313,32 +364,29 @@ namespace Svc {
                 // Manual step mode
                 this->commandComplete(opcode);
                 if (not this->m_sequence->hasMoreRecords()) {
-                    this->m_runMode = STOPPED;
-                    this->sequenceComplete();
+                    this->sequenceEnd();
                 }
             }
+            this->updateTimerWheel();
         }
     }
 
     void CmdSequencerComponentImpl ::
       schedIn_handler(NATIVE_INT_TYPE portNum, NATIVE_UINT_TYPE order)
     {
+        this->checkTimers();
+        this->updateTimerWheel();
+    }
 
-        Fw::Time currTime = this->getTime();
-        // check to see if a command time is pending
-        if (this->m_cmdTimer.isExpiredAt(currTime)) {
-            this->comCmdOut_out(0, m_record.m_command, 0);
-            this->m_cmdTimer.clear();
-            // start command timeout timer
-            this->setCmdTimeout(currTime);
-        } else if (this->m_cmdTimeoutTimer.isExpiredAt(this->getTime())) { // check for command timeout
-            this->log_WARNING_HI_CS_SequenceTimeout(
-                m_sequence->getLogFileName(),
-                this->m_executedCount
-            );
-            // If there is a command timeout, cancel the sequence
-            this->performCmd_Cancel();
-        }
+    void CmdSequencerComponentImpl ::
+      timerExpired_handler(NATIVE_INT_TYPE portNum, const Fw::Time& deadline)
+    {
+        // The timer wheel disarms the timer it wakes us with
+        this->m_timerWheelArmed = false;
+        this->checkTimers();
+        // Arm again with the timeout of a command sent, or with the same
+        // time if it has not arrived by our clock
+        this->updateTimerWheel();
     }
 
     void CmdSequencerComponentImpl ::
@@ -479,6 +527,18 @@ namespace Svc {
 
     }
 
+    void CmdSequencerComponentImpl::sequenceEnd() {
+        if (this->m_sequence->readFailed()) {
+            // The records left could not be read, so the sequence did not complete.
+            // Close the file first, such that the cancel does not read it again.
+            this->m_sequence->clear();
+            this->performCmd_Cancel();
+        } else {
+            this->m_runMode = STOPPED;
+            this->sequenceComplete();
+        }
+    }
+
     void CmdSequencerComponentImpl::commandComplete(const U32 opcode) {
         this->log_ACTIVITY_LO_CS_CommandComplete(
             this->m_sequence->getLogFileName(),
@@ -506,6 +566,7 @@ namespace Svc {
         } else {
             this->m_cmdTimer.set(this->m_record.m_timeTag);
         }
+        this->updateTimerWheel();
     }
 
     void CmdSequencerComponentImpl ::
@@ -529,5 +590,46 @@ namespace Svc {
         }
     }
 
+    void CmdSequencerComponentImpl::checkTimers() {
+        Fw::Time currTime = this->getTime();
+        // check to see if a command time is pending
+        if (this->m_cmdTimer.isExpiredAt(currTime)) {
+            this->comCmdOut_out(0, m_record.m_command, 0);
+            this->m_cmdTimer.clear();
+            // start command timeout timer
+            this->setCmdTimeout(currTime);
+        } else if (this->m_cmdTimeoutTimer.isExpiredAt(this->getTime())) { // check for command timeout
+            this->log_WARNING_HI_CS_SequenceTimeout(
+                m_sequence->getLogFileName(),
+                this->m_executedCount
+            );
+            // If there is a command timeout, cancel the sequence
+            this->performCmd_Cancel();
+        }
+    }
+
+    void CmdSequencerComponentImpl::updateTimerWheel() {
+        if (not this->isConnected_timerSet_OutputPort(0)) {
+            return;
+        }
+        // The command time is set until the command is sent, and the
+        // timeout after, so at most one of the timers is set
+        const Timer& timer = this->m_cmdTimer.isSet() ?
+            this->m_cmdTimer : this->m_cmdTimeoutTimer;
+        if (timer.isSet()) {
+            const Fw::Time& deadline = timer.getExpirationTime();
+            if (not this->m_timerWheelArmed or deadline != this->m_timerWheelDeadline) {
+                this->timerSet_out(0, deadline);
+                this->m_timerWheelArmed = true;
+                this->m_timerWheelDeadline = deadline;
+            }
+        } else if (this->m_timerWheelArmed) {
+            if (this->isConnected_timerCancel_OutputPort(0)) {
+                this->timerCancel_out(0);
+            }
+            this->m_timerWheelArmed = false;
+        }
+    }
+
 }
 
@@ -16,6 +16,7 @@
 #include "Os/File.hpp"
 #include "Os/ValidateFile.hpp"
 #include "Svc/CmdSequencer/CmdSequencerComponentAc.hpp"
+#include <CmdSequencerCfg.hpp>
 
 namespace Svc {
 
@@ -238,6 +239,22 @@ namespace Svc {
           //! Get the sequence header
           const Header& getHeader() const;
 
+          //! Get the data of the loaded sequence, such that it can be
+          //! restored with loadData. Valid after loadFile succeeded.
+          const Fw::SerializeBufferBase& getData() const;
+
+          //! Load sequence data saved after an earlier successful loadFile
+          //! of the same format, without reading or validating the file.
+          //! Formats that keep state outside the header and data buffer
+          //! must not be loaded this way.
+          //! \return Whether the data fit in the buffer
+          bool loadData(
+              const Fw::CmdStringArg& fileName, //!< The file name
+              const Header& header, //!< The saved header
+              const U8* data, //!< The saved data
+              const NATIVE_UINT_TYPE size //!< The size of the data
+          );
+
           //! Load a sequence file
           //! \return Success or failure
           virtual bool loadFile(
@@ -263,8 +280,35 @@ namespace Svc {
           //! After calling this, hasMoreRecords should return false
           virtual void clear() = 0;
 
+          //! Query whether all records are in the buffer, as opposed to
+          //! being read while the sequence runs
+          //! \return Yes or no
+          virtual bool isInMemory() const;
+
+          //! Query whether reading records failed while the sequence ran,
+          //! such that hasMoreRecords returned false before the last record
+          //! \return Yes or no
+          virtual bool readFailed() const;
+
+          //! Read the CRC stored for a sequence file of this format, without
+          //! loading the file. Formats that do not store one return false,
+          //! and their sequences are not kept in the cache.
+          //! \return Whether the CRC was read
+          virtual bool readStoredCRC(
+              const Fw::CmdStringArg& fileName, //!< The file name
+              U32& crc //!< The stored CRC
+          ) const;
+
         PROTECTED:
 
+          //! Read a big-endian U32 at the start or end of a file
+          //! \return Whether the value was read
+          static bool readFileU32(
+              const char* const fileName, //!< The file name
+              const bool atEnd, //!< Whether to read the last bytes of the file
+              U32& value //!< The value read
+          );
+
           //! The enclosing component
           CmdSequencerComponentImpl& m_component;
 
@@ -300,6 +344,19 @@ namespace Svc {
             INITIAL_COMPUTED_VALUE = 0xFFFFFFFFU
           };
 
+        public:
+
+          enum {
+            //! Upper bound of the serialized size of a record.
+            //! Streaming needs a buffer of at least this size.
+            MAX_RECORD_SIZE =
+              sizeof(U8) +
+              sizeof(U32) +
+              sizeof(U32) +
+              sizeof(U32) +
+              Fw::ComBuffer::SERIALIZED_SIZE
+          };
+
         public:
 
           //! \class CRC
@@ -363,6 +420,28 @@ namespace Svc {
           //! After calling this, hasMoreRecords should return false.
           void clear();
 
+          //! Query whether all records are in the buffer
+          //! \return Yes or no
+          bool isInMemory() const;
+
+          //! Query whether reading records failed while the sequence ran
+          //! \return Yes or no
+          bool readFailed() const;
+
+          //! Read the CRC stored in the last bytes of a sequence file
+          //! \return Whether the CRC was read
+          bool readStoredCRC(
+              const Fw::CmdStringArg& fileName, //!< The file name
+              U32& crc //!< The stored CRC
+          ) const;
+
+          //! Set whether files larger than the buffer are streamed: their
+          //! CRC is checked in chunks, and their records are read into the
+          //! buffer while the sequence runs
+          void setStreaming(
+              const bool streaming //!< Whether to stream large files
+          );
+
         PRIVATE:
 
           //! Read a sequence file
@@ -429,6 +508,21 @@ namespace Svc {
           //! \return Success or failure
           bool validateRecords();
 
+          //! Compute the CRC of a file too large for the buffer, reading it
+          //! in chunks, and read the stored CRC
+          //! \return Success or failure
+          bool readCRCInChunks();
+
+          //! Go back to the first record. Reads the first records of a
+          //! streamed file into the buffer.
+          //! \return Success or failure
+          bool rewind();
+
+          //! Read more records of a streamed file into the buffer if the
+          //! next record may not be in it
+          //! \return Success or failure
+          bool fillBuffer();
+
         PRIVATE:
 
           //! The CRC values
@@ -437,6 +531,18 @@ namespace Svc {
           //! The sequence file
           Os::File m_sequenceFile;
 
+          //! Whether files larger than the buffer are streamed
+          bool m_streaming;
+
+          //! Whether the loaded file is streamed, keeping it open
+          bool m_streamed;
+
+          //! Record bytes of the streamed file not yet read into the buffer
+          U32 m_streamLeft;
+
+          //! Whether reading the streamed file failed while it ran
+          bool m_readFailed;
+
       };
 
     PRIVATE:
@@ -445,6 +551,117 @@ namespace Svc {
       // Private classes
       // ----------------------------------------------------------------------
 
+      //! \class SequenceCache
+      //! \brief Validated sequences kept in memory, such that running them
+      //! does not read the file
+      class SequenceCache {
+
+        public:
+
+          //! Construct a SequenceCache object
+          SequenceCache();
+
+        public:
+
+          //! Give the cache memory for a number of sequences
+          void allocate(
+              const NATIVE_INT_TYPE identifier, //!< The identifier
+              Fw::MemAllocator& allocator, //!< The allocator
+              const NATIVE_UINT_TYPE entries, //!< The number of sequences to keep
+              const NATIVE_UINT_TYPE entrySize //!< The data bytes of each sequence
+          );
+
+          //! Return the memory
+          void deallocate(
+              Fw::MemAllocator& allocator //!< The allocator
+          );
+
+          //! Save a copy of a loaded sequence, replacing the least recently
+          //! used sequence when the cache is full
+          //! \return Whether the sequence was saved
+          bool save(
+              Sequence& sequence //!< The loaded sequence
+          );
+
+          //! Load a saved sequence into a sequence. A saved sequence whose
+          //! file is gone or no longer has the size and stored CRC it had
+          //! when saved is removed instead.
+          //! \return Whether the file name was found and loaded
+          bool restore(
+              const Fw::CmdStringArg& fileName, //!< The file name
+              Sequence& sequence //!< The sequence to load
+          );
+
+          //! Remove a saved sequence, if present
+          void remove(
+              const Fw::CmdStringArg& fileName //!< The file name
+          );
+
+          //! Remove all saved sequences
+          void clear();
+
+        PRIVATE:
+
+          //! A saved sequence
+          struct Entry {
+
+            //! Construct an Entry object
+            Entry();
+
+            //! Whether the entry holds a sequence
+            bool m_valid;
+
+            //! The file name
+            Fw::CmdStringArg m_fileName;
+
+            //! The validated header
+            Sequence::Header m_header;
+
+            //! The saved data
+            U8* m_data;
+
+            //! The size of the saved data
+            NATIVE_UINT_TYPE m_size;
+
+            //! The size of the file when the sequence was saved
+            FwSignedSizeType m_fileSize;
+
+            //! The CRC stored for the file when the sequence was saved
+            U32 m_fileCRC;
+
+            //! The use count when the entry was last saved or restored
+            U32 m_lastUse;
+
+          };
+
+          //! Find the entry of a file name
+          //! \return The entry, or nullptr if not present
+          Entry* find(
+              const Fw::CmdStringArg& fileName //!< The file name
+          );
+
+        PRIVATE:
+
+          //! The entries
+          Entry m_entries[CMD_SEQUENCER_MAX_CACHED_SEQUENCES];
+
+          //! The number of entries that have memory
+          NATIVE_UINT_TYPE m_numEntries;
+
+          //! The data bytes of each entry
+          NATIVE_UINT_TYPE m_entrySize;
+
+          //! The memory of all entries
+          U8* m_memory;
+
+          //! The allocator ID
+          NATIVE_INT_TYPE m_allocatorId;
+
+          //! Counter of saves and restores, ordering entries by use
+          U32 m_useCount;
+
+      };
+
       //! \class Timer
       //! \brief A class representing a timer
       class Timer {
@@ -478,6 +695,18 @@ namespace Svc {
             this->m_state = CLEAR;
           }
 
+          //! Determine whether the timer is set
+          //! \return Yes or no
+          bool isSet() const {
+            return this->m_state == SET;
+          }
+
+          //! Get the expiration time
+          //! \return The expiration time
+          const Fw::Time& getExpirationTime() const {
+            return this->expirationTime;
+          }
+
           //! Determine whether the timer is expired at a given time
           //! \return Yes or no
           bool isExpiredAt(
@@ -551,11 +780,38 @@ namespace Svc {
           const Fw::String& fileName //!< The file name
       );
 
+      //! (Optional) Stream F Prime sequence files larger than the sequence
+      //! buffer instead of rejecting them. Their CRC is checked in chunks,
+      //! and their records are read into the buffer while they run, such
+      //! that the buffer only needs FPrimeSequence::MAX_RECORD_SIZE bytes.
+      //! Applies to the default F Prime format.
+      void setStreaming(
+          const bool streaming //!< Whether to stream large files
+      );
+
       //! Return allocated buffer. Call during shutdown.
       void deallocateBuffer(
           Fw::MemAllocator& allocator //!< The allocator
       );
 
+      //! (Optional) Give the sequencer memory to keep validated sequences.
+      //! CS_VALIDATE then keeps a copy of each valid sequence, and running
+      //! a kept sequence does not read the file. The least recently used
+      //! sequence is dropped to make room. Each entry should be as large
+      //! as the sequence buffer. Call after allocateBuffer, before task is
+      //! spawned.
+      void allocateCache(
+          const NATIVE_INT_TYPE identifier, //!< The identifier
+          Fw::MemAllocator& allocator, //!< The allocator
+          const NATIVE_UINT_TYPE entries, //!< The number of sequences to keep
+          const NATIVE_UINT_TYPE entrySize //!< The bytes of each sequence
+      );
+
+      //! Return allocated cache memory. Call during shutdown.
+      void deallocateCache(
+          Fw::MemAllocator& allocator //!< The allocator
+      );
+
       //! Destroy a CmdDispatcherComponentBase
       ~CmdSequencerComponentImpl();
 
@@ -579,6 +835,12 @@ namespace Svc {
           NATIVE_UINT_TYPE order //!< The call order
       );
 
+      //! Handler for input port timerExpired
+      void timerExpired_handler(
+          NATIVE_INT_TYPE portNum, //!< The port number
+          const Fw::Time& deadline //!< The deadline that arrived
+      );
+
       //! Handler for input port seqRunIn
       void seqRunIn_handler(
           NATIVE_INT_TYPE portNum, //!< The port number
@@ -664,16 +926,24 @@ namespace Svc {
           const U32 cmdSeq /*!< The command sequence number*/
       );
 
+      //! Handler for command CS_CACHE_CLEAR
+      //! Drop all validated sequences kept in memory
+      void CS_CACHE_CLEAR_cmdHandler(
+          const FwOpcodeType opCode, /*!< The opcode*/
+          const U32 cmdSeq /*!< The command sequence number*/
+      );
+
     PRIVATE:
 
       // ----------------------------------------------------------------------
       // Private helper methods
       // ----------------------------------------------------------------------
 
-      //! Load a sequence file
+      //! Load a sequence file, or its copy in the cache
       //! \return Success or failure
       bool loadFile(
-          const Fw::CmdStringArg& fileName //!< The file name
+          const Fw::CmdStringArg& fileName, //!< The file name
+          const bool useCache = true //!< Whether a cached copy may be used
       );
 
       //! Perform a Cancel command
@@ -700,6 +970,10 @@ namespace Svc {
       //! Record a sequence complete event
       void sequenceComplete();
 
+      //! Stop at the end of the records: complete the sequence, or cancel it
+      //! if records could not be read
+      void sequenceEnd();
+
       //! Record an error
       void error();
 
@@ -721,6 +995,14 @@ namespace Svc {
           const Fw::Time &currentTime //!< The current time
       );
 
+      //! Send the command whose time arrived, or cancel the sequence
+      //! if the command timed out
+      void checkTimers();
+
+      //! Arm the timer wheel with the command time or timeout, or disarm it
+      //! if neither is set. Does nothing if the timer wheel is not connected.
+      void updateTimerWheel();
+
     PRIVATE:
 
       // ----------------------------------------------------------------------
@@ -733,6 +1015,12 @@ namespace Svc {
       //! The abstract sequence
       Sequence *m_sequence;
 
+      //! Validated sequences kept in memory
+      SequenceCache m_cache;
+
+      //! The number of sequences loaded from the cache
+      U32 m_cacheHitCount;
+
       //! The number of Load commands executed
       U32 m_loadCmdCount;
 
@@ -769,6 +1057,12 @@ namespace Svc {
       //! timeout timer
       Timer m_cmdTimeoutTimer;
 
+      //! Whether the timer wheel is armed
+      bool m_timerWheelArmed;
+
+      //! The time the timer wheel is armed with
+      Fw::Time m_timerWheelDeadline;
+
       //! Block mode for command status
       Svc::CmdSequencer_BlockState::t m_blockState;
       FwOpcodeType m_opCode;
@@ -10,6 +10,7 @@
 
 #include "Fw/Types/Assert.hpp"
 #include "Svc/CmdSequencer/CmdSequencerImpl.hpp"
+#include <cstring>
 extern "C" {
 #include "Utils/Hash/libcrc/lib_crc.h"
 }
@@ -47,7 +48,11 @@ namespace Svc {
 
   CmdSequencerComponentImpl::FPrimeSequence ::
     FPrimeSequence(CmdSequencerComponentImpl& component) :
-      Sequence(component)
+      Sequence(component),
+      m_streaming(false),
+      m_streamed(false),
+      m_streamLeft(0),
+      m_readFailed(false)
   {
 
   }
@@ -73,6 +78,10 @@ namespace Svc {
     // make sure there is a buffer allocated
     FW_ASSERT(this->m_buffer.getBuffAddr());
 
+    // close a file streamed before
+    this->clear();
+    this->m_readFailed = false;
+
     this->setFileName(fileName);
 
     const bool status = this->readFile()
@@ -80,6 +89,10 @@ namespace Svc {
      and this->m_header.validateTime(this->m_component)
      and this->validateRecords();
 
+    if (not status and this->m_streamed) {
+      this->clear();
+    }
+
     return status;
 
   }
@@ -87,7 +100,7 @@ namespace Svc {
   bool CmdSequencerComponentImpl::FPrimeSequence ::
     hasMoreRecords() const
   {
-    return this->m_buffer.getBuffLeft() > 0;
+    return (this->m_buffer.getBuffLeft() > 0) or (this->m_streamLeft > 0);
   }
 
   void CmdSequencerComponentImpl::FPrimeSequence ::
@@ -95,18 +108,58 @@ namespace Svc {
   {
     Fw::SerializeStatus status = this->deserializeRecord(record);
     FW_ASSERT(status == Fw::FW_SERIALIZE_OK, status);
+    // Read ahead, such that the next record is in the buffer when it is due
+    if (not this->fillBuffer()) {
+      this->m_readFailed = true;
+      this->m_streamLeft = 0;
+      this->m_buffer.resetSer();
+    }
   }
 
   void CmdSequencerComponentImpl::FPrimeSequence ::
     reset()
   {
-    this->m_buffer.resetDeser();
+    if (not this->rewind()) {
+      this->m_readFailed = true;
+      this->m_streamLeft = 0;
+      this->m_buffer.resetSer();
+    }
   }
 
   void CmdSequencerComponentImpl::FPrimeSequence ::
     clear()
   {
     this->m_buffer.resetSer();
+    this->m_streamLeft = 0;
+    if (this->m_streamed) {
+      this->m_sequenceFile.close();
+      this->m_streamed = false;
+    }
+  }
+
+  bool CmdSequencerComponentImpl::FPrimeSequence ::
+    isInMemory() const
+  {
+    return not this->m_streamed;
+  }
+
+  bool CmdSequencerComponentImpl::FPrimeSequence ::
+    readFailed() const
+  {
+    return this->m_readFailed;
+  }
+
+  bool CmdSequencerComponentImpl::FPrimeSequence ::
+    readStoredCRC(const Fw::CmdStringArg& fileName, U32& crc) const
+  {
+    // The CRC follows the records at the end of the file
+    return readFileU32(fileName.toChar(), true, crc);
+  }
+
+  void CmdSequencerComponentImpl::FPrimeSequence ::
+    setStreaming(const bool streaming)
+  {
+    this->m_streaming = streaming;
   }
 
   bool CmdSequencerComponentImpl::FPrimeSequence ::
@@ -130,7 +183,10 @@ namespace Svc {
       result = false;
     }
 
-    this->m_sequenceFile.close();
+    // A streamed file stays open while the sequence runs
+    if (not this->m_streamed) {
+      this->m_sequenceFile.close();
+    }
     return result;
 
   }
@@ -143,8 +199,15 @@ namespace Svc {
     bool status = this->readHeader();
     if (status) {
       this->m_crc.update(buffAddr, Sequence::Header::SERIALIZED_SIZE);
-      status = this->deserializeHeader()
-        and this->readRecordsAndCRC()
+      status = this->deserializeHeader();
+    }
+    if (status and (this->m_header.m_fileSize > this->m_buffer.getBuffCapacity())) {
+      // Only accepted when streaming: records are read while the sequence runs
+      this->m_streamed = true;
+      return this->readCRCInChunks();
+    }
+    if (status) {
+      status = this->readRecordsAndCRC()
         and this->extractCRC();
     }
     if (status) {
@@ -220,7 +283,9 @@ namespace Svc {
       );
       return false;
     }
-    if (header.m_fileSize > buffer.getBuffCapacity()) {
+    const bool canStream =
+      this->m_streaming and (buffer.getBuffCapacity() >= MAX_RECORD_SIZE);
+    if ((header.m_fileSize > buffer.getBuffCapacity()) and not canStream) {
       this->m_events.fileSizeError(header.m_fileSize);
       return false;
     }
@@ -423,8 +488,14 @@ namespace Svc {
     const U32 numRecords = this->m_header.m_numRecords;
     Sequence::Record record;
 
+    if (not this->rewind()) {
+      return false;
+    }
     // Deserialize all records
     for (NATIVE_UINT_TYPE recordNumber = 0; recordNumber < numRecords; recordNumber++) {
+      if (not this->fillBuffer()) {
+        return false;
+      }
       Fw::SerializeStatus status = this->deserializeRecord(record);
       if (status != Fw::FW_SERIALIZE_OK) {
         this->m_events.recordInvalid(recordNumber, status);
@@ -432,14 +503,122 @@ namespace Svc {
       }
     }
     // Check there is no data left
-    const U32 buffLeftSize = buffer.getBuffLeft();
+    const U32 buffLeftSize = buffer.getBuffLeft() + this->m_streamLeft;
     if (buffLeftSize > 0) {
       this->m_events.recordMismatch(numRecords, buffLeftSize);
       return false;
     }
     // Rewind deserialization
-    buffer.resetDeser();
+    return this->rewind();
+  }
+
+  bool CmdSequencerComponentImpl::FPrimeSequence ::
+    readCRCInChunks()
+  {
+    Os::File& file = this->m_sequenceFile;
+    Fw::SerializeBufferBase& buffer = this->m_buffer;
+    U8 *const buffAddr = buffer.getBuffAddr();
+    const U32 crcSize = sizeof(this->m_crc.m_stored);
+    FW_ASSERT(this->m_header.m_fileSize >= crcSize, this->m_header.m_fileSize);
+
+    // Compute the CRC of the records, one buffer at a time
+    U32 dataLeft = this->m_header.m_fileSize - crcSize;
+    while (dataLeft > 0) {
+      FwSignedSizeType readLen = FW_MIN(buffer.getBuffCapacity(), dataLeft);
+      const FwSignedSizeType expectedLen = readLen;
+      const Os::File::Status fileStatus = file.read(buffAddr, readLen);
+      if (fileStatus != Os::File::OP_OK) {
+        this->m_events.fileInvalid(
+            CmdSequencer_FileReadStage::READ_SEQ_DATA,
+            fileStatus
+        );
+        return false;
+      }
+      if (readLen != expectedLen) {
+        this->m_events.fileInvalid(
+            CmdSequencer_FileReadStage::READ_SEQ_DATA_SIZE,
+            readLen
+        );
+        return false;
+      }
+      this->m_crc.update(buffAddr, readLen);
+      dataLeft -= readLen;
+    }
+    this->m_crc.finalize();
 
+    // Read the stored CRC after the records
+    FwSignedSizeType readLen = crcSize;
+    const Os::File::Status fileStatus = file.read(buffAddr, readLen);
+    if ((fileStatus != Os::File::OP_OK) or (readLen != crcSize)) {
+      this->m_events.fileInvalid(
+          CmdSequencer_FileReadStage::READ_SEQ_CRC,
+          readLen
+      );
+      return false;
+    }
+    Fw::ExternalSerializeBuffer crcBuff(buffAddr, crcSize);
+    Fw::SerializeStatus status = crcBuff.setBuffLen(crcSize);
+    FW_ASSERT(status == Fw::FW_SERIALIZE_OK, status);
+    status = crcBuff.deserialize(this->m_crc.m_stored);
+    FW_ASSERT(status == Fw::FW_SERIALIZE_OK, status);
+    buffer.resetSer();
+    return true;
+  }
+
+  bool CmdSequencerComponentImpl::FPrimeSequence ::
+    rewind()
+  {
+    if (not this->m_streamed) {
+      this->m_buffer.resetDeser();
+      return true;
+    }
+    // Read the records again from the start of the file
+    const Os::File::Status fileStatus = this->m_sequenceFile.seek(
+        Sequence::Header::SERIALIZED_SIZE,
+        Os::File::SeekType::ABSOLUTE
+    );
+    if (fileStatus != Os::File::OP_OK) {
+      this->m_events.fileReadError();
+      return false;
+    }
+    this->m_buffer.resetSer();
+    this->m_streamLeft = this->m_header.m_fileSize - sizeof(this->m_crc.m_stored);
+    this->m_readFailed = false;
+    return this->fillBuffer();
+  }
+
+  bool CmdSequencerComponentImpl::FPrimeSequence ::
+    fillBuffer()
+  {
+    Fw::SerializeBufferBase& buffer = this->m_buffer;
+    const NATIVE_UINT_TYPE buffLeft = buffer.getBuffLeft();
+    if ((this->m_streamLeft == 0) or (buffLeft >= MAX_RECORD_SIZE)) {
+      return true;
+    }
+    // Keep the bytes not yet deserialized, and fill the rest of the buffer after them
+    U8 *const buffAddr = buffer.getBuffAddr();
+    ::memmove(buffAddr, buffer.getBuffAddrLeft(), buffLeft);
+    FW_ASSERT(buffer.getBuffCapacity() > buffLeft, buffer.getBuffCapacity(), buffLeft);
+    FwSignedSizeType readLen = FW_MIN(buffer.getBuffCapacity() - buffLeft, this->m_streamLeft);
+    const FwSignedSizeType expectedLen = readLen;
+    const Os::File::Status fileStatus = this->m_sequenceFile.read(&buffAddr[buffLeft], readLen);
+    if (fileStatus != Os::File::OP_OK) {
+      this->m_events.fileInvalid(
+          CmdSequencer_FileReadStage::READ_SEQ_DATA,
+          fileStatus
+      );
+      return false;
+    }
+    if (readLen != expectedLen) {
+      this->m_events.fileInvalid(
+          CmdSequencer_FileReadStage::READ_SEQ_DATA_SIZE,
+          readLen
+      );
+      return false;
+    }
+    this->m_streamLeft -= static_cast<U32>(readLen);
+    const Fw::SerializeStatus status = buffer.setBuffLen(buffLeft + static_cast<NATIVE_UINT_TYPE>(readLen));
+    FW_ASSERT(status == Fw::FW_SERIALIZE_OK, status);
     return true;
   }
 
@@ -107,6 +107,82 @@ namespace Svc {
       return this->m_header;
     }
 
+    const Fw::SerializeBufferBase& CmdSequencerComponentImpl::Sequence ::
+      getData() const
+    {
+      return this->m_buffer;
+    }
+
+    bool CmdSequencerComponentImpl::Sequence ::
+      loadData(
+          const Fw::CmdStringArg& fileName,
+          const Header& header,
+          const U8* data,
+          const NATIVE_UINT_TYPE size
+      )
+    {
+        FW_ASSERT(this->m_buffer.getBuffAddr());
+        FW_ASSERT(data);
+        if (size > this->m_buffer.getBuffCapacity()) {
+            return false;
+        }
+        this->clear();
+        this->setFileName(fileName);
+        this->m_header = header;
+        this->m_buffer.resetSer();
+        const Fw::SerializeStatus status = this->m_buffer.serialize(data, size, true);
+        FW_ASSERT(status == Fw::FW_SERIALIZE_OK, status);
+        return true;
+    }
+
+    bool CmdSequencerComponentImpl::Sequence ::
+      isInMemory() const
+    {
+      return true;
+    }
+
+    bool CmdSequencerComponentImpl::Sequence ::
+      readFailed() const
+    {
+      return false;
+    }
+
+    bool CmdSequencerComponentImpl::Sequence ::
+      readStoredCRC(const Fw::CmdStringArg& fileName, U32& crc) const
+    {
+      (void) fileName;
+      (void) crc;
+      return false;
+    }
+
+    bool CmdSequencerComponentImpl::Sequence ::
+      readFileU32(const char* const fileName, const bool atEnd, U32& value)
+    {
+        Os::File file;
+        if (file.open(fileName, Os::File::OPEN_READ) != Os::File::OP_OK) {
+            return false;
+        }
+        U8 bytes[sizeof(value)];
+        const FwSignedSizeType expectedLen = sizeof(bytes);
+        FwSignedSizeType fileSize = 0;
+        FwSignedSizeType readLen = expectedLen;
+        const bool status = (file.size(fileSize) == Os::File::OP_OK) and
+            (fileSize >= expectedLen) and
+            (file.seek(atEnd ? (fileSize - expectedLen) : 0, Os::File::SeekType::ABSOLUTE) == Os::File::OP_OK) and
+            (file.read(bytes, readLen) == Os::File::OP_OK) and
+            (readLen == expectedLen);
+        file.close();
+        if (not status) {
+            return false;
+        }
+        Fw::ExternalSerializeBuffer buffer(bytes, sizeof(bytes));
+        Fw::SerializeStatus serStatus = buffer.setBuffLen(sizeof(bytes));
+        FW_ASSERT(serStatus == Fw::FW_SERIALIZE_OK, serStatus);
+        serStatus = buffer.deserialize(value);
+        FW_ASSERT(serStatus == Fw::FW_SERIALIZE_OK, serStatus);
+        return true;
+    }
+
     void CmdSequencerComponentImpl::Sequence ::
       setFileName(const Fw::CmdStringArg& fileName)
     {
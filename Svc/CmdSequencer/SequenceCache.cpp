@@ -0,0 +1,171 @@
+// ======================================================================
+// \title  SequenceCache.cpp
+// \brief  Implementation file for CmdSequencer::SequenceCache
+//
+// Copyright (C) 2009-2018 California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+// ======================================================================
+
+#include <Fw/Types/Assert.hpp>
+#include <Os/FileSystem.hpp>
+#include <Svc/CmdSequencer/CmdSequencerImpl.hpp>
+#include <cstring>
+
+namespace Svc {
+
+    CmdSequencerComponentImpl::SequenceCache::Entry ::
+      Entry() :
+        m_valid(false),
+        m_data(nullptr),
+        m_size(0),
+        m_fileSize(0),
+        m_fileCRC(0),
+        m_lastUse(0)
+    {
+
+    }
+
+    CmdSequencerComponentImpl::SequenceCache ::
+      SequenceCache() :
+        m_numEntries(0),
+        m_entrySize(0),
+        m_memory(nullptr),
+        m_allocatorId(0),
+        m_useCount(0)
+    {
+
+    }
+
+    void CmdSequencerComponentImpl::SequenceCache ::
+      allocate(
+          const NATIVE_INT_TYPE identifier,
+          Fw::MemAllocator& allocator,
+          const NATIVE_UINT_TYPE entries,
+          const NATIVE_UINT_TYPE entrySize
+      )
+    {
+        FW_ASSERT(this->m_memory == nullptr);
+        FW_ASSERT(entries <= CMD_SEQUENCER_MAX_CACHED_SEQUENCES, entries);
+        FW_ASSERT(entrySize > 0);
+        bool recoverable;
+        NATIVE_UINT_TYPE bytes = entries * entrySize;
+        this->m_allocatorId = identifier;
+        this->m_memory = static_cast<U8*>(allocator.allocate(identifier, bytes, recoverable));
+        // Keep as many entries as the allocator provided memory for
+        this->m_numEntries = (this->m_memory == nullptr) ? 0 : FW_MIN(entries, bytes / entrySize);
+        this->m_entrySize = entrySize;
+        for (NATIVE_UINT_TYPE entry = 0; entry < this->m_numEntries; entry++) {
+            this->m_entries[entry].m_data = &this->m_memory[entry * entrySize];
+        }
+        this->clear();
+    }
+
+    void CmdSequencerComponentImpl::SequenceCache ::
+      deallocate(Fw::MemAllocator& allocator)
+    {
+        if (this->m_memory != nullptr) {
+            allocator.deallocate(this->m_allocatorId, this->m_memory);
+        }
+        this->clear();
+        for (NATIVE_UINT_TYPE entry = 0; entry < this->m_numEntries; entry++) {
+            this->m_entries[entry].m_data = nullptr;
+        }
+        this->m_memory = nullptr;
+        this->m_numEntries = 0;
+        this->m_entrySize = 0;
+    }
+
+    bool CmdSequencerComponentImpl::SequenceCache ::
+      save(Sequence& sequence)
+    {
+        const Fw::SerializeBufferBase& data = sequence.getData();
+        const NATIVE_UINT_TYPE size = data.getBuffLength();
+        if ((this->m_numEntries == 0) or (size > this->m_entrySize) or not sequence.isInMemory()) {
+            return false;
+        }
+        // Keep the file size and stored CRC, such that a changed file is not run from the copy
+        FwSignedSizeType fileSize = 0;
+        U32 fileCRC = 0;
+        if ((Os::FileSystem::getFileSize(sequence.getFileName().toChar(), fileSize) != Os::FileSystem::OP_OK) or
+            not sequence.readStoredCRC(sequence.getFileName(), fileCRC)) {
+            return false;
+        }
+        // Replace an earlier copy of the file, or else a free or the least recently used entry
+        Entry* entry = this->find(sequence.getFileName());
+        for (NATIVE_UINT_TYPE index = 0; (entry == nullptr) and (index < this->m_numEntries); index++) {
+            if (not this->m_entries[index].m_valid) {
+                entry = &this->m_entries[index];
+            }
+        }
+        if (entry == nullptr) {
+            entry = &this->m_entries[0];
+            for (NATIVE_UINT_TYPE index = 1; index < this->m_numEntries; index++) {
+                if (this->m_entries[index].m_lastUse < entry->m_lastUse) {
+                    entry = &this->m_entries[index];
+                }
+            }
+        }
+        ::memcpy(entry->m_data, data.getBuffAddr(), size);
+        entry->m_size = size;
+        entry->m_fileSize = fileSize;
+        entry->m_fileCRC = fileCRC;
+        entry->m_fileName = sequence.getFileName();
+        entry->m_header = sequence.getHeader();
+        entry->m_lastUse = ++this->m_useCount;
+        entry->m_valid = true;
+        return true;
+    }
+
+    bool CmdSequencerComponentImpl::SequenceCache ::
+      restore(const Fw::CmdStringArg& fileName, Sequence& sequence)
+    {
+        Entry* entry = this->find(fileName);
+        if (entry == nullptr) {
+            return false;
+        }
+        // Drop the copy if the file is gone, or its size or stored CRC changed since it was saved
+        FwSignedSizeType fileSize = 0;
+        U32 fileCRC = 0;
+        if ((Os::FileSystem::getFileSize(fileName.toChar(), fileSize) != Os::FileSystem::OP_OK) or
+            (fileSize != entry->m_fileSize) or not sequence.readStoredCRC(fileName, fileCRC) or
+            (fileCRC != entry->m_fileCRC)) {
+            entry->m_valid = false;
+            return false;
+        }
+        if (not sequence.loadData(fileName, entry->m_header, entry->m_data, entry->m_size)) {
+            return false;
+        }
+        entry->m_lastUse = ++this->m_useCount;
+        return true;
+    }
+
+    void CmdSequencerComponentImpl::SequenceCache ::
+      remove(const Fw::CmdStringArg& fileName)
+    {
+        Entry* entry = this->find(fileName);
+        if (entry != nullptr) {
+            entry->m_valid = false;
+        }
+    }
+
+    void CmdSequencerComponentImpl::SequenceCache ::
+      clear()
+    {
+        for (NATIVE_UINT_TYPE entry = 0; entry < this->m_numEntries; entry++) {
+            this->m_entries[entry].m_valid = false;
+        }
+    }
+
+    CmdSequencerComponentImpl::SequenceCache::Entry* CmdSequencerComponentImpl::SequenceCache ::
+      find(const Fw::CmdStringArg& fileName)
+    {
+        for (NATIVE_UINT_TYPE entry = 0; entry < this->m_numEntries; entry++) {
+            if (this->m_entries[entry].m_valid and (this->m_entries[entry].m_fileName == fileName)) {
+                return &this->m_entries[entry];
+            }
+        }
+        return nullptr;
+    }
+
+}
@@ -192,6 +192,14 @@ namespace Svc {
     this->m_buffer.resetSer();
   }
 
+  bool AMPCSSequence ::
+    readStoredCRC(const Fw::CmdStringArg& fileName, U32& crc) const
+  {
+    Fw::CmdStringArg crcFileName = fileName;
+    crcFileName += ".CRC32";
+    return readFileU32(crcFileName.toChar(), false, crc);
+  }
+
   bool AMPCSSequence ::
     readCRC()
   {
@@ -122,6 +122,13 @@ namespace Svc {
       //! After calling this, hasMoreRecords should return false.
       void clear();
 
+      //! Read the CRC stored in the CRC file of a sequence file
+      //! \return Whether the CRC was read
+      bool readStoredCRC(
+          const Fw::CmdStringArg& fileName, //!< The sequence file name
+          U32& crc //!< The stored CRC
+      ) const;
+
     PRIVATE:
 
       //! Read a CRC file
@@ -0,0 +1,280 @@
+// ======================================================================
+// \title  Cache.cpp
+// \brief  Test running sequences kept in memory
+//
+// \copyright
+// Copyright (C) 2009-2018 California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#include <Os/FileSystem.hpp>
+#include "Svc/CmdSequencer/test/ut/Cache.hpp"
+#include "Svc/CmdSequencer/test/ut/CommandBuffers.hpp"
+
+namespace Svc {
+
+  namespace Cache {
+
+    // ----------------------------------------------------------------------
+    // Constants
+    // ----------------------------------------------------------------------
+
+    //! Number of sequences kept in memory
+    static const NATIVE_UINT_TYPE CACHE_ENTRIES = 2;
+
+    // ----------------------------------------------------------------------
+    // Constructors
+    // ----------------------------------------------------------------------
+
+    CmdSequencerTester ::
+      CmdSequencerTester(const SequenceFiles::File::Format::t format) :
+        Svc::CmdSequencerTester(format)
+    {
+      this->component.allocateCache(
+          ALLOCATOR_ID,
+          this->mallocator,
+          CACHE_ENTRIES,
+          BUFFER_SIZE
+      );
+    }
+
+    CmdSequencerTester ::
+      ~CmdSequencerTester()
+    {
+      this->component.deallocateCache(this->mallocator);
+    }
+
+    // ----------------------------------------------------------------------
+    // Tests
+    // ----------------------------------------------------------------------
+
+    void CmdSequencerTester ::
+      RunFromMemory()
+    {
+      SequenceFiles::ImmediateFile file(1, this->format);
+      // Set the time
+      Fw::Time testTime(TB_WORKSTATION_TIME, 0, 0);
+      this->setTestTime(testTime);
+      // Write the file
+      const char *const fileName = file.getName().toChar();
+      file.write();
+      // Validate the file
+      this->validateCachedFile(0, fileName);
+      // Run the sequence from memory
+      this->runSequence(1, fileName);
+      ASSERT_TLM_CS_CacheHits_SIZE(1);
+      ASSERT_TLM_CS_CacheHits(0, 1);
+      // Check the command
+      Fw::ComBuffer comBuff;
+      CommandBuffers::create(comBuff, 0, 1);
+      ASSERT_from_comCmdOut_SIZE(1);
+      ASSERT_from_comCmdOut(0, comBuff, 0U);
+      // Complete the sequence
+      this->invoke_to_cmdResponseIn(0, 0, 0, Fw::CmdResponse::OK);
+      this->clearAndDispatch();
+      ASSERT_EVENTS_CS_SequenceComplete_SIZE(1);
+      ASSERT_EVENTS_CS_SequenceComplete(0, fileName);
+      // The sequence is still kept
+      this->runSequence(2, fileName);
+      ASSERT_TLM_CS_CacheHits(0, 2);
+      this->cancelSequence(3, fileName);
+    }
+
+    void CmdSequencerTester ::
+      RewrittenFile()
+    {
+      SequenceFiles::ImmediateFile file(1, this->format);
+      // Set the time
+      Fw::Time testTime(TB_WORKSTATION_TIME, 0, 0);
+      this->setTestTime(testTime);
+      // Write and validate the file
+      const char *const fileName = file.getName().toChar();
+      file.write();
+      this->validateCachedFile(0, fileName);
+      // Rewrite the file with two records under the same name
+      SequenceFiles::ImmediateFile newFile(2, this->format);
+      newFile.setName("immediate_1");
+      ASSERT_STREQ(fileName, newFile.getName().toChar());
+      newFile.write();
+      // The file is run, not the kept copy
+      this->runSequence(1, fileName);
+      ASSERT_TLM_CS_CacheHits_SIZE(0);
+      ASSERT_EQ(2U, this->component.m_sequence->getHeader().m_numRecords);
+      this->cancelSequence(2, fileName);
+      // The kept copy was dropped
+      this->runFileSequence(3, fileName);
+    }
+
+    void CmdSequencerTester ::
+      RewrittenFileSameSize()
+    {
+      SequenceFiles::ImmediateFile file(1, this->format);
+      // Set the time
+      Fw::Time testTime(TB_WORKSTATION_TIME, 0, 0);
+      this->setTestTime(testTime);
+      // Write and validate the file
+      const char *const fileName = file.getName().toChar();
+      file.write();
+      this->validateCachedFile(0, fileName);
+      FwSignedSizeType fileSize = 0;
+      ASSERT_EQ(Os::FileSystem::OP_OK, Os::FileSystem::getFileSize(fileName, fileSize));
+      // Rewrite the file under the same name with a record of the same
+      // size, which waits before its command
+      SequenceFiles::RelativeFile newFile(1, this->format);
+      newFile.setName("immediate_1");
+      ASSERT_STREQ(fileName, newFile.getName().toChar());
+      newFile.write();
+      FwSignedSizeType newFileSize = 0;
+      ASSERT_EQ(Os::FileSystem::OP_OK, Os::FileSystem::getFileSize(fileName, newFileSize));
+      ASSERT_EQ(fileSize, newFileSize);
+      // The file is run, not the kept copy
+      this->runSequence(1, fileName);
+      ASSERT_TLM_CS_CacheHits_SIZE(0);
+      ASSERT_from_comCmdOut_SIZE(0);
+      this->cancelSequence(2, fileName);
+      // The kept copy was dropped
+      file.write();
+      this->runFileSequence(3, fileName);
+    }
+
+    void CmdSequencerTester ::
+      RemovedFile()
+    {
+      SequenceFiles::ImmediateFile file(1, this->format);
+      // Set the time
+      Fw::Time testTime(TB_WORKSTATION_TIME, 0, 0);
+      this->setTestTime(testTime);
+      // Write and validate the file
+      const char *const fileName = file.getName().toChar();
+      file.write();
+      this->validateCachedFile(0, fileName);
+      // Without the file, the kept copy is not run
+      ASSERT_EQ(Os::FileSystem::OP_OK, Os::FileSystem::removeFile(fileName));
+      this->runMissingSequence(1, fileName);
+      // The kept copy was dropped
+      file.write();
+      this->runFileSequence(2, fileName);
+    }
+
+    void CmdSequencerTester ::
+      LeastRecentlyUsed()
+    {
+      SequenceFiles::ImmediateFile file1(1, this->format);
+      SequenceFiles::ImmediateFile file2(2, this->format);
+      SequenceFiles::ImmediateFile file3(3, this->format);
+      const char *const fileName1 = file1.getName().toChar();
+      const char *const fileName2 = file2.getName().toChar();
+      const char *const fileName3 = file3.getName().toChar();
+      // Set the time
+      Fw::Time testTime(TB_WORKSTATION_TIME, 0, 0);
+      this->setTestTime(testTime);
+      // Write the files
+      file1.write();
+      file2.write();
+      file3.write();
+      // Keep the first two, then use the first
+      this->validateCachedFile(0, fileName1);
+      this->validateCachedFile(0, fileName2);
+      this->runSequence(0, fileName1);
+      ASSERT_TLM_CS_CacheHits(0, 1);
+      this->cancelSequence(0, fileName1);
+      // The third replaces the second, which was used least recently
+      this->validateCachedFile(0, fileName3);
+      this->runSequence(0, fileName1);
+      ASSERT_TLM_CS_CacheHits(0, 2);
+      this->cancelSequence(0, fileName1);
+      this->runSequence(0, fileName3);
+      ASSERT_TLM_CS_CacheHits(0, 3);
+      this->cancelSequence(0, fileName3);
+      this->runFileSequence(0, fileName2);
+    }
+
+    void CmdSequencerTester ::
+      Clear()
+    {
+      SequenceFiles::ImmediateFile file(1, this->format);
+      // Set the time
+      Fw::Time testTime(TB_WORKSTATION_TIME, 0, 0);
+      this->setTestTime(testTime);
+      // Write and validate the file
+      const char *const fileName = file.getName().toChar();
+      file.write();
+      this->validateCachedFile(0, fileName);
+      // Clear the cache
+      this->sendCmd_CS_CACHE_CLEAR(0, 0);
+      this->clearAndDispatch();
+      ASSERT_CMD_RESPONSE_SIZE(1);
+      ASSERT_CMD_RESPONSE(
+          0,
+          CmdSequencerComponentBase::OPCODE_CS_CACHE_CLEAR,
+          0,
+          Fw::CmdResponse::OK
+      );
+      ASSERT_EVENTS_SIZE(1);
+      ASSERT_EVENTS_CS_CacheCleared_SIZE(1);
+      // The sequence is no longer run from memory
+      this->runFileSequence(0, fileName);
+    }
+
+    // ----------------------------------------------------------------------
+    // Helper functions
+    // ----------------------------------------------------------------------
+
+    void CmdSequencerTester ::
+      validateCachedFile(const U32 cmdSeq, const char* const fileName)
+    {
+      // Validate the file
+      this->sendCmd_CS_VALIDATE(0, cmdSeq, fileName);
+      this->clearAndDispatch();
+      // Assert command response
+      ASSERT_CMD_RESPONSE_SIZE(1);
+      ASSERT_CMD_RESPONSE(
+          0,
+          CmdSequencerComponentBase::OPCODE_CS_VALIDATE,
+          cmdSeq,
+          Fw::CmdResponse::OK
+      );
+      // Assert events
+      ASSERT_EVENTS_SIZE(3);
+      ASSERT_EVENTS_CS_SequenceLoaded(0, fileName);
+      ASSERT_EVENTS_CS_SequenceCached(0, fileName);
+      ASSERT_EVENTS_CS_SequenceValid(0, fileName);
+    }
+
+    void CmdSequencerTester ::
+      runFileSequence(const U32 cmdSeq, const char* const fileName)
+    {
+      this->runSequence(cmdSeq, fileName);
+      ASSERT_TLM_CS_CacheHits_SIZE(0);
+      // Check the command
+      Fw::ComBuffer comBuff;
+      CommandBuffers::create(comBuff, 0, 1);
+      ASSERT_from_comCmdOut_SIZE(1);
+      ASSERT_from_comCmdOut(0, comBuff, 0U);
+      this->cancelSequence(cmdSeq, fileName);
+    }
+
+    void CmdSequencerTester ::
+      runMissingSequence(const U32 cmdSeq, const char* const fileName)
+    {
+      this->sendCmd_CS_RUN(0, cmdSeq, fileName, Svc::CmdSequencer_BlockState::NO_BLOCK);
+      this->clearAndDispatch();
+      // Assert command response
+      ASSERT_CMD_RESPONSE_SIZE(1);
+      ASSERT_CMD_RESPONSE(
+          0,
+          CmdSequencerComponentBase::OPCODE_CS_RUN,
+          cmdSeq,
+          Fw::CmdResponse::EXECUTION_ERROR
+      );
+      // Assert events
+      ASSERT_EVENTS_SIZE(1);
+      ASSERT_EVENTS_CS_FileNotFound(0, fileName);
+      ASSERT_TLM_CS_CacheHits_SIZE(0);
+    }
+
+  }
+
+}
@@ -0,0 +1,98 @@
+// ======================================================================
+// \title  Cache.hpp
+// \brief  Test running sequences kept in memory
+//
+// \copyright
+// Copyright (C) 2009-2018 California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#ifndef Svc_Cache_HPP
+#define Svc_Cache_HPP
+
+#include "CmdSequencerTester.hpp"
+
+namespace Svc {
+
+  namespace Cache {
+
+    class CmdSequencerTester :
+      public Svc::CmdSequencerTester
+    {
+
+      public:
+
+        // ----------------------------------------------------------------------
+        // Constructors
+        // ----------------------------------------------------------------------
+
+        //! Construct object CmdSequencerTester
+        CmdSequencerTester(
+            const SequenceFiles::File::Format::t format =
+            SequenceFiles::File::Format::F_PRIME //!< The file format to use
+        );
+
+        //! Destroy object CmdSequencerTester
+        ~CmdSequencerTester();
+
+      public:
+
+        // ----------------------------------------------------------------------
+        // Tests
+        // ----------------------------------------------------------------------
+
+        //! Validate a sequence, then run it from memory
+        void RunFromMemory();
+
+        //! Validate a sequence, rewrite its file with another size, then
+        //! check the file is run and the kept copy dropped
+        void RewrittenFile();
+
+        //! Validate a sequence, rewrite its file with other records of the
+        //! same size, then check the file is run and the kept copy dropped
+        void RewrittenFileSameSize();
+
+        //! Validate a sequence, remove its file, then check it no longer runs
+        void RemovedFile();
+
+        //! Validate more sequences than fit and check the least recently
+        //! used one is dropped
+        void LeastRecentlyUsed();
+
+        //! Clear the sequences kept in memory
+        void Clear();
+
+      private:
+
+        // ----------------------------------------------------------------------
+        // Helper functions
+        // ----------------------------------------------------------------------
+
+        //! Validate a file that is kept in memory
+        void validateCachedFile(
+            const U32 cmdSeq, //!< The command sequence number
+            const char* const fileName //!< The file name
+        );
+
+        //! Run a sequence that is not kept in memory, check its first
+        //! command and cancel it
+        void runFileSequence(
+            const U32 cmdSeq, //!< The command sequence number
+            const char* const fileName //!< The file name
+        );
+
+        //! Run a sequence whose file is gone
+        void runMissingSequence(
+            const U32 cmdSeq, //!< The command sequence number
+            const char* const fileName //!< The file name
+        );
+
+    };
+
+  }
+
+}
+
+#endif
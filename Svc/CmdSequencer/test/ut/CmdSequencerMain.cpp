@@ -9,6 +9,7 @@
 
 #include <Os/FileSystem.hpp>
 #include "Svc/CmdSequencer/test/ut/AMPCS.hpp"
+#include "Svc/CmdSequencer/test/ut/Cache.hpp"
 #include "Svc/CmdSequencer/test/ut/Health.hpp"
 #include "Svc/CmdSequencer/test/ut/Immediate.hpp"
 #include "Svc/CmdSequencer/test/ut/ImmediateEOS.hpp"
@@ -20,6 +21,8 @@
 #include "Svc/CmdSequencer/test/ut/Mixed.hpp"
 #include "Svc/CmdSequencer/test/ut/UnitTest.hpp"
 #include "Svc/CmdSequencer/test/ut/JoinWait.hpp"
+#include "Svc/CmdSequencer/test/ut/Streaming.hpp"
+#include "Svc/CmdSequencer/test/ut/Wheel.hpp"
 
 TEST(AMPCS, MissingCRC) {
   Svc::AMPCS::CmdSequencerTester tester;
@@ -31,6 +34,51 @@ TEST(AMPCS, MissingFile) {
   tester.MissingFile();
 }
 
+TEST(Cache, RunFromMemory) {
+  Svc::Cache::CmdSequencerTester tester;
+  tester.RunFromMemory();
+}
+
+TEST(Cache, RunFromMemoryAMPCS) {
+  Svc::Cache::CmdSequencerTester tester(Svc::SequenceFiles::File::Format::AMPCS);
+  tester.RunFromMemory();
+}
+
+TEST(Cache, RewrittenFile) {
+  Svc::Cache::CmdSequencerTester tester;
+  tester.RewrittenFile();
+}
+
+TEST(Cache, RewrittenFileAMPCS) {
+  Svc::Cache::CmdSequencerTester tester(Svc::SequenceFiles::File::Format::AMPCS);
+  tester.RewrittenFile();
+}
+
+TEST(Cache, RewrittenFileSameSize) {
+  Svc::Cache::CmdSequencerTester tester;
+  tester.RewrittenFileSameSize();
+}
+
+TEST(Cache, RewrittenFileSameSizeAMPCS) {
+  Svc::Cache::CmdSequencerTester tester(Svc::SequenceFiles::File::Format::AMPCS);
+  tester.RewrittenFileSameSize();
+}
+
+TEST(Cache, RemovedFile) {
+  Svc::Cache::CmdSequencerTester tester;
+  tester.RemovedFile();
+}
+
+TEST(Cache, LeastRecentlyUsed) {
+  Svc::Cache::CmdSequencerTester tester;
+  tester.LeastRecentlyUsed();
+}
+
+TEST(Cache, Clear) {
+  Svc::Cache::CmdSequencerTester tester;
+  tester.Clear();
+}
+
 TEST(Health, Ping) {
   TEST_CASE(103.1.9,"Nominal ping test");
   Svc::Health::CmdSequencerTester tester;
@@ -390,6 +438,41 @@ TEST(JoinWait, JoinWaitWithActiveSeq) {
     tester.test_join_wait_with_active_seq();
 }
 
+TEST(Streaming, RunLargeSequence) {
+  Svc::Streaming::CmdSequencerTester tester;
+  tester.RunLargeSequence();
+}
+
+TEST(Streaming, CancelAndRestart) {
+  Svc::Streaming::CmdSequencerTester tester;
+  tester.CancelAndRestart();
+}
+
+TEST(Streaming, BadCRC) {
+  Svc::Streaming::CmdSequencerTester tester;
+  tester.BadCRC();
+}
+
+TEST(Streaming, TruncatedFile) {
+  Svc::Streaming::CmdSequencerTester tester;
+  tester.TruncatedFile();
+}
+
+TEST(Streaming, ReadFailure) {
+  Svc::Streaming::CmdSequencerTester tester;
+  tester.ReadFailure();
+}
+
+TEST(Wheel, RelativeCommands) {
+  Svc::Wheel::CmdSequencerTester tester;
+  tester.RelativeCommands();
+}
+
+TEST(Wheel, TimeoutAndCancel) {
+  Svc::Wheel::CmdSequencerTester tester;
+  tester.TimeoutAndCancel();
+}
+
 
 int main(int argc, char **argv) {
   // Create ./bin directory for test files
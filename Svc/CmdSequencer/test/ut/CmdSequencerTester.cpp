@@ -79,6 +79,23 @@ namespace Svc {
     this->pushFromPortEntry_pingOut(key);
   }
 
+  void CmdSequencerTester ::
+    from_timerSet_handler(
+      const NATIVE_INT_TYPE portNum,
+      const Fw::Time& deadline
+    )
+  {
+    this->pushFromPortEntry_timerSet(deadline);
+  }
+
+  void CmdSequencerTester ::
+    from_timerCancel_handler(
+      const NATIVE_INT_TYPE portNum
+    )
+  {
+    this->pushFromPortEntry_timerCancel();
+  }
+
   // ----------------------------------------------------------------------
   // Virtual function interface
   // ----------------------------------------------------------------------
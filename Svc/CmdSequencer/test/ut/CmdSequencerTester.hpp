@@ -209,6 +209,19 @@ namespace Svc {
           U32 key //!< Value to return to pinger
       );
 
+      //! Handler for from_timerSet
+      //!
+      void from_timerSet_handler(
+          const NATIVE_INT_TYPE portNum, //!< The port number
+          const Fw::Time& deadline //!< Time at which the client is woken
+      );
+
+      //! Handler for from_timerCancel
+      //!
+      void from_timerCancel_handler(
+          const NATIVE_INT_TYPE portNum //!< The port number
+      );
+
 #if VERBOSE
     protected:
 
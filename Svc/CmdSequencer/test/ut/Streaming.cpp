@@ -0,0 +1,257 @@
+// ======================================================================
+// \title  Streaming.cpp
+// \brief  Test running sequences larger than the sequence buffer
+//
+// \copyright
+// Copyright (C) 2009-2018 California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#include "Svc/CmdSequencer/test/ut/Streaming.hpp"
+#include "Svc/CmdSequencer/test/ut/CommandBuffers.hpp"
+#include "Svc/CmdSequencer/test/ut/SequenceFiles/Buffers.hpp"
+#include "Svc/CmdSequencer/test/ut/SequenceFiles/FPrime/FPrime.hpp"
+
+namespace Svc {
+
+  namespace Streaming {
+
+    // ----------------------------------------------------------------------
+    // Constants
+    // ----------------------------------------------------------------------
+
+    //! Records of the large sequence, several times the buffer size and
+    //! within the capacity of SequenceFiles::Buffers::FileBuffer
+    static const U32 NUM_RECORDS = 150;
+
+    // ----------------------------------------------------------------------
+    // Constructors
+    // ----------------------------------------------------------------------
+
+    CmdSequencerTester ::
+      CmdSequencerTester() :
+        Svc::CmdSequencerTester(SequenceFiles::File::Format::F_PRIME)
+    {
+      this->component.setStreaming(true);
+    }
+
+    // ----------------------------------------------------------------------
+    // Tests
+    // ----------------------------------------------------------------------
+
+    void CmdSequencerTester ::
+      RunLargeSequence()
+    {
+      SequenceFiles::ImmediateFile file(NUM_RECORDS, this->format);
+      // Set the time
+      Fw::Time testTime(TB_WORKSTATION_TIME, 0, 0);
+      this->setTestTime(testTime);
+      // Write the file
+      const char *const fileName = file.getName().toChar();
+      file.write();
+      ASSERT_GT(
+          NUM_RECORDS * SequenceFiles::FPrime::Records::STANDARD_SIZE,
+          static_cast<U32>(BUFFER_SIZE)
+      );
+      // Validate the file
+      this->validateFile(0, fileName);
+      // Run the sequence
+      this->runSequence(0, fileName);
+      this->executeRecords(0, NUM_RECORDS);
+      // Assert events
+      ASSERT_EVENTS_CS_SequenceComplete_SIZE(1);
+      ASSERT_EVENTS_CS_SequenceComplete(0, fileName);
+      ASSERT_EQ(
+          CmdSequencerComponentImpl::STOPPED,
+          this->component.m_runMode
+      );
+    }
+
+    void CmdSequencerTester ::
+      CancelAndRestart()
+    {
+      SequenceFiles::ImmediateFile file(NUM_RECORDS, this->format);
+      // Set the time
+      Fw::Time testTime(TB_WORKSTATION_TIME, 0, 0);
+      this->setTestTime(testTime);
+      // Write the file
+      const char *const fileName = file.getName().toChar();
+      file.write();
+      // Run half the sequence, then cancel it
+      this->runSequence(0, fileName);
+      this->executeRecords(0, NUM_RECORDS / 2);
+      this->cancelSequence(0, fileName);
+      // The loaded sequence runs again from its first record
+      this->runLoadedSequence();
+      Fw::ComBuffer comBuff;
+      CommandBuffers::create(comBuff, 0, 1);
+      ASSERT_from_comCmdOut_SIZE(1);
+      ASSERT_from_comCmdOut(0, comBuff, 0U);
+      this->executeRecords(0, NUM_RECORDS);
+      ASSERT_EVENTS_CS_SequenceComplete_SIZE(1);
+    }
+
+    void CmdSequencerTester ::
+      BadCRC()
+    {
+      SequenceFiles::ImmediateFile file(NUM_RECORDS, this->format);
+      // Set the time
+      Fw::Time testTime(TB_WORKSTATION_TIME, 0, 0);
+      this->setTestTime(testTime);
+      // Write the file with a wrong stored CRC
+      const char *const fileName = file.getName().toChar();
+      SequenceFiles::Buffers::FileBuffer buffer;
+      file.serializeFPrime(buffer);
+      const NATIVE_UINT_TYPE dataSize =
+        buffer.getBuffLength() - SequenceFiles::FPrime::CRCs::SIZE;
+      CmdSequencerComponentImpl::FPrimeSequence::CRC crc;
+      crc.init();
+      crc.update(buffer.getBuffAddr(), dataSize);
+      crc.finalize();
+      crc.m_stored = crc.m_computed + 1;
+      ASSERT_EQ(Fw::FW_SERIALIZE_OK, buffer.setBuffLen(dataSize));
+      ASSERT_EQ(Fw::FW_SERIALIZE_OK, buffer.serialize(crc.m_stored));
+      SequenceFiles::Buffers::write(buffer, fileName);
+      // Validate the file
+      this->sendCmd_CS_VALIDATE(0, 0, fileName);
+      this->clearAndDispatch();
+      ASSERT_CMD_RESPONSE_SIZE(1);
+      ASSERT_CMD_RESPONSE(
+          0,
+          CmdSequencerComponentBase::OPCODE_CS_VALIDATE,
+          0,
+          Fw::CmdResponse::EXECUTION_ERROR
+      );
+      ASSERT_EVENTS_SIZE(1);
+      ASSERT_EVENTS_CS_FileCrcFailure(
+          0,
+          fileName,
+          crc.m_stored,
+          crc.m_computed
+      );
+      // The file was closed
+      ASSERT_TRUE(this->component.m_FPrimeSequence.isInMemory());
+    }
+
+    void CmdSequencerTester ::
+      TruncatedFile()
+    {
+      SequenceFiles::ImmediateFile file(NUM_RECORDS, this->format);
+      // Set the time
+      Fw::Time testTime(TB_WORKSTATION_TIME, 0, 0);
+      this->setTestTime(testTime);
+      // Write half the file
+      const char *const fileName = file.getName().toChar();
+      SequenceFiles::Buffers::FileBuffer buffer;
+      file.serializeFPrime(buffer);
+      const NATIVE_UINT_TYPE fileSize = buffer.getBuffLength() / 2;
+      ASSERT_EQ(Fw::FW_SERIALIZE_OK, buffer.setBuffLen(fileSize));
+      SequenceFiles::Buffers::write(buffer, fileName);
+      // The CRC pass reads whole buffers of records until the file ends
+      const U32 lastReadSize =
+        (fileSize - CmdSequencerComponentImpl::Sequence::Header::SERIALIZED_SIZE) % BUFFER_SIZE;
+      ASSERT_GT(lastReadSize, 0U);
+      // Validate the file
+      this->sendCmd_CS_VALIDATE(0, 0, fileName);
+      this->clearAndDispatch();
+      ASSERT_CMD_RESPONSE_SIZE(1);
+      ASSERT_CMD_RESPONSE(
+          0,
+          CmdSequencerComponentBase::OPCODE_CS_VALIDATE,
+          0,
+          Fw::CmdResponse::EXECUTION_ERROR
+      );
+      ASSERT_EVENTS_SIZE(1);
+      ASSERT_EVENTS_CS_FileInvalid(
+          0,
+          fileName,
+          CmdSequencer_FileReadStage::READ_SEQ_DATA_SIZE,
+          lastReadSize
+      );
+      // The file was closed
+      ASSERT_TRUE(this->component.m_FPrimeSequence.isInMemory());
+    }
+
+    void CmdSequencerTester ::
+      ReadFailure()
+    {
+      SequenceFiles::ImmediateFile file(NUM_RECORDS, this->format);
+      // Set the time
+      Fw::Time testTime(TB_WORKSTATION_TIME, 0, 0);
+      this->setTestTime(testTime);
+      // Write the file and run the sequence
+      const char *const fileName = file.getName().toChar();
+      file.write();
+      this->runSequence(0, fileName);
+      // Fail every read from now on
+      this->interceptor.enable(Interceptor::EnableType::READ);
+      this->interceptor.waitCount = 0;
+      this->interceptor.fileStatus = Os::File::NO_SPACE;
+      this->interceptor.errorType = Interceptor::ErrorType::READ;
+      // Execute the records in the buffer, until reading ahead fails
+      Fw::ComBuffer comBuff;
+      U32 record = 0;
+      do {
+        CommandBuffers::create(comBuff, record, record + 1);
+        ASSERT_from_comCmdOut_SIZE(1);
+        ASSERT_from_comCmdOut(0, comBuff, 0U);
+        this->invoke_to_cmdResponseIn(0, record, 0, Fw::CmdResponse::OK);
+        this->clearAndDispatch();
+        ++record;
+      } while ((this->eventHistory_CS_FileInvalid->size() == 0) and (record < NUM_RECORDS));
+      ASSERT_LT(record, NUM_RECORDS);
+      ASSERT_EVENTS_CS_FileInvalid_SIZE(1);
+      ASSERT_EVENTS_CS_FileInvalid(
+          0,
+          fileName,
+          CmdSequencer_FileReadStage::READ_SEQ_DATA,
+          Os::File::NO_SPACE
+      );
+      // The record read before the failure was still sent
+      CommandBuffers::create(comBuff, record, record + 1);
+      ASSERT_from_comCmdOut_SIZE(1);
+      ASSERT_from_comCmdOut(0, comBuff, 0U);
+      // Its response ends the sequence, which is canceled without reading
+      // the file again
+      this->invoke_to_cmdResponseIn(0, record, 0, Fw::CmdResponse::OK);
+      this->clearAndDispatch();
+      ASSERT_EVENTS_CS_FileInvalid_SIZE(0);
+      ASSERT_EVENTS_CS_SequenceComplete_SIZE(0);
+      ASSERT_from_comCmdOut_SIZE(0);
+      ASSERT_from_seqDone_SIZE(1);
+      ASSERT_from_seqDone(0, 0U, 0U, Fw::CmdResponse(Fw::CmdResponse::EXECUTION_ERROR));
+      ASSERT_EQ(
+          CmdSequencerComponentImpl::STOPPED,
+          this->component.m_runMode
+      );
+      // The file was closed
+      ASSERT_TRUE(this->component.m_FPrimeSequence.readFailed());
+      ASSERT_TRUE(this->component.m_FPrimeSequence.isInMemory());
+      this->interceptor.disable();
+    }
+
+    // ----------------------------------------------------------------------
+    // Helper functions
+    // ----------------------------------------------------------------------
+
+    void CmdSequencerTester ::
+      executeRecords(const U32 first, const U32 count)
+    {
+      Fw::ComBuffer comBuff;
+      for (U32 i = first; i < first + count; i++) {
+        // The command of the record was sent
+        CommandBuffers::create(comBuff, i, i + 1);
+        ASSERT_from_comCmdOut_SIZE(1);
+        ASSERT_from_comCmdOut(0, comBuff, 0U);
+        // Respond, sending the command of the next record
+        this->invoke_to_cmdResponseIn(0, i, 0, Fw::CmdResponse::OK);
+        this->clearAndDispatch();
+        ASSERT_EVENTS_CS_CommandComplete_SIZE(1);
+      }
+    }
+
+  }
+
+}
@@ -0,0 +1,73 @@
+// ======================================================================
+// \title  Streaming.hpp
+// \brief  Test running sequences larger than the sequence buffer
+//
+// \copyright
+// Copyright (C) 2009-2018 California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#ifndef Svc_Streaming_HPP
+#define Svc_Streaming_HPP
+
+#include "CmdSequencerTester.hpp"
+
+namespace Svc {
+
+  namespace Streaming {
+
+    class CmdSequencerTester :
+      public Svc::CmdSequencerTester
+    {
+
+      public:
+
+        // ----------------------------------------------------------------------
+        // Constructors
+        // ----------------------------------------------------------------------
+
+        //! Construct object CmdSequencerTester
+        CmdSequencerTester();
+
+      public:
+
+        // ----------------------------------------------------------------------
+        // Tests
+        // ----------------------------------------------------------------------
+
+        //! Validate and run a sequence several times larger than the buffer
+        void RunLargeSequence();
+
+        //! Cancel a large sequence part way, then run it again from the start
+        void CancelAndRestart();
+
+        //! Validate a large sequence whose stored CRC is wrong
+        void BadCRC();
+
+        //! Validate a large sequence whose file ends before its records
+        void TruncatedFile();
+
+        //! Fail a read while a large sequence runs
+        void ReadFailure();
+
+      private:
+
+        // ----------------------------------------------------------------------
+        // Helper functions
+        // ----------------------------------------------------------------------
+
+        //! Respond to the commands of records, checking each was sent
+        void executeRecords(
+            const U32 first, //!< The first record
+            const U32 count //!< The number of records
+        );
+
+    };
+
+  }
+
+}
+
+#endif
@@ -0,0 +1,156 @@
+// ======================================================================
+// \title  Wheel.cpp
+// \brief  Test waking the sequencer from a timer wheel
+//
+// \copyright
+// Copyright (C) 2009-2018 California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#include "Svc/CmdSequencer/test/ut/Wheel.hpp"
+#include "Svc/CmdSequencer/test/ut/CommandBuffers.hpp"
+
+namespace Svc {
+
+  namespace Wheel {
+
+    // ----------------------------------------------------------------------
+    // Constructors
+    // ----------------------------------------------------------------------
+
+    CmdSequencerTester ::
+      CmdSequencerTester() :
+        Svc::CmdSequencerTester(SequenceFiles::File::Format::F_PRIME)
+    {
+      // timerSet
+      this->component.set_timerSet_OutputPort(
+          0,
+          this->get_from_timerSet(0)
+      );
+      // timerCancel
+      this->component.set_timerCancel_OutputPort(
+          0,
+          this->get_from_timerCancel(0)
+      );
+      // timerExpired
+      this->connect_to_timerExpired(
+          0,
+          this->component.get_timerExpired_InputPort(0)
+      );
+    }
+
+    // ----------------------------------------------------------------------
+    // Tests
+    // ----------------------------------------------------------------------
+
+    void CmdSequencerTester ::
+      RelativeCommands()
+    {
+      REQUIREMENT("ISF-CMDS-009");
+
+      const U32 numRecords = 3;
+      SequenceFiles::RelativeFile file(numRecords, this->format);
+      // Set the time
+      Fw::Time testTime(TB_WORKSTATION_TIME, 1, 0);
+      this->setTestTime(testTime);
+      // Write the file
+      const char *const fileName = file.getName().toChar();
+      file.write();
+      // Validate the file
+      this->validateFile(0, fileName);
+      // Run the sequence. The wheel is armed with the time of the first command.
+      this->runSequence(0, fileName);
+      ASSERT_from_comCmdOut_SIZE(0);
+      ASSERT_from_timerSet_SIZE(1);
+      ASSERT_from_timerSet(0, Fw::Time(TB_WORKSTATION_TIME, 3, 0));
+      // Woken before the time by the clock of the sequencer, the wheel is armed again
+      this->wake(2, Fw::Time(TB_WORKSTATION_TIME, 3, 0));
+      ASSERT_from_comCmdOut_SIZE(0);
+      ASSERT_from_timerSet_SIZE(1);
+      ASSERT_from_timerSet(0, Fw::Time(TB_WORKSTATION_TIME, 3, 0));
+      for (U32 i = 0; i < numRecords; ++i) {
+        const U32 seconds = 2 * i + 3;
+        // Woken at the time, the command is sent and the wheel is armed with its timeout
+        this->wake(seconds, Fw::Time(TB_WORKSTATION_TIME, seconds, 0));
+        Fw::ComBuffer comBuff;
+        CommandBuffers::create(comBuff, i, i + 1);
+        ASSERT_from_comCmdOut_SIZE(1);
+        ASSERT_from_comCmdOut(0, comBuff, 0U);
+        ASSERT_from_timerSet_SIZE(1);
+        ASSERT_from_timerSet(0, Fw::Time(TB_WORKSTATION_TIME, seconds + TIMEOUT, 0));
+        // Send status back
+        this->invoke_to_cmdResponseIn(0, i, 0, Fw::CmdResponse::OK);
+        this->clearAndDispatch();
+        if (i < numRecords - 1) {
+          // The wheel is armed with the time of the next command
+          ASSERT_from_timerSet_SIZE(1);
+          ASSERT_from_timerSet(0, Fw::Time(TB_WORKSTATION_TIME, seconds + 2, 0));
+          ASSERT_from_timerCancel_SIZE(0);
+        }
+        else {
+          // No command waits on time, so the wheel is disarmed
+          ASSERT_from_timerSet_SIZE(0);
+          ASSERT_from_timerCancel_SIZE(1);
+          ASSERT_EVENTS_CS_SequenceComplete_SIZE(1);
+          ASSERT_from_seqDone_SIZE(1);
+          ASSERT_from_seqDone(0, 0U, 0U, Fw::CmdResponse(Fw::CmdResponse::OK));
+        }
+      }
+    }
+
+    void CmdSequencerTester ::
+      TimeoutAndCancel()
+    {
+      SequenceFiles::ImmediateFile immediateFile(1, this->format);
+      SequenceFiles::RelativeFile relativeFile(1, this->format);
+      // Set the time
+      Fw::Time testTime(TB_WORKSTATION_TIME, 1, 1);
+      this->setTestTime(testTime);
+      // Write the files
+      immediateFile.write();
+      relativeFile.write();
+      // Run the immediate sequence. The wheel is armed with the timeout.
+      const char *fileName = immediateFile.getName().toChar();
+      this->runSequence(0, fileName);
+      ASSERT_from_comCmdOut_SIZE(1);
+      ASSERT_from_timerSet_SIZE(1);
+      ASSERT_from_timerSet(0, Fw::Time(TB_WORKSTATION_TIME, 1 + TIMEOUT, 1));
+      // Woken after the timeout, the sequence is cancelled. The wheel
+      // disarmed the timer it woke the sequencer with.
+      this->wake(2 * TIMEOUT, Fw::Time(TB_WORKSTATION_TIME, 1 + TIMEOUT, 1));
+      ASSERT_EVENTS_SIZE(1);
+      ASSERT_EVENTS_CS_SequenceTimeout(0, fileName, 0);
+      ASSERT_EQ(
+          CmdSequencerComponentImpl::STOPPED,
+          this->component.m_runMode
+      );
+      ASSERT_from_timerSet_SIZE(0);
+      ASSERT_from_timerCancel_SIZE(0);
+      // Run the relative sequence, and cancel it while it waits on time
+      fileName = relativeFile.getName().toChar();
+      this->runSequence(0, fileName);
+      ASSERT_from_timerSet_SIZE(1);
+      ASSERT_from_timerSet(0, Fw::Time(TB_WORKSTATION_TIME, 2 * TIMEOUT + 2, 0));
+      this->cancelSequence(0, fileName);
+      ASSERT_from_timerCancel_SIZE(1);
+      ASSERT_from_comCmdOut_SIZE(0);
+    }
+
+    // ----------------------------------------------------------------------
+    // Helper functions
+    // ----------------------------------------------------------------------
+
+    void CmdSequencerTester ::
+      wake(const U32 seconds, const Fw::Time& deadline)
+    {
+      Fw::Time testTime(TB_WORKSTATION_TIME, seconds, 0);
+      this->setTestTime(testTime);
+      this->invoke_to_timerExpired(0, deadline);
+      this->clearAndDispatch();
+    }
+
+  }
+
+}
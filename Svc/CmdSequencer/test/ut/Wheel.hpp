@@ -0,0 +1,66 @@
+// ======================================================================
+// \title  Wheel.hpp
+// \brief  Test waking the sequencer from a timer wheel
+//
+// \copyright
+// Copyright (C) 2009-2018 California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#ifndef Svc_Wheel_HPP
+#define Svc_Wheel_HPP
+
+#include "CmdSequencerTester.hpp"
+
+namespace Svc {
+
+  namespace Wheel {
+
+    class CmdSequencerTester :
+      public Svc::CmdSequencerTester
+    {
+
+      public:
+
+        // ----------------------------------------------------------------------
+        // Constructors
+        // ----------------------------------------------------------------------
+
+        //! Construct object CmdSequencerTester
+        CmdSequencerTester();
+
+      public:
+
+        // ----------------------------------------------------------------------
+        // Tests
+        // ----------------------------------------------------------------------
+
+        //! Run relative commands, each released when the timer wheel wakes
+        //! the sequencer
+        void RelativeCommands();
+
+        //! Time out a command from the timer wheel, and disarm the wheel
+        //! when cancelling a sequence
+        void TimeoutAndCancel();
+
+      private:
+
+        // ----------------------------------------------------------------------
+        // Helper functions
+        // ----------------------------------------------------------------------
+
+        //! Set the time and wake the sequencer from the timer wheel
+        void wake(
+            const U32 seconds, //!< The seconds of the time
+            const Fw::Time& deadline //!< The deadline the wheel was armed with
+        );
+
+    };
+
+  }
+
+}
+
+#endif
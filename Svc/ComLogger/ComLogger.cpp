@@ -23,6 +23,7 @@ namespace Svc {
       m_maxFileSize(maxFileSize),
       m_fileMode(CLOSED),
       m_byteCount(0),
+      m_hashValid(false),
       m_writeErrorOccurred(false),
       m_openErrorOccurred(false),
       m_storeBufferLength(storeBufferLength),
@@ -40,6 +41,7 @@ namespace Svc {
       m_fileName(),
       m_hashFileName(),
       m_byteCount(0),
+      m_hashValid(false),
       m_writeErrorOccurred(false),
       m_openErrorOccurred(false),
       m_storeBufferLength(),
@@ -206,6 +208,10 @@ namespace Svc {
       // Reset byte count:
       this->m_byteCount = 0;
 
+      // Hash the file as it is written:
+      this->m_hash.init();
+      this->m_hashValid = true;
+
       // Set mode:
       this->m_fileMode = OPEN;
     }
@@ -264,6 +270,11 @@ namespace Svc {
   {
     FwSignedSizeType size = length;
     Os::File::Status ret = m_file.write(reinterpret_cast<const U8*>(data), size);
+    if( Os::File::OP_OK == ret ) {
+      this->m_hash.update(data, static_cast<NATIVE_INT_TYPE>(size));
+    } else {
+      this->m_hashValid = false;
+    }
     if( Os::File::OP_OK != ret || size != static_cast<NATIVE_INT_TYPE>(length) ) {
       if( !this->m_writeErrorOccurred ) { // throttle this event, otherwise a positive
                                         // feedback event loop can occur!
@@ -283,7 +294,14 @@ namespace Svc {
     )
   {
     Os::ValidateFile::Status validateStatus;
-    validateStatus = Os::ValidateFile::createValidation(this->m_fileName, this->m_hashFileName);
+    if( this->m_hashValid ) {
+      Utils::HashBuffer hashBuffer;
+      this->m_hash.final(hashBuffer);
+      validateStatus = Os::ValidateFile::createValidationFromHash(this->m_hashFileName, hashBuffer);
+    } else {
+      // The file contents are unknown after a failed write, hash what was actually written:
+      validateStatus = Os::ValidateFile::createValidation(this->m_fileName, this->m_hashFileName);
+    }
     if( Os::ValidateFile::VALIDATION_OK != validateStatus ) {
       Fw::LogStringArg logStringArg1(this->m_fileName);
       Fw::LogStringArg logStringArg2(this->m_hashFileName);
@@ -121,6 +121,8 @@ namespace Svc {
       CHAR m_fileName[MAX_FILENAME_SIZE + MAX_PATH_SIZE];
       CHAR m_hashFileName[MAX_FILENAME_SIZE + MAX_PATH_SIZE];
       U32 m_byteCount;
+      Utils::Hash m_hash; // hash of the bytes written to the open file
+      bool m_hashValid; // false when a failed write may have left unknown bytes in the file
       bool m_writeErrorOccurred;
       bool m_openErrorOccurred;
       bool m_storeBufferLength;
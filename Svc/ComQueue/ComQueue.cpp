@@ -18,18 +18,34 @@ ComQueue ::QueueConfigurationTable ::QueueConfigurationTable() {
     for (NATIVE_UINT_TYPE i = 0; i < FW_NUM_ARRAY_ELEMENTS(this->entries); i++) {
         this->entries[i].priority = 0;
         this->entries[i].depth = 0;
+        this->entries[i].storageSize = 0;
+        this->entries[i].weight = FW_COM_BUFFER_MAX_SIZE;
+        this->entries[i].rateLimit = 0;
     }
+    this->policy = PRIORITY;
+    this->batchMessages = 1;
+    this->batchBytes = 0;
 }
 
 ComQueue ::ComQueue(const char* const compName)
     : ComQueueComponentBase(compName),
       m_state(WAITING),
+      m_policy(PRIORITY),
+      m_roundIndex(0),
+      m_roundCredited(false),
+      m_batchMessages(1),
+      m_batchBytes(0),
+      m_batchSent(0),
+      m_batchOpen(false),
       m_allocationId(-1),
       m_allocator(nullptr),
       m_allocation(nullptr) {
-    // Initialize throttles to "off"
+    // Initialize throttles to "off" and scheduling state to empty
     for (NATIVE_UINT_TYPE i = 0; i < TOTAL_PORT_COUNT; i++) {
         this->m_throttle[i] = false;
+        this->m_deficit[i] = 0;
+        this->m_rateStarted[i] = false;
+        this->m_bytesSent[i] = 0;
     }
 }
 
@@ -57,14 +73,25 @@ void ComQueue::configure(QueueConfigurationTable queueConfig,
     this->m_allocationId = allocationId;
     this->m_allocation = nullptr;
 
+    // Store the scheduling policy and reset its state
+    FW_ASSERT((queueConfig.policy == PRIORITY) || (queueConfig.policy == WEIGHTED_FAIR), queueConfig.policy);
+    this->m_policy = queueConfig.policy;
+    this->m_roundIndex = 0;
+    this->m_roundCredited = false;
+
+    // Store the batching limits
+    FW_ASSERT(queueConfig.batchMessages > 0);
+    this->m_batchMessages = queueConfig.batchMessages;
+    this->m_batchBytes = queueConfig.batchBytes;
+
     // Initializes the sorted queue metadata list in priority (sorted) order. This is accomplished by walking the
     // priority values in priority order from 0 to TOTAL_PORT_COUNT. At each priory value, the supplied queue
     // configuration table is walked and any entry matching the current priority values is used to add queue metadata to
     // the prioritized list. This results in priority-sorted queue metadata objects that index back into the unsorted
     // queue data structures.
     //
-    // The total allocation size is tracked for passing to the allocation call and is a summation of
-    // (depth * message size)  for each prioritized metadata object of (depth * message size)
+    // The total allocation size is tracked for passing to the allocation call and is a summation of the storage size of
+    // each prioritized metadata object
     for (FwIndexType currentPriority = 0; currentPriority < TOTAL_PORT_COUNT; currentPriority++) {
         // Walk each queue configuration entry and add them into the prioritized metadata list when matching the current
         // priority value
@@ -81,10 +108,29 @@ void ComQueue::configure(QueueConfigurationTable queueConfig,
                 entry.priority = queueConfig.entries[entryIndex].priority;
                 entry.depth = queueConfig.entries[entryIndex].depth;
                 entry.index = entryIndex;
+                entry.weight = queueConfig.entries[entryIndex].weight;
+                entry.rateLimit = queueConfig.entries[entryIndex].rateLimit;
+                FW_ASSERT(entry.weight > 0, entryIndex);
+                this->m_deficit[entryIndex] = 0;
+                this->m_rateStarted[entryIndex] = false;
                 // Message size is determined by the type of object being stored, which in turn is determined by the
                 // index of the entry. Those lower than COM_PORT_COUNT are Fw::ComBuffers and those larger Fw::Buffer.
-                entry.msgSize = (entryIndex < COM_PORT_COUNT) ? sizeof(Fw::ComBuffer) : sizeof(Fw::Buffer);
-                totalAllocation += entry.depth * entry.msgSize;
+                // Fw::ComBuffers are stored by their used bytes alone, so message size is the largest possible and
+                // each message carries a length header. Fw::Buffers are already small handles and are stored whole.
+                if (entryIndex < COM_PORT_COUNT) {
+                    entry.msgSize = FW_COM_BUFFER_MAX_SIZE;
+                    entry.storageSize = queueConfig.entries[entryIndex].storageSize;
+                    if (entry.storageSize == 0) {
+                        entry.storageSize = entry.depth * (entry.msgSize + Types::Queue::VARIABLE_HEADER_SIZE);
+                    }
+                    FW_ASSERT((entry.depth == 0) ||
+                                  (entry.storageSize >= (entry.msgSize + Types::Queue::VARIABLE_HEADER_SIZE)),
+                              entry.storageSize, entryIndex);
+                } else {
+                    entry.msgSize = sizeof(Fw::Buffer);
+                    entry.storageSize = entry.depth * entry.msgSize;
+                }
+                totalAllocation += entry.storageSize;
                 currentPriorityIndex++;
             }
         }
@@ -99,14 +145,18 @@ void ComQueue::configure(QueueConfigurationTable queueConfig,
     FwSizeType allocationOffset = 0;
     for (FwIndexType i = 0; i < TOTAL_PORT_COUNT; i++) {
         // Get current queue's allocation size and safety check the values
-        FwSizeType allocationSize = this->m_prioritizedList[i].depth * this->m_prioritizedList[i].msgSize;
+        FwSizeType allocationSize = (this->m_prioritizedList[i].depth > 0) ? this->m_prioritizedList[i].storageSize : 0;
         FW_ASSERT(this->m_prioritizedList[i].index < static_cast<FwIndexType>(FW_NUM_ARRAY_ELEMENTS(this->m_queues)),
                   this->m_prioritizedList[i].index);
         FW_ASSERT((allocationSize + allocationOffset) <= totalAllocation, allocationSize, allocationOffset,
                   totalAllocation);
 
         // Setup queue's memory allocation, depth, and message size. Setup is skipped for a depth 0 queue
-        if (allocationSize > 0) {
+        if ((allocationSize > 0) && (this->m_prioritizedList[i].index < COM_PORT_COUNT)) {
+            this->m_queues[this->m_prioritizedList[i].index].setup_variable(
+                reinterpret_cast<U8*>(this->m_allocation) + allocationOffset, allocationSize,
+                this->m_prioritizedList[i].depth, this->m_prioritizedList[i].msgSize);
+        } else if (allocationSize > 0) {
             this->m_queues[this->m_prioritizedList[i].index].setup(
                 reinterpret_cast<U8*>(this->m_allocation) + allocationOffset, allocationSize,
                 this->m_prioritizedList[i].depth, this->m_prioritizedList[i].msgSize);
@@ -123,7 +173,8 @@ void ComQueue::configure(QueueConfigurationTable queueConfig,
 void ComQueue::comQueueIn_handler(const NATIVE_INT_TYPE portNum, Fw::ComBuffer& data, U32 context) {
     // Ensure that the port number of comQueueIn is consistent with the expectation
     FW_ASSERT(portNum >= 0 && portNum < COM_PORT_COUNT, portNum);
-    this->enqueue(portNum, QueueType::COM_QUEUE, reinterpret_cast<const U8*>(&data), sizeof(Fw::ComBuffer));
+    // Only the used bytes of the buffer are queued, the buffer is rebuilt around them when dequeued
+    this->enqueue(portNum, QueueType::COM_QUEUE, data.getBuffAddr(), data.getBuffLength());
 }
 
 void ComQueue::buffQueueIn_handler(const NATIVE_INT_TYPE portNum, Fw::Buffer& fwBuffer) {
@@ -171,6 +222,26 @@ void ComQueue::run_handler(const NATIVE_INT_TYPE portNum, U32 context) {
         this->m_queues[i + COM_PORT_COUNT].clear_high_water_mark();
     }
     this->tlmWrite_buffQueueDepth(buffQueueDepth);
+
+    // Downlink the bytes sent from each queue since the last report
+    ComQueueBytes comQueueBytes;
+    for (FwSizeType i = 0; i < comQueueBytes.SIZE; i++) {
+        comQueueBytes[i] = this->m_bytesSent[i];
+        this->m_bytesSent[i] = 0;
+    }
+    this->tlmWrite_comQueueBytes(comQueueBytes);
+
+    BuffQueueBytes buffQueueBytes;
+    for (FwSizeType i = 0; i < buffQueueBytes.SIZE; i++) {
+        buffQueueBytes[i] = this->m_bytesSent[i + COM_PORT_COUNT];
+        this->m_bytesSent[i + COM_PORT_COUNT] = 0;
+    }
+    this->tlmWrite_buffQueueBytes(buffQueueBytes);
+
+    // Messages held back by rate limits are released as time passes, so retry when idle
+    if (this->m_state == READY) {
+        this->processQueue();
+    }
 }
 
 // ----------------------------------------------------------------------
@@ -180,9 +251,10 @@ void ComQueue::run_handler(const NATIVE_INT_TYPE portNum, U32 context) {
 void ComQueue::enqueue(const FwIndexType queueNum, QueueType queueType, const U8* data, const FwSizeType size) {
     // Enqueue the given message onto the matching queue. When no space is available then emit the queue overflow event,
     // set the appropriate throttle, and move on. Will assert if passed a message for a depth 0 queue.
-    const FwSizeType expectedSize = (queueType == QueueType::COM_QUEUE) ? sizeof(Fw::ComBuffer) : sizeof(Fw::Buffer);
+    const FwSizeType expectedSize = (queueType == QueueType::COM_QUEUE) ? FW_COM_BUFFER_MAX_SIZE : sizeof(Fw::Buffer);
     const FwIndexType portNum = queueNum - ((queueType == QueueType::COM_QUEUE) ? 0 : COM_PORT_COUNT);
-    FW_ASSERT(expectedSize == size, size, expectedSize);
+    FW_ASSERT((expectedSize == size) || ((queueType == QueueType::COM_QUEUE) && (size <= expectedSize)), size,
+              expectedSize);
     FW_ASSERT(portNum >= 0, portNum);
     Fw::SerializeStatus status = this->m_queues[queueNum].enqueue(data, size);
     if (status == Fw::FW_SERIALIZE_NO_ROOM_LEFT && !this->m_throttle[queueNum]) {
@@ -197,6 +269,7 @@ void ComQueue::enqueue(const FwIndexType queueNum, QueueType queueType, const U8
 
 void ComQueue::sendComBuffer(Fw::ComBuffer& comBuffer) {
     FW_ASSERT(this->m_state == READY);
+    this->openBatch();
     this->comQueueSend_out(0, comBuffer, 0);
     this->m_state = WAITING;
 }
@@ -204,40 +277,83 @@ void ComQueue::sendComBuffer(Fw::ComBuffer& comBuffer) {
 void ComQueue::sendBuffer(Fw::Buffer& buffer) {
     // Retry buffer expected to be cleared as we are either transferring ownership or have already deallocated it.
     FW_ASSERT(this->m_state == READY);
+    this->openBatch();
     this->buffQueueSend_out(0, buffer);
     this->m_state = WAITING;
 }
 
 void ComQueue::processQueue() {
-    FwIndexType priorityIndex = 0;
-    FwIndexType sendPriority = 0;
     // Check that we are in the appropriate state
     FW_ASSERT(this->m_state == READY);
 
+    if (this->m_batchMessages <= 1) {
+        this->processPolicy();
+        return;
+    }
+
+    // Send messages one after another until the batch is full, its byte budget is reached, or nothing more may be sent.
+    // Each send leaves the component WAITING, so it is returned to READY to select the next message. The whole batch is
+    // then answered by a single status from downstream.
+    this->m_batchSent = 0;
+    bool sent = false;
+    for (FwSizeType count = 0; count < this->m_batchMessages; count++) {
+        this->m_state = READY;
+        this->processPolicy();
+        if (this->m_state == READY) {
+            break;
+        }
+        sent = true;
+        if ((this->m_batchBytes > 0) && (this->m_batchSent >= this->m_batchBytes)) {
+            break;
+        }
+    }
+    this->m_state = sent ? WAITING : READY;
+
+    // Close the batch so that downstream reports its status
+    if (this->m_batchOpen) {
+        this->m_batchOpen = false;
+        this->comBatchOut_out(0, false);
+    }
+}
+
+void ComQueue::openBatch() {
+    if ((this->m_batchMessages > 1) && !this->m_batchOpen) {
+        FW_ASSERT(this->isConnected_comBatchOut_OutputPort(0));
+        this->m_batchOpen = true;
+        this->comBatchOut_out(0, true);
+    }
+}
+
+void ComQueue::processPolicy() {
+    switch (this->m_policy) {
+        case PRIORITY:
+            this->processPriority();
+            break;
+        case WEIGHTED_FAIR:
+            this->processWeightedFair();
+            break;
+        default:
+            FW_ASSERT(0, this->m_policy);
+            break;
+    }
+}
+
+void ComQueue::processPriority() {
+    FwIndexType priorityIndex = 0;
+    FwIndexType sendPriority = 0;
+
     // Walk all the queues in priority order. Send the first message that is available in priority order. No balancing
     // is done within this loop.
     for (priorityIndex = 0; priorityIndex < TOTAL_PORT_COUNT; priorityIndex++) {
         QueueMetadata& entry = this->m_prioritizedList[priorityIndex];
         Types::Queue& queue = this->m_queues[entry.index];
 
-        // Continue onto next prioritized queue if there is no items in the current queue
-        if (queue.getQueueSize() == 0) {
+        // Continue onto next prioritized queue if there is no items in the current queue or it is over its rate limit
+        if ((queue.getQueueSize() == 0) || !this->takeRateToken(entry)) {
             continue;
         }
 
-        // Send out the message based on the type
-        if (entry.index < COM_PORT_COUNT) {
-            Fw::ComBuffer comBuffer;
-            queue.dequeue(reinterpret_cast<U8*>(&comBuffer), sizeof(comBuffer));
-            this->sendComBuffer(comBuffer);
-        } else {
-            Fw::Buffer buffer;
-            queue.dequeue(reinterpret_cast<U8*>(&buffer), sizeof(buffer));
-            this->sendBuffer(buffer);
-        }
-
-        // Update the throttle and the index that was just sent
-        this->m_throttle[entry.index] = false;
+        this->sendQueued(entry.index);
 
         // Priority used in the next loop
         sendPriority = entry.priority;
@@ -256,4 +372,109 @@ void ComQueue::processQueue() {
         this->m_prioritizedList[priorityIndex - 1] = temp;
     }
 }
+
+void ComQueue::processWeightedFair() {
+    // Deficit round-robin: each time a queue's turn comes around it is credited its weight in bytes, and it keeps the
+    // turn while its credit covers the message at its front. Unused credit carries over to the queue's next turn so
+    // large messages are sent once enough has built up, and is dropped when the queue empties. The turn survives between
+    // calls, as only one message is sent per call.
+    //
+    // Passes over the queues repeat while some queue is still building credit for its next message. Every such pass
+    // credits that queue, so this terminates once a message is sent or no queue can send.
+    bool building = true;
+    while (building) {
+        building = false;
+        for (FwIndexType visited = 0; visited < TOTAL_PORT_COUNT; visited++) {
+            QueueMetadata& entry = this->m_prioritizedList[this->m_roundIndex];
+            Types::Queue& queue = this->m_queues[entry.index];
+            FwSizeType& deficit = this->m_deficit[entry.index];
+
+            if (queue.getQueueSize() > 0) {
+                if (!this->m_roundCredited) {
+                    deficit += entry.weight;
+                    this->m_roundCredited = true;
+                }
+                const FwSizeType size = this->headDataSize(entry.index);
+                if (deficit < size) {
+                    building = true;
+                } else if (this->takeRateToken(entry)) {
+                    deficit -= size;
+                    this->sendQueued(entry.index);
+                    return;
+                } else {
+                    // Held back by its rate limit, keep only the credit for its next message
+                    deficit = size;
+                }
+            } else {
+                deficit = 0;
+            }
+
+            // Move the turn on to the next queue
+            this->m_roundIndex = (this->m_roundIndex + 1) % TOTAL_PORT_COUNT;
+            this->m_roundCredited = false;
+        }
+    }
+}
+
+void ComQueue::sendQueued(const FwIndexType queueNum) {
+    FW_ASSERT(queueNum >= 0 && queueNum < TOTAL_PORT_COUNT, queueNum);
+    Types::Queue& queue = this->m_queues[queueNum];
+
+    // Send out the message based on the type
+    if (queueNum < COM_PORT_COUNT) {
+        Fw::ComBuffer comBuffer;
+        FwSizeType size = 0;
+        queue.dequeue(comBuffer.getBuffAddr(), comBuffer.getBuffCapacity(), size);
+        Fw::SerializeStatus status = comBuffer.setBuffLen(static_cast<Fw::Serializable::SizeType>(size));
+        FW_ASSERT(status == Fw::FW_SERIALIZE_OK, status);
+        this->m_bytesSent[queueNum] += static_cast<U32>(size);
+        this->m_batchSent += size;
+        this->sendComBuffer(comBuffer);
+    } else {
+        Fw::Buffer buffer;
+        queue.dequeue(reinterpret_cast<U8*>(&buffer), sizeof(buffer));
+        this->m_bytesSent[queueNum] += buffer.getSize();
+        this->m_batchSent += buffer.getSize();
+        this->sendBuffer(buffer);
+    }
+
+    // Update the throttle of the queue that was just sent
+    this->m_throttle[queueNum] = false;
+}
+
+FwSizeType ComQueue::headDataSize(const FwIndexType queueNum) {
+    FW_ASSERT(queueNum >= 0 && queueNum < TOTAL_PORT_COUNT, queueNum);
+    Types::Queue& queue = this->m_queues[queueNum];
+
+    // Fw::ComBuffers are queued as their data, Fw::Buffers as a handle to their data
+    if (queueNum < COM_PORT_COUNT) {
+        return queue.getHeadSize();
+    }
+    Fw::Buffer buffer;
+    Fw::SerializeStatus status = queue.peek(reinterpret_cast<U8*>(&buffer), sizeof(buffer));
+    FW_ASSERT(status == Fw::FW_SERIALIZE_OK, status);
+    return buffer.getSize();
+}
+
+bool ComQueue::takeRateToken(const QueueMetadata& entry) {
+    if (entry.rateLimit == 0) {
+        return true;
+    }
+    const Fw::Time now = this->getTime();
+    // Buckets start full on first use, anchored to the time base in use by the system. Times in different bases or
+    // contexts cannot be compared, so a bucket is re-anchored with its remaining tokens when the time base changes.
+    if (!this->m_rateStarted[entry.index]) {
+        this->m_rateLimits[entry.index] = Utils::TokenBucket(RATE_LIMIT_INTERVAL, entry.rateLimit, entry.rateLimit,
+                                                             entry.rateLimit, now);
+        this->m_rateStarted[entry.index] = true;
+        this->m_rateTime[entry.index] = now;
+    } else if ((now.getTimeBase() != this->m_rateTime[entry.index].getTimeBase()) ||
+               (now.getContext() != this->m_rateTime[entry.index].getContext())) {
+        const U32 tokens = this->m_rateLimits[entry.index].getTokens();
+        this->m_rateLimits[entry.index] =
+            Utils::TokenBucket(RATE_LIMIT_INTERVAL, entry.rateLimit, entry.rateLimit, tokens, now);
+        this->m_rateTime[entry.index] = now;
+    }
+    return this->m_rateLimits[entry.index].trigger(now);
+}
 }  // end namespace Svc
@@ -10,6 +10,7 @@
 #include <Fw/Buffer/Buffer.hpp>
 #include <Fw/Com/ComBuffer.hpp>
 #include <Svc/ComQueue/ComQueueComponentAc.hpp>
+#include <Utils/TokenBucket.hpp>
 #include <Utils/Types/Queue.hpp>
 #include "Fw/Types/MemAllocator.hpp"
 #include "Os/Mutex.hpp"
@@ -31,6 +32,21 @@ class ComQueue : public ComQueueComponentBase {
     //!< Total count of input buffer ports and thus total queues
     static const FwIndexType TOTAL_PORT_COUNT = COM_PORT_COUNT + BUFFER_PORT_COUNT;
 
+    //!< Replenish interval of the per-queue rate limits in microseconds
+    static const U32 RATE_LIMIT_INTERVAL = 1000000;
+
+    /**
+     * \brief policy used to choose which queue sends next
+     *
+     * PRIORITY always services the lowest priority value with a message waiting, balancing between queues of the same
+     * priority. WEIGHTED_FAIR shares the link between all queues with messages waiting in proportion to their weights,
+     * counted in bytes, regardless of priority. Priority then only sets the order queues are visited in each round.
+     */
+    enum SchedulingPolicy {
+        PRIORITY,      //!< Strict priority, round-robin between equal priorities
+        WEIGHTED_FAIR  //!< Deficit round-robin weighted by bytes
+    };
+
     /**
      * \brief configuration data for each queue
      *
@@ -41,10 +57,22 @@ class ComQueue : public ComQueueComponentBase {
      * Priority is an integer between 0 (inclusive) and TOTAL_PORT_COUNT (exclusive). Queues with lower priority values
      * will be serviced first. Priorities may be repeated and queues sharing priorities will be serviced in a balanced
      * manner.
+     *
+     * Fw::Com queues store only the used bytes of each message. Storage size optionally sets the bytes of memory given to
+     * such a queue, which then overflows when either depth messages are held or the next message does not fit. Storage
+     * size must be able to hold at least one full Fw::ComBuffer. A storage size of 0 allocates enough for depth full
+     * Fw::ComBuffers. Storage size is ignored for Fw::Buffer queues.
+     *
+     * Weight is the count of bytes a queue may send in each round of WEIGHTED_FAIR scheduling and must be non-zero.
+     * Rate limit caps the messages per second sent from a queue under either policy, with 0 leaving the queue
+     * unlimited. Rate limits require the Time port to be connected.
      */
     struct QueueConfigurationEntry {
-        FwSizeType depth;      //!< Depth of the queue [0, infinity)
-        FwIndexType priority;  //!< Priority of the queue [0, TOTAL_PORT_COUNT)
+        FwSizeType depth;        //!< Depth of the queue [0, infinity)
+        FwIndexType priority;    //!< Priority of the queue [0, TOTAL_PORT_COUNT)
+        FwSizeType storageSize;  //!< Storage bytes for a Fw::Com queue, 0 to hold depth full buffers
+        U32 weight;              //!< Bytes sent per round under WEIGHTED_FAIR scheduling (0, infinity)
+        U32 rateLimit;           //!< Messages per second allowed from the queue, 0 for unlimited
     };
 
     /**
@@ -54,12 +82,21 @@ class ComQueue : public ComQueueComponentBase {
      * port-by-port configuration information for the associated queue. Each entry specifies the queue's depth and
      * priority.
      *
-     * Entries are specified in-order first addressing Fw::Com ports then Fw::Buffer ports.
+     * Entries are specified in-order first addressing Fw::Com ports then Fw::Buffer ports. The policy applies to all
+     * queues.
+     *
+     * Batch messages sets the most messages sent for each Fw::Success::SUCCESS status. Batches larger than one are
+     * bracketed by calls to comBatchOut, which must be connected to a component answering each batch with a single
+     * status. A batch also ends once it carries batch bytes of data, unless batch bytes is 0.
      */
     struct QueueConfigurationTable {
         QueueConfigurationEntry entries[TOTAL_PORT_COUNT];
+        SchedulingPolicy policy;  //!< Policy choosing the next queue to send from
+        FwSizeType batchMessages;  //!< Most messages sent per status [1, infinity)
+        FwSizeType batchBytes;     //!< Bytes of data ending a batch, 0 for unlimited
         /**
-         * \brief constructs a basic un-prioritized table with depth 0
+         * \brief constructs a basic un-prioritized, un-limited, un-batched, PRIORITY scheduled table with depth 0 and
+         * weights of one full Fw::ComBuffer
          */
         QueueConfigurationTable();
     };
@@ -72,13 +109,16 @@ class ComQueue : public ComQueueComponentBase {
     /**
      * Storage for internal queue metadata. This is stored in the prioritized list and contains indices to the the
      * un-prioritized queue objects. Depth and priority is copied from the configuration supplied by the configure
-     * method. Index and message size are calculated by the configuration call.
+     * method. Index, message size, and storage size are calculated by the configuration call.
      */
     struct QueueMetadata {
-        FwSizeType depth;      //!< Depth of the queue in messages
-        FwIndexType priority;  //!< Priority of the queue
-        FwIndexType index;     //!< Index of this queue in the prioritized list
-        FwSizeType msgSize;    //!< Message size of messages in this queue
+        FwSizeType depth;        //!< Depth of the queue in messages
+        FwIndexType priority;    //!< Priority of the queue
+        FwIndexType index;       //!< Index of this queue in the prioritized list
+        FwSizeType msgSize;      //!< Message size, or largest message size, of messages in this queue
+        FwSizeType storageSize;  //!< Bytes of memory allocated to this queue
+        U32 weight;              //!< Bytes credited to this queue each WEIGHTED_FAIR round
+        U32 rateLimit;           //!< Messages per second allowed from this queue, 0 for unlimited
     };
 
     /**
@@ -173,9 +213,41 @@ class ComQueue : public ComQueueComponentBase {
     void sendBuffer(Fw::Buffer& buffer  //!< Reference to buffer to send
     );
 
-    //! Process the queues to select the next priority message
+    //! Start a batch on comBatchOut ahead of its first message, when batching
+    //!
+    void openBatch();
+
+    //! Process the queues to send the next message, or batch of messages, according to the scheduling policy
     //!
     void processQueue();
+
+    //! Select and send the next message according to the scheduling policy
+    //!
+    void processPolicy();
+
+    //! Select and send the next message by strict priority
+    //!
+    void processPriority();
+
+    //! Select and send the next message by deficit round-robin
+    //!
+    void processWeightedFair();
+
+    //! Dequeue and send the message at the front of the given queue
+    //!
+    void sendQueued(const FwIndexType queueNum  //!< Index of the queue to send from
+    );
+
+    //! Size in bytes of the data carried by the message at the front of the given queue
+    //!
+    FwSizeType headDataSize(const FwIndexType queueNum  //!< Index of the queue to inspect
+    );
+
+    //! Check and consume the rate limit allowance of a queue for one message
+    //!
+    //! \return true when the queue may send now
+    bool takeRateToken(const QueueMetadata& entry  //!< Metadata of the queue about to send
+    );
     // ----------------------------------------------------------------------
     // Member variables
     // ----------------------------------------------------------------------
@@ -183,6 +255,22 @@ class ComQueue : public ComQueueComponentBase {
     QueueMetadata m_prioritizedList[TOTAL_PORT_COUNT];  //!< Priority sorted list of queue metadata
     bool m_throttle[TOTAL_PORT_COUNT];  //!< Per-queue EVR throttles
     SendState m_state;  //!< State of the component
+    SchedulingPolicy m_policy;  //!< Policy choosing the next queue to send from
+
+    // Scheduling state
+    FwSizeType m_deficit[TOTAL_PORT_COUNT];  //!< Per-queue bytes credited but not yet sent under WEIGHTED_FAIR
+    FwIndexType m_roundIndex;  //!< Prioritized list index of the queue being serviced under WEIGHTED_FAIR
+    bool m_roundCredited;  //!< The queue being serviced has received its weight for this visit
+    Utils::TokenBucket m_rateLimits[TOTAL_PORT_COUNT];  //!< Per-queue rate limits
+    bool m_rateStarted[TOTAL_PORT_COUNT];  //!< Rate limit has been anchored to the current time
+    Fw::Time m_rateTime[TOTAL_PORT_COUNT];  //!< Time the rate limit was anchored to, for its base and context
+    U32 m_bytesSent[TOTAL_PORT_COUNT];  //!< Per-queue bytes sent since the last telemetry report
+
+    // Batching state
+    FwSizeType m_batchMessages;  //!< Most messages sent per status
+    FwSizeType m_batchBytes;  //!< Bytes of data ending a batch, 0 for unlimited
+    FwSizeType m_batchSent;  //!< Bytes of data sent in the current batch
+    bool m_batchOpen;  //!< A batch has been started on comBatchOut
 
     // Storage for Fw::MemAllocator properties
     NATIVE_UINT_TYPE m_allocationId;  //!< Component's allocation ID
@@ -29,6 +29,31 @@ TEST(Nominal, ReadyFirst) {
     tester.testReadyFirst();
 }
 
+TEST(Nominal, CompactStorage) {
+    Svc::ComQueueTester tester;
+    tester.testCompactStorage();
+}
+
+TEST(Nominal, WeightedFair) {
+    Svc::ComQueueTester tester;
+    tester.testWeightedFair();
+}
+
+TEST(Nominal, RateLimit) {
+    Svc::ComQueueTester tester;
+    tester.testRateLimit();
+}
+
+TEST(Nominal, RateLimitTimeBase) {
+    Svc::ComQueueTester tester;
+    tester.testRateLimitTimeBase();
+}
+
+TEST(Nominal, BatchSend) {
+    Svc::ComQueueTester tester;
+    tester.testBatchSend();
+}
+
 int main(int argc, char **argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
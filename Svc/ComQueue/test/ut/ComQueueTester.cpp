@@ -267,6 +267,256 @@ void ComQueueTester ::testReadyFirst() {
     component.cleanup();
 }
 
+void ComQueueTester ::testCompactStorage() {
+    U8 data[BUFFER_LENGTH] = {0xde, 0xad, 0xbe};
+    ComQueue::QueueConfigurationTable configurationTable;
+    for (NATIVE_UINT_TYPE i = 0; i < ComQueue::TOTAL_PORT_COUNT; i++) {
+        configurationTable.entries[i].priority = i;
+        configurationTable.entries[i].depth = 3;
+    }
+    // Give the first queue room for one full buffer, but a depth well beyond that
+    const FwSizeType recordSize = Types::Queue::VARIABLE_HEADER_SIZE;
+    configurationTable.entries[0].depth = 1000;
+    configurationTable.entries[0].storageSize = FW_COM_BUFFER_MAX_SIZE + recordSize;
+    component.configure(configurationTable, 0, mallocAllocator);
+
+    // Short messages take only their own length, so many more fit than full buffers would. Vary the length to check
+    // that each message is rebuilt at the size it was sent.
+    FwSizeType used = 0;
+    NATIVE_UINT_TYPE count = 0;
+    while (used + (count % BUFFER_LENGTH) + 1 + recordSize <= configurationTable.entries[0].storageSize) {
+        Fw::ComBuffer comBuffer(&data[0], (count % BUFFER_LENGTH) + 1);
+        invoke_to_comQueueIn(0, comBuffer, 0);
+        dispatchAll();
+        used += (count % BUFFER_LENGTH) + 1 + recordSize;
+        count++;
+    }
+    ASSERT_GT(count, 1u);
+    ASSERT_EVENTS_QueueOverflow_SIZE(0);
+
+    // The next message no longer fits in storage
+    Fw::ComBuffer overflow(&data[0], BUFFER_LENGTH);
+    invoke_to_comQueueIn(0, overflow, 0);
+    dispatchAll();
+    ASSERT_EVENTS_QueueOverflow_SIZE(1);
+    ASSERT_EVENTS_QueueOverflow(0, QueueType::COM_QUEUE, 0);
+
+    // Drain the queue and check each message came out whole
+    for (NATIVE_UINT_TYPE i = 0; i < count; i++) {
+        Fw::ComBuffer expected(&data[0], (i % BUFFER_LENGTH) + 1);
+        emitOne();
+        ASSERT_from_comQueueSend_SIZE(i + 1);
+        ASSERT_from_comQueueSend(i, expected, 0);
+    }
+    emitOne();
+    ASSERT_from_comQueueSend_SIZE(count);
+
+    // Depth is reported in messages
+    ComQueueDepth expectedComDepth;
+    for (FwSizeType i = 0; i < expectedComDepth.SIZE; i++) {
+        expectedComDepth[i] = 0;
+    }
+    expectedComDepth[0] = count;
+    invoke_to_run(0, 0);
+    dispatchAll();
+    ASSERT_TLM_comQueueDepth_SIZE(1);
+    ASSERT_TLM_comQueueDepth(0, expectedComDepth);
+    clearFromPortHistory();
+    component.cleanup();
+}
+
+void ComQueueTester ::testWeightedFair() {
+    U8 data[2][BUFFER_LENGTH] = {{0, 0, 0}, {1, 1, 1}};
+    ComQueue::QueueConfigurationTable configurationTable;
+    for (NATIVE_UINT_TYPE i = 0; i < ComQueue::TOTAL_PORT_COUNT; i++) {
+        configurationTable.entries[i].priority = i;
+        configurationTable.entries[i].depth = 6;
+    }
+    // The higher priority queue gets twice the bytes of the lower one rather than all of them
+    configurationTable.policy = ComQueue::WEIGHTED_FAIR;
+    configurationTable.entries[0].weight = 2 * BUFFER_LENGTH;
+    configurationTable.entries[1].weight = BUFFER_LENGTH;
+    component.configure(configurationTable, 0, mallocAllocator);
+
+    for (NATIVE_UINT_TYPE i = 0; i < 6; i++) {
+        Fw::ComBuffer first(&data[0][0], BUFFER_LENGTH);
+        Fw::ComBuffer second(&data[1][0], BUFFER_LENGTH);
+        invoke_to_comQueueIn(0, first, 0);
+        invoke_to_comQueueIn(1, second, 0);
+    }
+    dispatchAll();
+
+    // Two messages from the first queue for each one from the second, until the first runs dry
+    const U8 expectedOrder[12] = {0, 0, 1, 0, 0, 1, 0, 0, 1, 1, 1, 1};
+    for (NATIVE_UINT_TYPE i = 0; i < FW_NUM_ARRAY_ELEMENTS(expectedOrder); i++) {
+        emitOne();
+        ASSERT_from_comQueueSend_SIZE(i + 1);
+        ASSERT_EQ(expectedOrder[i], fromPortHistory_comQueueSend->at(i).data.getBuffAddr()[0]);
+    }
+    emitOne();
+    ASSERT_from_comQueueSend_SIZE(12);
+
+    // Throughput is reported per queue
+    ComQueueBytes expectedBytes;
+    for (FwSizeType i = 0; i < expectedBytes.SIZE; i++) {
+        expectedBytes[i] = 0;
+    }
+    expectedBytes[0] = 6 * BUFFER_LENGTH;
+    expectedBytes[1] = 6 * BUFFER_LENGTH;
+    invoke_to_run(0, 0);
+    dispatchAll();
+    ASSERT_TLM_comQueueBytes_SIZE(1);
+    ASSERT_TLM_comQueueBytes(0, expectedBytes);
+    clearFromPortHistory();
+    component.cleanup();
+}
+
+void ComQueueTester ::testRateLimit() {
+    U8 data[2][BUFFER_LENGTH] = {{0, 0, 0}, {1, 1, 1}};
+    ComQueue::QueueConfigurationTable configurationTable;
+    for (NATIVE_UINT_TYPE i = 0; i < ComQueue::TOTAL_PORT_COUNT; i++) {
+        configurationTable.entries[i].priority = i;
+        configurationTable.entries[i].depth = 3;
+    }
+    // Cap the highest priority queue at two messages per second
+    configurationTable.entries[0].rateLimit = 2;
+    component.configure(configurationTable, 0, mallocAllocator);
+    this->setTestTime(Fw::Time(TB_PROC_TIME, 1, 0));
+
+    Fw::ComBuffer first(&data[0][0], BUFFER_LENGTH);
+    Fw::ComBuffer second(&data[1][0], BUFFER_LENGTH);
+    for (NATIVE_UINT_TYPE i = 0; i < 3; i++) {
+        invoke_to_comQueueIn(0, first, 0);
+    }
+    invoke_to_comQueueIn(1, second, 0);
+    dispatchAll();
+
+    // The limited queue sends its allowance, then the lower priority queue gets through
+    emitOne();
+    emitOne();
+    emitOne();
+    ASSERT_from_comQueueSend_SIZE(3);
+    ASSERT_from_comQueueSend(0, first, 0);
+    ASSERT_from_comQueueSend(1, first, 0);
+    ASSERT_from_comQueueSend(2, second, 0);
+
+    // Nothing more may be sent until the limit is replenished
+    emitOne();
+    ASSERT_from_comQueueSend_SIZE(3);
+    invoke_to_run(0, 0);
+    dispatchAll();
+    ASSERT_from_comQueueSend_SIZE(3);
+
+    // A second later the held message is released by the run port
+    this->setTestTime(Fw::Time(TB_PROC_TIME, 2, 0));
+    invoke_to_run(0, 0);
+    dispatchAll();
+    ASSERT_from_comQueueSend_SIZE(4);
+    ASSERT_from_comQueueSend(3, first, 0);
+    clearFromPortHistory();
+    component.cleanup();
+}
+
+void ComQueueTester ::testRateLimitTimeBase() {
+    U8 data[BUFFER_LENGTH] = {0xde, 0xad, 0xbe};
+    ComQueue::QueueConfigurationTable configurationTable;
+    for (NATIVE_UINT_TYPE i = 0; i < ComQueue::TOTAL_PORT_COUNT; i++) {
+        configurationTable.entries[i].priority = i;
+        configurationTable.entries[i].depth = 5;
+    }
+    configurationTable.entries[0].rateLimit = 2;
+    component.configure(configurationTable, 0, mallocAllocator);
+    this->setTestTime(Fw::Time(TB_PROC_TIME, 1, 0));
+
+    Fw::ComBuffer comBuffer(&data[0], sizeof(data));
+    for (NATIVE_UINT_TYPE i = 0; i < 5; i++) {
+        invoke_to_comQueueIn(0, comBuffer, 0);
+    }
+    dispatchAll();
+    emitOne();
+    emitOne();
+    emitOne();
+    ASSERT_from_comQueueSend_SIZE(2);
+
+    // Switching time base carries the spent allowance over rather than granting a fresh one
+    this->setTestTime(Fw::Time(TB_WORKSTATION_TIME, 100, 0));
+    invoke_to_run(0, 0);
+    dispatchAll();
+    ASSERT_from_comQueueSend_SIZE(2);
+
+    // The limit replenishes in the new time base
+    this->setTestTime(Fw::Time(TB_WORKSTATION_TIME, 101, 0));
+    invoke_to_run(0, 0);
+    dispatchAll();
+    emitOne();
+    ASSERT_from_comQueueSend_SIZE(4);
+
+    // As it does when the time context changes
+    this->setTestTime(Fw::Time(TB_WORKSTATION_TIME, 1, 0, 0));
+    emitOne();
+    ASSERT_from_comQueueSend_SIZE(4);
+    this->setTestTime(Fw::Time(TB_WORKSTATION_TIME, 1, 2, 0));
+    invoke_to_run(0, 0);
+    dispatchAll();
+    ASSERT_from_comQueueSend_SIZE(5);
+    clearFromPortHistory();
+    component.cleanup();
+}
+
+void ComQueueTester ::testBatchSend() {
+    U8 data[BUFFER_LENGTH] = {0xde, 0xad, 0xbe};
+    Fw::ComBuffer comBuffer(&data[0], sizeof(data));
+    ComQueue::QueueConfigurationTable configurationTable;
+    for (NATIVE_UINT_TYPE i = 0; i < ComQueue::TOTAL_PORT_COUNT; i++) {
+        configurationTable.entries[i].priority = i;
+        configurationTable.entries[i].depth = 5;
+    }
+    configurationTable.batchMessages = 3;
+    component.configure(configurationTable, 0, mallocAllocator);
+
+    for (NATIVE_UINT_TYPE i = 0; i < 4; i++) {
+        invoke_to_comQueueIn(0, comBuffer, 0);
+    }
+    dispatchAll();
+
+    // A single status releases a full batch, bracketed on the batch port
+    emitOne();
+    ASSERT_from_comQueueSend_SIZE(3);
+    ASSERT_from_comBatchOut_SIZE(2);
+    ASSERT_from_comBatchOut(0, true);
+    ASSERT_from_comBatchOut(1, false);
+
+    // The next status releases what remains
+    emitOne();
+    ASSERT_from_comQueueSend_SIZE(4);
+    ASSERT_from_comBatchOut_SIZE(4);
+    ASSERT_from_comBatchOut(2, true);
+    ASSERT_from_comBatchOut(3, false);
+
+    // Nothing is left, so no batch is started
+    emitOne();
+    ASSERT_from_comQueueSend_SIZE(4);
+    ASSERT_from_comBatchOut_SIZE(4);
+    clearFromPortHistory();
+    component.cleanup();
+
+    // A byte budget ends the batch early. The component is idle, so the first message goes out at once as a batch of
+    // its own.
+    configurationTable.batchBytes = 2 * BUFFER_LENGTH;
+    component.configure(configurationTable, 0, mallocAllocator);
+    for (NATIVE_UINT_TYPE i = 0; i < 4; i++) {
+        invoke_to_comQueueIn(0, comBuffer, 0);
+    }
+    dispatchAll();
+    ASSERT_from_comQueueSend_SIZE(1);
+    ASSERT_from_comBatchOut_SIZE(2);
+    emitOne();
+    ASSERT_from_comQueueSend_SIZE(3);
+    ASSERT_from_comBatchOut_SIZE(4);
+    clearFromPortHistory();
+    component.cleanup();
+}
+
 // ----------------------------------------------------------------------
 // Handlers for typed from ports
 // ----------------------------------------------------------------------
@@ -279,6 +529,10 @@ void ComQueueTester ::from_comQueueSend_handler(const NATIVE_INT_TYPE portNum, F
     this->pushFromPortEntry_comQueueSend(data, context);
 }
 
+void ComQueueTester ::from_comBatchOut_handler(const NATIVE_INT_TYPE portNum, bool start) {
+    this->pushFromPortEntry_comBatchOut(start);
+}
+
 // ----------------------------------------------------------------------
 // Helper methods
 // ----------------------------------------------------------------------
@@ -317,6 +571,9 @@ void ComQueueTester ::connectPorts() {
 
     // comQueueSend
     this->component.set_comQueueSend_OutputPort(0, this->get_from_comQueueSend(0));
+
+    // comBatchOut
+    this->component.set_comBatchOut_OutputPort(0, this->get_from_comBatchOut(0));
 }
 
 void ComQueueTester ::initComponents() {
@@ -61,6 +61,16 @@ class ComQueueTester : public ComQueueGTestBase {
 
     void testReadyFirst();
 
+    void testCompactStorage();
+
+    void testWeightedFair();
+
+    void testRateLimit();
+
+    void testRateLimitTimeBase();
+
+    void testBatchSend();
+
   private:
     // ----------------------------------------------------------------------
     // Handlers for typed from ports
@@ -78,6 +88,12 @@ class ComQueueTester : public ComQueueGTestBase {
                                    U32 context                    /*!< Call context value; meaning chosen by user*/
     );
 
+    //! Handler for from_comBatchOut
+    //!
+    void from_comBatchOut_handler(const NATIVE_INT_TYPE portNum, /*!< The port number*/
+                                  bool start                     /*!< True before the first message of the batch*/
+    );
+
   private:
     // ----------------------------------------------------------------------
     // Helper methods
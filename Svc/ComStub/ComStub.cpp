@@ -14,7 +14,8 @@ namespace Svc {
 // Construction, initialization, and destruction
 // ----------------------------------------------------------------------
 
-ComStub::ComStub(const char* const compName) : ComStubComponentBase(compName), m_reinitialize(true) {}
+ComStub::ComStub(const char* const compName)
+    : ComStubComponentBase(compName), m_reinitialize(true), m_inBatch(false), m_batchFailed(false) {}
 
 void ComStub::init(const NATIVE_INT_TYPE instance) {
     ComStubComponentBase::init(instance);
@@ -27,20 +28,45 @@ ComStub::~ComStub() {}
 // ----------------------------------------------------------------------
 
 Drv::SendStatus ComStub::comDataIn_handler(const NATIVE_INT_TYPE portNum, Fw::Buffer& sendBuffer) {
-    FW_ASSERT(!this->m_reinitialize || !this->isConnected_comStatus_OutputPort(0));  // A message should never get here if we need to reinitialize is needed
+    // A message should never get here if we need to reinitialize is needed. Within a batch, the rest of the batch still
+    // arrives after a failed send and is passed on to the driver.
+    FW_ASSERT(!this->m_reinitialize || !this->isConnected_comStatus_OutputPort(0) || this->m_inBatch);
     Drv::SendStatus driverStatus = Drv::SendStatus::SEND_RETRY;
     for (NATIVE_UINT_TYPE i = 0; driverStatus == Drv::SendStatus::SEND_RETRY && i < RETRY_LIMIT; i++) {
         driverStatus = this->drvDataOut_out(0, sendBuffer);
     }
     FW_ASSERT(driverStatus != Drv::SendStatus::SEND_RETRY);  // If it is still in retry state, there is no good answer
-    Fw::Success comSuccess = (driverStatus.e == Drv::SendStatus::SEND_OK) ? Fw::Success::SUCCESS : Fw::Success::FAILURE;
-    this->m_reinitialize = driverStatus.e != Drv::SendStatus::SEND_OK;
+    const bool failed = driverStatus.e != Drv::SendStatus::SEND_OK;
+    // Statuses within a batch are held and reported once when the batch ends
+    if (this->m_inBatch) {
+        this->m_batchFailed = this->m_batchFailed || failed;
+        this->m_reinitialize = this->m_batchFailed;
+        return Drv::SendStatus::SEND_OK;
+    }
+    Fw::Success comSuccess = failed ? Fw::Success::FAILURE : Fw::Success::SUCCESS;
+    this->m_reinitialize = failed;
     if (this->isConnected_comStatus_OutputPort(0)) {
         this->comStatus_out(0, comSuccess);
     }
     return Drv::SendStatus::SEND_OK;  // Always send ok to deframer as it does not handle this anyway
 }
 
+void ComStub::comBatchIn_handler(const NATIVE_INT_TYPE portNum, bool start) {
+    if (start) {
+        FW_ASSERT(!this->m_inBatch);  // Batches do not nest
+        FW_ASSERT(!this->m_reinitialize || !this->isConnected_comStatus_OutputPort(0));
+        this->m_inBatch = true;
+        this->m_batchFailed = false;
+        return;
+    }
+    FW_ASSERT(this->m_inBatch);
+    this->m_inBatch = false;
+    Fw::Success comSuccess = this->m_batchFailed ? Fw::Success::FAILURE : Fw::Success::SUCCESS;
+    if (this->isConnected_comStatus_OutputPort(0)) {
+        this->comStatus_out(0, comSuccess);
+    }
+}
+
 void ComStub::drvConnected_handler(const NATIVE_INT_TYPE portNum) {
     Fw::Success radioSuccess = Fw::Success::SUCCESS;
     if (this->isConnected_comStatus_OutputPort(0) && m_reinitialize) {
@@ -42,6 +42,11 @@ class ComStub : public ComStubComponentBase {
     Drv::SendStatus comDataIn_handler(const NATIVE_INT_TYPE portNum, /*!< The port number*/
                                       Fw::Buffer& sendBuffer) override;
 
+    //! Handler implementation for comBatchIn
+    //!
+    void comBatchIn_handler(const NATIVE_INT_TYPE portNum, /*!< The port number*/
+                            bool start /*!< True before the first message of the batch, false after the last*/) override;
+
     //! Handler implementation for drvConnected
     //!
     void drvConnected_handler(const NATIVE_INT_TYPE portNum) override;
@@ -53,6 +58,8 @@ class ComStub : public ComStubComponentBase {
                            const Drv::RecvStatus& recvStatus) override;
 
     bool m_reinitialize;  //!< Stores if a ready signal is needed on connection
+    bool m_inBatch;       //!< A batch is open and statuses are held until its end
+    bool m_batchFailed;   //!< A send within the open batch failed
 };
 
 }  // end namespace Svc
@@ -117,6 +117,43 @@ void ComStubTester ::test_retry() {
     }
 }
 
+void ComStubTester ::test_batch() {
+    this->test_initial();
+    Fw::Buffer buffers[RETRIES];
+
+    // Each message in a batch goes to the driver, with one status at the end
+    invoke_to_comBatchIn(0, true);
+    for (U32 i = 0; i < RETRIES; i++) {
+        buffers[i].setData(storage[i]);
+        buffers[i].setSize(sizeof(storage[i]));
+        this->fill(buffers[i]);
+        ASSERT_EQ(invoke_to_comDataIn(0, buffers[i]), Drv::SendStatus::SEND_OK);
+        ASSERT_from_drvDataOut(i, buffers[i]);
+    }
+    ASSERT_from_comStatus_SIZE(0);
+    invoke_to_comBatchIn(0, false);
+    ASSERT_from_drvDataOut_SIZE(RETRIES);
+    ASSERT_from_comStatus_SIZE(1);
+    ASSERT_from_comStatus(0, Fw::Success::SUCCESS);
+
+    // A failure within a batch still passes the rest to the driver, then fails the whole batch
+    invoke_to_comBatchIn(0, true);
+    m_send_mode = Drv::SendStatus::SEND_ERROR;
+    invoke_to_comDataIn(0, buffers[0]);
+    m_send_mode = Drv::SendStatus::SEND_OK;
+    invoke_to_comDataIn(0, buffers[1]);
+    ASSERT_from_drvDataOut_SIZE(RETRIES + 2);
+    ASSERT_from_comStatus_SIZE(1);
+    invoke_to_comBatchIn(0, false);
+    ASSERT_from_comStatus_SIZE(2);
+    ASSERT_from_comStatus(1, Fw::Success::FAILURE);
+
+    // Reconnection reports ready again
+    invoke_to_drvConnected(0);
+    ASSERT_from_comStatus_SIZE(3);
+    ASSERT_from_comStatus(2, Fw::Success::SUCCESS);
+}
+
 // ----------------------------------------------------------------------
 // Handlers for typed from ports
 // ----------------------------------------------------------------------
@@ -148,6 +185,9 @@ void ComStubTester ::connectPorts() {
     // comDataIn
     this->connect_to_comDataIn(0, this->m_component.get_comDataIn_InputPort(0));
 
+    // comBatchIn
+    this->connect_to_comBatchIn(0, this->m_component.get_comBatchIn_InputPort(0));
+
     // drvConnected
     this->connect_to_drvConnected(0, this->m_component.get_drvConnected_InputPort(0));
 
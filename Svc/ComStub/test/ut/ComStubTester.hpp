@@ -50,6 +50,10 @@ class ComStubTester : public ComStubGTestBase {
     //!
     void test_retry();
 
+    //! Batched sends with a single status
+    //!
+    void test_batch();
+
   private:
     // ----------------------------------------------------------------------
     // Handlers for typed from ports
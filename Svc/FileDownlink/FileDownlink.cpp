@@ -32,8 +32,9 @@ namespace Svc {
       m_packetsSent(this),
       m_warnings(this),
       m_sequenceIndex(0),
+      m_outstanding(0),
+      m_windowSize(1),
       m_curTimer(0),
-      m_bufferSize(0),
       m_byteOffset(0),
       m_endOffset(0),
       m_lastCompletedType(Fw::FilePacket::T_NONE),
@@ -41,6 +42,13 @@ namespace Svc {
       m_curEntry(),
       m_cntxId(0)
   {
+    for (U32 i = 0; i < COUNT_BUFFERS; i++) {
+      this->m_inFlight[i] = false;
+      this->m_bufferIds[i] = 0;
+    }
+    for (U32 i = 0; i < FILEDOWNLINK_NUM_PRIORITIES; i++) {
+      this->m_classService[i] = 0;
+    }
   }
 
   void FileDownlink ::
@@ -57,20 +65,27 @@ namespace Svc {
         U32 timeout,
         U32 cooldown,
         U32 cycleTime,
-        U32 fileQueueDepth
+        U32 fileQueueDepth,
+        U32 windowSize
     )
   {
+    FW_ASSERT(windowSize > 0 && windowSize <= FILEDOWNLINK_MAX_WINDOW_SIZE, windowSize);
+    this->m_windowSize = windowSize;
     this->m_timeout = timeout;
     this->m_cooldown = cooldown;
     this->m_cycleTime = cycleTime;
     this->m_configured = true;
 
-    Os::Queue::QueueStatus stat = m_fileQueue.create(
-      Os::QueueString("fileDownlinkQueue"),
-      fileQueueDepth,
-      sizeof(struct FileEntry)
-    );
-    FW_ASSERT(stat == Os::Queue::QUEUE_OK, stat);
+    for (U32 i = 0; i < FILEDOWNLINK_NUM_PRIORITIES; i++) {
+      Os::QueueString queueName;
+      queueName.format("fileDownlinkQueue%" PRIu32, i);
+      Os::Queue::QueueStatus stat = m_fileQueues[i].create(
+        queueName,
+        fileQueueDepth,
+        sizeof(struct FileEntry)
+      );
+      FW_ASSERT(stat == Os::Queue::QUEUE_OK, stat);
+    }
   }
 
   void FileDownlink ::
@@ -98,17 +113,7 @@ namespace Svc {
     switch(this->m_mode.get())
     {
       case Mode::IDLE: {
-        NATIVE_INT_TYPE real_size = 0;
-        NATIVE_INT_TYPE prio = 0;
-        Os::Queue::QueueStatus stat = m_fileQueue.receive(
-          reinterpret_cast<U8*>(&this->m_curEntry),
-          sizeof(this->m_curEntry),
-          real_size,
-          prio,
-          Os::Queue::QUEUE_NONBLOCKING
-        );
-
-        if(stat != Os::Queue::QUEUE_OK || sizeof(this->m_curEntry) != real_size) {
+        if (not this->dequeueFile()) {
           return;
         }
 
@@ -155,27 +160,26 @@ namespace Svc {
         U32 length
     )
   {
-    struct FileEntry entry;
-    entry.srcFilename[0] = 0;
-    entry.destFilename[0] = 0;
-    entry.offset = offset;
-    entry.length = length;
-    entry.source = FileDownlink::PORT;
-    entry.opCode = 0;
-    entry.cmdSeq = 0;
-    entry.context = m_cntxId++;
-
-    FW_ASSERT(sourceFilename.length() < sizeof(entry.srcFilename));
-    FW_ASSERT(destFilename.length() < sizeof(entry.destFilename));
-    (void) Fw::StringUtils::string_copy(entry.srcFilename, sourceFilename.toChar(), sizeof(entry.srcFilename));
-    (void) Fw::StringUtils::string_copy(entry.destFilename, destFilename.toChar(), sizeof(entry.destFilename));
-
-    Os::Queue::QueueStatus status = m_fileQueue.send(reinterpret_cast<U8*>(&entry), sizeof(entry), 0, Os::Queue::QUEUE_NONBLOCKING);
+    return this->enqueuePortRequest(sourceFilename, destFilename, offset, length, 0);
+  }
 
-    if(status != Os::Queue::QUEUE_OK) {
-      return SendFileResponse(SendFileStatus::STATUS_ERROR, std::numeric_limits<U32>::max());
+  Svc::SendFileResponse FileDownlink ::
+    SendFilePriority_handler(
+        const NATIVE_INT_TYPE portNum,
+        const sourceFileString& sourceFile, // lgtm[cpp/large-parameter] dictated by command architecture
+        const destFileString& destFile, // lgtm[cpp/large-parameter] dictated by command architecture
+        U32 offset,
+        U32 length,
+        U8 priority
+    )
+  {
+    if (priority >= FILEDOWNLINK_NUM_PRIORITIES) {
+      Fw::LogStringArg sourceLogStringArg(sourceFile.toChar());
+      this->log_WARNING_LO_InvalidPriority(priority, sourceLogStringArg);
+      return SendFileResponse(SendFileStatus::STATUS_INVALID, std::numeric_limits<U32>::max());
     }
-    return SendFileResponse(SendFileStatus::STATUS_OK, entry.context);
+
+    return this->enqueuePortRequest(sourceFile, destFile, offset, length, priority);
   }
 
   void FileDownlink ::
@@ -194,17 +198,28 @@ namespace Svc {
     )
   {
 	  //If this is a stale buffer (old, timed-out, or both), then ignore its return.
-	  //File downlink actions only respond to the return of the most-recently-sent buffer.
-	  if (this->m_lastBufferId != fwBuffer.getContext() + 1 ||
-	      this->m_mode.get() == Mode::IDLE) {
+	  //File downlink actions only respond to the return of buffers sent for the current file.
+	  U32 index = 0;
+	  for (index = 0; index < COUNT_BUFFERS; index++) {
+		  if (this->m_inFlight[index] && this->m_bufferIds[index] == fwBuffer.getContext()) {
+			  break;
+		  }
+	  }
+	  if (index == COUNT_BUFFERS || this->m_mode.get() == Mode::IDLE) {
 		  return;
 	  }
 	  //Non-ignored buffers cannot be returned in "DOWNLINK" and "IDLE" state.  Only in "WAIT", "CANCEL" state.
 	  FW_ASSERT(this->m_mode.get() == Mode::WAIT || this->m_mode.get() == Mode::CANCEL, this->m_mode.get());
-      //If the last packet has been sent (and is returning now) then finish the file
+	  FW_ASSERT(this->m_outstanding > 0);
+	  this->m_inFlight[index] = false;
+	  --this->m_outstanding;
+	  this->m_curTimer = 0;
+      //If the last packet has been sent then finish the file once every buffer has returned
 	  if (this->m_lastCompletedType == Fw::FilePacket::T_END ||
           this->m_lastCompletedType == Fw::FilePacket::T_CANCEL) {
-          finishHelper(this->m_lastCompletedType == Fw::FilePacket::T_CANCEL);
+          if (this->m_outstanding == 0) {
+              finishHelper(this->m_lastCompletedType == Fw::FilePacket::T_CANCEL);
+          }
           return;
       }
       //If waiting and a buffer is in-bound, then switch to downlink mode
@@ -227,27 +242,7 @@ namespace Svc {
         const Fw::CmdStringArg& destFilename
     )
   {
-    struct FileEntry entry;
-    entry.srcFilename[0] = 0;
-    entry.destFilename[0] = 0;
-    entry.offset = 0;
-    entry.length = 0;
-    entry.source = FileDownlink::COMMAND;
-    entry.opCode = opCode;
-    entry.cmdSeq = cmdSeq;
-    entry.context = std::numeric_limits<U32>::max();
-
-
-    FW_ASSERT(sourceFilename.length() < sizeof(entry.srcFilename));
-    FW_ASSERT(destFilename.length() < sizeof(entry.destFilename));
-    (void) Fw::StringUtils::string_copy(entry.srcFilename, sourceFilename.toChar(), sizeof(entry.srcFilename));
-    (void) Fw::StringUtils::string_copy(entry.destFilename, destFilename.toChar(), sizeof(entry.destFilename));
-
-    Os::Queue::QueueStatus status = m_fileQueue.send(reinterpret_cast<U8*>(&entry), sizeof(entry), 0, Os::Queue::QUEUE_NONBLOCKING);
-
-    if(status != Os::Queue::QUEUE_OK) {
-      this->cmdResponse_out(opCode, cmdSeq, Fw::CmdResponse::EXECUTION_ERROR);
-    }
+    this->enqueueCommandRequest(opCode, cmdSeq, sourceFilename, destFilename, 0, 0, 0);
   }
 
   void FileDownlink ::
@@ -260,27 +255,26 @@ namespace Svc {
       U32 length
    )
   {
-    struct FileEntry entry;
-    entry.srcFilename[0] = 0;
-    entry.destFilename[0] = 0;
-    entry.offset = startOffset;
-    entry.length = length;
-    entry.source = FileDownlink::COMMAND;
-    entry.opCode = opCode;
-    entry.cmdSeq = cmdSeq;
-    entry.context = std::numeric_limits<U32>::max();
-
-
-    FW_ASSERT(sourceFilename.length() < sizeof(entry.srcFilename));
-    FW_ASSERT(destFilename.length() < sizeof(entry.destFilename));
-    (void) Fw::StringUtils::string_copy(entry.srcFilename, sourceFilename.toChar(), sizeof(entry.srcFilename));
-    (void) Fw::StringUtils::string_copy(entry.destFilename, destFilename.toChar(), sizeof(entry.destFilename));
-
-    Os::Queue::QueueStatus status = m_fileQueue.send(reinterpret_cast<U8*>(&entry), sizeof(entry), 0, Os::Queue::QUEUE_NONBLOCKING);
+    this->enqueueCommandRequest(opCode, cmdSeq, sourceFilename, destFilename, startOffset, length, 0);
+  }
 
-    if(status != Os::Queue::QUEUE_OK) {
-      this->cmdResponse_out(opCode, cmdSeq, Fw::CmdResponse::EXECUTION_ERROR);
+  void FileDownlink ::
+    SendFilePriority_cmdHandler(
+      FwOpcodeType opCode,
+      U32 cmdSeq,
+      const Fw::CmdStringArg& sourceFilename,
+      const Fw::CmdStringArg& destFilename,
+      U8 priority
+   )
+  {
+    if (priority >= FILEDOWNLINK_NUM_PRIORITIES) {
+      Fw::LogStringArg sourceLogStringArg(sourceFilename.toChar());
+      this->log_WARNING_LO_InvalidPriority(priority, sourceLogStringArg);
+      this->cmdResponse_out(opCode, cmdSeq, Fw::CmdResponse::VALIDATION_ERROR);
+      return;
     }
+
+    this->enqueueCommandRequest(opCode, cmdSeq, sourceFilename, destFilename, 0, 0, priority);
   }
 
   void FileDownlink ::
@@ -300,6 +294,145 @@ namespace Svc {
   // Private helper methods
   // ----------------------------------------------------------------------
 
+  Svc::SendFileResponse FileDownlink ::
+    enqueuePortRequest(
+        const Fw::StringBase& sourceFilename,
+        const Fw::StringBase& destFilename,
+        U32 offset,
+        U32 length,
+        U8 priority
+    )
+  {
+    struct FileEntry entry;
+    entry.offset = offset;
+    entry.length = length;
+    entry.source = FileDownlink::PORT;
+    entry.opCode = 0;
+    entry.cmdSeq = 0;
+    entry.context = m_cntxId++;
+    entry.priority = priority;
+    this->copyFilenames(entry, sourceFilename, destFilename);
+
+    Os::Queue::QueueStatus status = this->enqueueFile(entry);
+
+    if(status != Os::Queue::QUEUE_OK) {
+      return SendFileResponse(SendFileStatus::STATUS_ERROR, std::numeric_limits<U32>::max());
+    }
+    return SendFileResponse(SendFileStatus::STATUS_OK, entry.context);
+  }
+
+  void FileDownlink ::
+    enqueueCommandRequest(
+        const FwOpcodeType opCode,
+        const U32 cmdSeq,
+        const Fw::StringBase& sourceFilename,
+        const Fw::StringBase& destFilename,
+        U32 offset,
+        U32 length,
+        U8 priority
+    )
+  {
+    struct FileEntry entry;
+    entry.offset = offset;
+    entry.length = length;
+    entry.source = FileDownlink::COMMAND;
+    entry.opCode = opCode;
+    entry.cmdSeq = cmdSeq;
+    entry.context = std::numeric_limits<U32>::max();
+    entry.priority = priority;
+    this->copyFilenames(entry, sourceFilename, destFilename);
+
+    Os::Queue::QueueStatus status = this->enqueueFile(entry);
+
+    if(status != Os::Queue::QUEUE_OK) {
+      this->cmdResponse_out(opCode, cmdSeq, Fw::CmdResponse::EXECUTION_ERROR);
+    }
+  }
+
+  void FileDownlink ::
+    copyFilenames(
+        FileEntry& entry,
+        const Fw::StringBase& sourceFilename,
+        const Fw::StringBase& destFilename
+    )
+  {
+    FW_ASSERT(sourceFilename.length() < sizeof(entry.srcFilename));
+    FW_ASSERT(destFilename.length() < sizeof(entry.destFilename));
+    (void) Fw::StringUtils::string_copy(entry.srcFilename, sourceFilename.toChar(), sizeof(entry.srcFilename));
+    (void) Fw::StringUtils::string_copy(entry.destFilename, destFilename.toChar(), sizeof(entry.destFilename));
+  }
+
+  Os::Queue::QueueStatus FileDownlink ::
+    enqueueFile(const FileEntry& entry)
+  {
+    FW_ASSERT(entry.priority < FILEDOWNLINK_NUM_PRIORITIES, entry.priority);
+    return this->m_fileQueues[entry.priority].send(
+      reinterpret_cast<const U8*>(&entry),
+      sizeof(entry),
+      0,
+      Os::Queue::QUEUE_NONBLOCKING
+    );
+  }
+
+  bool FileDownlink ::
+    dequeueFile()
+  {
+    // Pick the class with queued files that has been served the least for its weight.
+    // Ties go to the higher priority class.
+    NATIVE_INT_TYPE selected = -1;
+    for (NATIVE_INT_TYPE i = FILEDOWNLINK_NUM_PRIORITIES - 1; i >= 0; i--) {
+      if (this->m_fileQueues[i].getNumMsgs() > 0 &&
+          (selected < 0 || this->m_classService[i] < this->m_classService[selected])) {
+        selected = i;
+      }
+    }
+    if (selected < 0) {
+      return false;
+    }
+
+    NATIVE_INT_TYPE real_size = 0;
+    NATIVE_INT_TYPE prio = 0;
+    Os::Queue::QueueStatus stat = m_fileQueues[selected].receive(
+      reinterpret_cast<U8*>(&this->m_curEntry),
+      sizeof(this->m_curEntry),
+      real_size,
+      prio,
+      Os::Queue::QUEUE_NONBLOCKING
+    );
+
+    if(stat != Os::Queue::QUEUE_OK || sizeof(this->m_curEntry) != real_size) {
+      return false;
+    }
+
+    // Classes with nothing queued may not bank service while idle
+    for (NATIVE_INT_TYPE i = 0; i < FILEDOWNLINK_NUM_PRIORITIES; i++) {
+      if (this->m_fileQueues[i].getNumMsgs() == 0 &&
+          this->m_classService[i] < this->m_classService[selected]) {
+        this->m_classService[i] = this->m_classService[selected];
+      }
+    }
+    return true;
+  }
+
+  void FileDownlink ::
+    chargeClass(U8 priority, U32 bytes)
+  {
+    FW_ASSERT(priority < FILEDOWNLINK_NUM_PRIORITIES, priority);
+    // Charge the bytes sent plus one buffer of packet overhead, scaled by the class weight
+    const U32 weight = FILEDOWNLINK_PRIORITY_WEIGHTS[priority];
+    FW_ASSERT(weight > 0, priority);
+    this->m_classService[priority] += bytes / weight + FILEDOWNLINK_INTERNAL_BUFFER_SIZE / weight;
+
+    // Keep service relative to the least served class so the counters stay bounded
+    U32 least = this->m_classService[0];
+    for (U32 i = 1; i < FILEDOWNLINK_NUM_PRIORITIES; i++) {
+      least = FW_MIN(least, this->m_classService[i]);
+    }
+    for (U32 i = 0; i < FILEDOWNLINK_NUM_PRIORITIES; i++) {
+      this->m_classService[i] -= least;
+    }
+  }
+
   Fw::CmdResponse FileDownlink ::
     statusToCmdResp(SendFileStatus status)
   {
@@ -349,6 +482,8 @@ namespace Svc {
         destFilename
     );
 
+    this->m_byteOffset = startOffset;
+
     // Reject command if error when opening file
     if (status != Os::File::OP_OK) {
       this->m_mode.set(Mode::IDLE);
@@ -370,15 +505,6 @@ namespace Svc {
         length = this->m_file.getSize() - startOffset;
     }
 
-    // Send file and switch to WAIT mode
-    this->getBuffer(this->m_buffer, FILE_PACKET);
-    this->sendStartPacket();
-    this->m_mode.set(Mode::WAIT);
-    this->m_sequenceIndex = 1;
-    this->m_curTimer = 0;
-    this->m_byteOffset = startOffset;
-    this->m_lastCompletedType = Fw::FilePacket::T_START;
-
     // zero length means read until end of file
     if (length > 0) {
         this->log_ACTIVITY_HI_SendStarted(length, this->m_file.getSourceName(), this->m_file.getDestName());
@@ -388,6 +514,16 @@ namespace Svc {
         this->log_ACTIVITY_HI_SendStarted(this->m_file.getSize() - startOffset, this->m_file.getSourceName(), this->m_file.getDestName());
         this->m_endOffset = this->m_file.getSize();
     }
+
+    // Send the start packet, then fill the rest of the window. Switches to WAIT mode.
+    this->clearWindow();
+    this->sendStartPacket();
+    this->m_sequenceIndex = 1;
+    this->m_curTimer = 0;
+    this->m_byteOffset = startOffset;
+    this->m_lastCompletedType = Fw::FilePacket::T_START;
+    this->m_mode.set(Mode::DOWNLINK);
+    this->downlinkPacket();
   }
 
   Os::File::Status FileDownlink ::
@@ -429,18 +565,12 @@ namespace Svc {
   void FileDownlink ::
     sendCancelPacket()
   {
-    Fw::Buffer buffer;
     Fw::FilePacket::CancelPacket cancelPacket;
     cancelPacket.initialize(this->m_sequenceIndex);
 
     Fw::FilePacket filePacket;
     filePacket.fromCancelPacket(cancelPacket);
-    this->getBuffer(buffer, CANCEL_PACKET);
-
-    const Fw::SerializeStatus status = filePacket.toBuffer(buffer);
-    FW_ASSERT(status == Fw::FW_SERIALIZE_OK);
-    this->bufferSendOut_out(0, buffer);
-    this->m_packetsSent.packetSent();
+    this->sendPacket(filePacket, CANCEL_BUFFER);
   }
 
   void FileDownlink ::
@@ -475,16 +605,32 @@ namespace Svc {
   void FileDownlink ::
     sendFilePacket(const Fw::FilePacket& filePacket)
   {
+    // Use the first window slot whose buffer is not in flight
+    U32 index = 0;
+    for (index = 0; index < this->m_windowSize; index++) {
+      if (not this->m_inFlight[index]) {
+        break;
+      }
+    }
+    FW_ASSERT(index < this->m_windowSize, index, this->m_outstanding);
+    this->sendPacket(filePacket, index);
+  }
+
+  void FileDownlink ::
+    sendPacket(const Fw::FilePacket& filePacket, U32 index)
+  {
+    Fw::Buffer buffer;
+    this->getBuffer(buffer, index);
     const U32 bufferSize = filePacket.bufferSize();
-    FW_ASSERT(this->m_buffer.getData() != nullptr);
-    FW_ASSERT(this->m_buffer.getSize() >= bufferSize, bufferSize, this->m_buffer.getSize());
-    const Fw::SerializeStatus status = filePacket.toBuffer(this->m_buffer);
+    FW_ASSERT(buffer.getSize() >= bufferSize, bufferSize, buffer.getSize());
+    const Fw::SerializeStatus status = filePacket.toBuffer(buffer);
     FW_ASSERT(status == Fw::FW_SERIALIZE_OK);
     // set the buffer size to the packet size
-    this->m_buffer.setSize(bufferSize);
-    this->bufferSendOut_out(0, this->m_buffer);
-    // restore buffer size to max
-    this->m_buffer.setSize(FILEDOWNLINK_INTERNAL_BUFFER_SIZE);
+    buffer.setSize(bufferSize);
+    // mark in flight before sending, as the buffer may be returned at any time afterwards
+    this->m_inFlight[index] = true;
+    ++this->m_outstanding;
+    this->bufferSendOut_out(0, buffer);
     this->m_packetsSent.packetSent();
   }
 
@@ -492,6 +638,8 @@ namespace Svc {
     enterCooldown()
   {
     this->m_file.getOsFile().close();
+    this->clearWindow();
+    this->chargeClass(this->m_curEntry.priority, this->m_byteOffset - this->m_curEntry.offset);
     this->m_mode.set(Mode::COOLDOWN);
     this->m_lastCompletedType = Fw::FilePacket::T_NONE;
     this->m_curTimer = 0;
@@ -507,23 +655,31 @@ namespace Svc {
           this->sendCancelPacket();
           this->m_lastCompletedType = Fw::FilePacket::T_CANCEL;
       }
-      //If in downlink mode and currently downlinking data then continue with the next packer
-      else if (this->m_mode.get() == Mode::DOWNLINK && this->m_lastCompletedType == Fw::FilePacket::T_START) {
-          //Send the next packet, or fail doing so
-          const Os::File::Status status = this->sendDataPacket(this->m_byteOffset);
-          if (status != Os::File::OP_OK) {
-              this->log_WARNING_HI_SendDataFail(this->m_file.getSourceName(), this->m_byteOffset);
-              this->enterCooldown();
-              this->sendResponse(FILEDOWNLINK_COMMAND_FAILURES_DISABLED ? SendFileStatus::STATUS_OK : SendFileStatus::STATUS_ERROR);
-              //Don't go to wait state
-              return;
+      //Otherwise send packets, in order, until the window is full or the last packet is sent
+      else {
+          while (this->m_outstanding < this->m_windowSize) {
+              //If in downlink mode and currently downlinking data then continue with the next packet
+              if (this->m_mode.get() == Mode::DOWNLINK && this->m_lastCompletedType == Fw::FilePacket::T_START) {
+                  //Send the next packet, or fail doing so
+                  const Os::File::Status status = this->sendDataPacket(this->m_byteOffset);
+                  if (status != Os::File::OP_OK) {
+                      this->log_WARNING_HI_SendDataFail(this->m_file.getSourceName(), this->m_byteOffset);
+                      this->enterCooldown();
+                      this->sendResponse(FILEDOWNLINK_COMMAND_FAILURES_DISABLED ? SendFileStatus::STATUS_OK : SendFileStatus::STATUS_ERROR);
+                      //Don't go to wait state
+                      return;
+                  }
+              }
+              //If in downlink mode or cancel and finished downlinking data then send the last packet
+              else if (this->m_lastCompletedType == Fw::FilePacket::T_DATA) {
+                  this->sendEndPacket();
+                  this->m_lastCompletedType = Fw::FilePacket::T_END;
+              }
+              else {
+                  break;
+              }
           }
       }
-      //If in downlink mode or cancel and finished downlinking data then send the last packet
-      else if (this->m_lastCompletedType == Fw::FilePacket::T_DATA) {
-          this->sendEndPacket();
-          this->m_lastCompletedType = Fw::FilePacket::T_END;
-      }
       this->m_mode.set(Mode::WAIT);
       this->m_curTimer = 0;
   }
@@ -543,15 +699,26 @@ namespace Svc {
   }
 
   void FileDownlink ::
-    getBuffer(Fw::Buffer& buffer, PacketType type)
+    getBuffer(Fw::Buffer& buffer, U32 index)
   {
-      //Check type is correct
-      FW_ASSERT(type < COUNT_PACKET_TYPE && type >= 0, type);
+      //Check index is correct and the buffer is not in use
+      FW_ASSERT(index < COUNT_BUFFERS, index);
+      FW_ASSERT(not this->m_inFlight[index], index);
       // Wrap the buffer around our indexed memory.
-      buffer.setData(this->m_memoryStore[type]);
+      buffer.setData(this->m_memoryStore[index]);
       buffer.setSize(FILEDOWNLINK_INTERNAL_BUFFER_SIZE);
       //Set a known ID to look for later
       buffer.setContext(m_lastBufferId);
+      this->m_bufferIds[index] = m_lastBufferId;
       m_lastBufferId++;
   }
+
+  void FileDownlink ::
+    clearWindow()
+  {
+      for (U32 i = 0; i < COUNT_BUFFERS; i++) {
+          this->m_inFlight[i] = false;
+      }
+      this->m_outstanding = 0;
+  }
 } // end namespace Svc
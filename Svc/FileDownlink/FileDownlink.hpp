@@ -247,14 +247,14 @@ namespace Svc {
         FwOpcodeType opCode; // Op code of command, only set for CMD sources.
         U32 cmdSeq; // CmdSeq number, only set for CMD sources.
         U32 context; // Context id of request, only set for PORT sources.
+        U8 priority; // Priority class of the request
       };
 
-      //! Enumeration for packet types
-      //! Each type has a buffer to store it.
-      enum PacketType {
-          FILE_PACKET,
-          CANCEL_PACKET,
-          COUNT_PACKET_TYPE
+      //! Indices of the internal buffers
+      //! Each window slot has a buffer for file packets, followed by one buffer for cancel packets.
+      enum BufferIndex {
+          CANCEL_BUFFER = FILEDOWNLINK_MAX_WINDOW_SIZE,
+          COUNT_BUFFERS
       };
 
     public:
@@ -282,7 +282,8 @@ namespace Svc {
           U32 timeout, //!< Timeout threshold (milliseconds) while in WAIT state
           U32 cooldown, //!< Cooldown (in ms) between finishing a downlink and starting the next file.
           U32 cycleTime, //!< Rate at which we are running
-          U32 fileQueueDepth //!< Max number of items in file downlink queue
+          U32 fileQueueDepth, //!< Max number of items in file downlink queue
+          U32 windowSize = 1 //!< Max number of file packets in flight at once. 1 waits for each buffer return.
       );
 
       //! Start FileDownlink component
@@ -318,6 +319,17 @@ namespace Svc {
           U32 length /*!< Amount of data in bytes to downlink from file. 0 to read until end of file*/
       );
 
+      //! Handler implementation for SendFilePriority
+      //!
+      Svc::SendFileResponse SendFilePriority_handler(
+          const NATIVE_INT_TYPE portNum, /*!< The port number*/
+          const sourceFileString& sourceFile, /*!< Path of file to downlink*/
+          const destFileString& destFile, /*!< Path to store downlinked file at*/
+          U32 offset, /*!< Amount of data in bytes to downlink from file. 0 to read until end of file*/
+          U32 length, /*!< Amount of data in bytes to downlink from file. 0 to read until end of file*/
+          U8 priority /*!< Priority class of the file*/
+      );
+
       //! Handler implementation for bufferReturn
       //!
       void bufferReturn_handler(
@@ -367,6 +379,16 @@ namespace Svc {
           U32 length //!< Number of bytes to send from starting offset. Length of 0 implies until the end of the file
       );
 
+      //! Implementation for FILE_DWN_SEND_FILE_PRIORITY command handler
+      //!
+      void SendFilePriority_cmdHandler(
+          FwOpcodeType opCode, //!< The opcode
+          U32 cmdSeq, //!< The command sequence number
+          const Fw::CmdStringArg& sourceFilename, //!< The name of the on-board file to send
+          const Fw::CmdStringArg& destFilename, //!< The name of the destination file on the ground
+          U8 priority //!< Priority class of the file
+      );
+
 
     PRIVATE:
 
@@ -388,13 +410,49 @@ namespace Svc {
       void sendEndPacket();
       void sendStartPacket();
       void sendFilePacket(const Fw::FilePacket& filePacket);
+      void sendPacket(const Fw::FilePacket& filePacket, U32 index);
+
+      //! Queue a file requested through a port in a priority class
+      //! \return the response to the request
+      Svc::SendFileResponse enqueuePortRequest(
+          const Fw::StringBase& sourceFilename, //!< Path of file to downlink
+          const Fw::StringBase& destFilename, //!< Path to store downlinked file at
+          U32 offset, //!< Starting offset of the source file
+          U32 length, //!< Number of bytes to send from starting offset, 0 until the end of the file
+          U8 priority //!< Priority class of the file
+      );
+
+      //! Queue a file requested by a command in a priority class, failing the command if the queue is full
+      void enqueueCommandRequest(
+          const FwOpcodeType opCode, //!< The opcode
+          const U32 cmdSeq, //!< The command sequence number
+          const Fw::StringBase& sourceFilename, //!< Path of file to downlink
+          const Fw::StringBase& destFilename, //!< Path to store downlinked file at
+          U32 offset, //!< Starting offset of the source file
+          U32 length, //!< Number of bytes to send from starting offset, 0 until the end of the file
+          U8 priority //!< Priority class of the file
+      );
+
+      //! Copy the file names of a request into its queue entry
+      static void copyFilenames(
+          FileEntry& entry, //!< The queue entry
+          const Fw::StringBase& sourceFilename, //!< Path of file to downlink
+          const Fw::StringBase& destFilename //!< Path to store downlinked file at
+      );
+
+      //Scheduling functions
+      Os::Queue::QueueStatus enqueueFile(const FileEntry& entry);
+      bool dequeueFile();
+      void chargeClass(U8 priority, U32 bytes);
 
       //State-helper functions
       void exitFileTransfer();
       void enterCooldown();
 
       //Function to acquire a buffer internally
-      void getBuffer(Fw::Buffer& buffer, PacketType type);
+      void getBuffer(Fw::Buffer& buffer, U32 index);
+      //Release all buffers in flight, ignoring any later returns of them
+      void clearWindow();
       //Downlink the "next" packet
       void downlinkPacket();
       //Finish the file transfer
@@ -413,11 +471,26 @@ namespace Svc {
       //! Whether the configuration function has been called.
       bool m_configured;
 
-      //! File downlink queue
-      Os::Queue m_fileQueue;
+      //! File downlink queues, one per priority class
+      Os::Queue m_fileQueues[FILEDOWNLINK_NUM_PRIORITIES];
+
+      //! Bytes sent from each priority class divided by its weight, relative to the least served class
+      U32 m_classService[FILEDOWNLINK_NUM_PRIORITIES];
 
       //!Buffer's memory backing
-      U8 m_memoryStore[COUNT_PACKET_TYPE][FILEDOWNLINK_INTERNAL_BUFFER_SIZE];
+      U8 m_memoryStore[COUNT_BUFFERS][FILEDOWNLINK_INTERNAL_BUFFER_SIZE];
+
+      //! Whether each buffer has been sent and not yet returned
+      bool m_inFlight[COUNT_BUFFERS];
+
+      //! Context id given to each buffer when it was last sent
+      U32 m_bufferIds[COUNT_BUFFERS];
+
+      //! Number of buffers sent and not yet returned
+      U32 m_outstanding;
+
+      //! Max number of file packet buffers in flight at once
+      U32 m_windowSize;
 
       //! The mode
       Mode m_mode;
@@ -449,12 +522,6 @@ namespace Svc {
       //! rate (milliseconds) at which we are running
       U32 m_cycleTime;
 
-      ////! Buffer for sending file data
-      Fw::Buffer m_buffer;
-
-      //! Buffer size for file data
-      U32 m_bufferSize;
-
       //! Current byte offset in file
       U32 m_byteOffset;
 
@@ -39,6 +39,26 @@ TEST(FileDownlink, SendFilePort) {
     tester.sendFilePort();
 }
 
+TEST(FileDownlink, DownlinkWindowed) {
+    Svc::FileDownlinkTester tester(3);
+    tester.downlinkWindowed();
+}
+
+TEST(FileDownlink, DownlinkWindowFull) {
+    Svc::FileDownlinkTester tester(3);
+    tester.downlinkWindowFull();
+}
+
+TEST(FileDownlink, DownlinkWindowOutOfOrder) {
+    Svc::FileDownlinkTester tester(3);
+    tester.downlinkWindowOutOfOrder();
+}
+
+TEST(FileDownlink, DownlinkPriority) {
+    Svc::FileDownlinkTester tester;
+    tester.downlinkPriority();
+}
+
 int main(int argc, char **argv) {
   ::testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
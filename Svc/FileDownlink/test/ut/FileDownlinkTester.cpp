@@ -29,12 +29,14 @@ namespace Svc {
   // ----------------------------------------------------------------------
 
   FileDownlinkTester ::
-    FileDownlinkTester() :
+    FileDownlinkTester(const U32 windowSize) :
       FileDownlinkGTestBase("Tester", MAX_HISTORY_SIZE),
       component("FileDownlink"),
-      buffers_index(0)
+      buffers_index(0),
+      holdBuffers(false),
+      numHeldBuffers(0)
   {
-    this->component.configure(TIMEOUT_MS, COOLDOWN_MS, CYCLE_MS, 10);
+    this->component.configure(TIMEOUT_MS, COOLDOWN_MS, CYCLE_MS, 10, windowSize);
     this->connectPorts();
     this->initComponents();
   }
@@ -389,6 +391,286 @@ namespace Svc {
     this->removeFile(sourceFileName);
   }
 
+  void FileDownlinkTester ::
+    downlinkWindowed()
+  {
+    // The start, data and end packets must fit in the window at once
+    ASSERT_GE(this->component.m_windowSize, 3U);
+
+    // Create a file
+    const char *const sourceFileName = "source.bin";
+    const char *const destFileName = "dest.bin";
+    U8 data[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+    FileBuffer fileBufferOut(data, sizeof(data));
+    fileBufferOut.write(sourceFileName);
+
+    Fw::CmdStringArg sourceCmdStringArg(sourceFileName);
+    Fw::CmdStringArg destCmdStringArg(destFileName);
+    this->sendCmd_SendFile(
+      INSTANCE,
+      CMD_SEQ,
+      sourceCmdStringArg,
+      destCmdStringArg
+    );
+    this->component.doDispatch(); // Dispatch sendfile command
+    this->component.Run_handler(0,0); // Pull file from queue and fill the window
+
+    // All packets are sent before any buffer is returned
+    ASSERT_from_bufferSendOut_SIZE(3);
+    ASSERT_EQ(3U, this->component.m_outstanding);
+    ASSERT_EQ(FileDownlink::Mode::WAIT, this->component.m_mode.get());
+    ASSERT_CMD_RESPONSE_SIZE(0);
+
+    // The file completes once the last buffer returns
+    this->component.doDispatch();
+    this->component.doDispatch();
+    ASSERT_CMD_RESPONSE_SIZE(0);
+    this->component.doDispatch();
+    ASSERT_CMD_RESPONSE_SIZE(1);
+    ASSERT_CMD_RESPONSE(0, FileDownlink::OPCODE_SENDFILE, CMD_SEQ, Fw::CmdResponse::OK);
+    ASSERT_EQ(0U, this->component.m_outstanding);
+    ASSERT_EQ(FileDownlink::Mode::COOLDOWN, this->component.m_mode.get());
+
+    // Assert events
+    ASSERT_EVENTS_SIZE(2);
+    ASSERT_EVENTS_SendStarted(0, 10, sourceFileName, destFileName);
+    ASSERT_EVENTS_FileSent(0, sourceFileName, destFileName);
+
+    // Validate the packet history
+    History<Fw::FilePacket::DataPacket> dataPackets(MAX_HISTORY_SIZE);
+    CFDP::Checksum checksum;
+    fileBufferOut.getChecksum(checksum);
+    validatePacketHistory(
+        *this->fromPortHistory_bufferSendOut,
+        dataPackets,
+        Fw::FilePacket::T_END,
+        3,
+        checksum,
+        0
+    );
+
+    // Compare the outgoing and incoming files
+    FileBuffer fileBufferIn(dataPackets);
+    ASSERT_EQ(true, FileBuffer::compare(fileBufferIn, fileBufferOut));
+
+    // Remove the outgoing file
+    this->removeFile(sourceFileName);
+  }
+
+  void FileDownlinkTester ::
+    downlinkWindowFull()
+  {
+    const U32 windowSize = this->component.m_windowSize;
+
+    // Create a file with more data packets than the window holds
+    const char *const sourceFileName = "source.bin";
+    const char *const destFileName = "dest.bin";
+    const U32 maxDataSize = FILEDOWNLINK_INTERNAL_BUFFER_SIZE - Fw::FilePacket::DataPacket::HEADERSIZE;
+    const U32 numDataPackets = windowSize + 2;
+    const U32 numPackets = numDataPackets + 2;
+    const size_t fileSize = numDataPackets * maxDataSize - 1;
+    U8 data[FILE_BUFFER_CAPACITY];
+    ASSERT_LE(fileSize, sizeof(data));
+    ASSERT_LE(numPackets, static_cast<U32>(MAX_HISTORY_SIZE));
+    for (size_t i = 0; i < fileSize; ++i) {
+      data[i] = static_cast<U8>(i);
+    }
+    FileBuffer fileBufferOut(data, fileSize);
+    fileBufferOut.write(sourceFileName);
+
+    // Hold the buffers, so the test decides when they return
+    this->holdBuffers = true;
+    Fw::CmdStringArg sourceCmdStringArg(sourceFileName);
+    Fw::CmdStringArg destCmdStringArg(destFileName);
+    this->sendCmd_SendFile(
+      INSTANCE,
+      CMD_SEQ,
+      sourceCmdStringArg,
+      destCmdStringArg
+    );
+    this->component.doDispatch(); // Dispatch sendfile command
+    this->component.Run_handler(0,0); // Pull file from queue and fill the window
+
+    // Sending stops once the window is full
+    ASSERT_from_bufferSendOut_SIZE(windowSize);
+    ASSERT_EQ(windowSize, this->component.m_outstanding);
+    ASSERT_EQ(FileDownlink::Mode::WAIT, this->component.m_mode.get());
+    this->component.Run_handler(0,0);
+    ASSERT_from_bufferSendOut_SIZE(windowSize);
+
+    // Each returned buffer lets one more packet out, up to the end packet
+    for (U32 sent = windowSize; sent < numPackets; ++sent) {
+      this->returnBuffer(0);
+      ASSERT_from_bufferSendOut_SIZE(sent + 1);
+      ASSERT_EQ(windowSize, this->component.m_outstanding);
+    }
+
+    // The file completes once the last buffer returns
+    while (this->numHeldBuffers > 0) {
+      ASSERT_CMD_RESPONSE_SIZE(0);
+      this->returnBuffer(0);
+    }
+    ASSERT_from_bufferSendOut_SIZE(numPackets);
+    ASSERT_CMD_RESPONSE_SIZE(1);
+    ASSERT_CMD_RESPONSE(0, FileDownlink::OPCODE_SENDFILE, CMD_SEQ, Fw::CmdResponse::OK);
+    ASSERT_EQ(0U, this->component.m_outstanding);
+    ASSERT_EQ(FileDownlink::Mode::COOLDOWN, this->component.m_mode.get());
+
+    // Validate the packet history
+    History<Fw::FilePacket::DataPacket> dataPackets(MAX_HISTORY_SIZE);
+    CFDP::Checksum checksum;
+    fileBufferOut.getChecksum(checksum);
+    validatePacketHistory(
+        *this->fromPortHistory_bufferSendOut,
+        dataPackets,
+        Fw::FilePacket::T_END,
+        numPackets,
+        checksum,
+        0
+    );
+
+    // Compare the outgoing and incoming files
+    FileBuffer fileBufferIn(dataPackets);
+    ASSERT_EQ(true, FileBuffer::compare(fileBufferIn, fileBufferOut));
+
+    // Remove the outgoing file
+    this->removeFile(sourceFileName);
+  }
+
+  void FileDownlinkTester ::
+    downlinkWindowOutOfOrder()
+  {
+    const U32 windowSize = this->component.m_windowSize;
+
+    // Create a file with more data packets than the window holds
+    const char *const sourceFileName = "source.bin";
+    const char *const destFileName = "dest.bin";
+    const U32 maxDataSize = FILEDOWNLINK_INTERNAL_BUFFER_SIZE - Fw::FilePacket::DataPacket::HEADERSIZE;
+    const U32 numDataPackets = windowSize + 2;
+    const U32 numPackets = numDataPackets + 2;
+    const size_t fileSize = numDataPackets * maxDataSize - 1;
+    U8 data[FILE_BUFFER_CAPACITY];
+    ASSERT_LE(fileSize, sizeof(data));
+    ASSERT_LE(numPackets, static_cast<U32>(MAX_HISTORY_SIZE));
+    for (size_t i = 0; i < fileSize; ++i) {
+      data[i] = static_cast<U8>(i);
+    }
+    FileBuffer fileBufferOut(data, fileSize);
+    fileBufferOut.write(sourceFileName);
+
+    // Hold the buffers, so the test decides when they return
+    this->holdBuffers = true;
+    Fw::CmdStringArg sourceCmdStringArg(sourceFileName);
+    Fw::CmdStringArg destCmdStringArg(destFileName);
+    this->sendCmd_SendFile(
+      INSTANCE,
+      CMD_SEQ,
+      sourceCmdStringArg,
+      destCmdStringArg
+    );
+    this->component.doDispatch(); // Dispatch sendfile command
+    this->component.Run_handler(0,0); // Pull file from queue and fill the window
+    ASSERT_from_bufferSendOut_SIZE(windowSize);
+
+    // Return the newest buffer first, so the start packet buffer returns last
+    while (this->numHeldBuffers > 0) {
+      ASSERT_CMD_RESPONSE_SIZE(0);
+      this->returnBuffer(this->numHeldBuffers - 1);
+      ASSERT_LE(this->component.m_outstanding, windowSize);
+    }
+    ASSERT_CMD_RESPONSE_SIZE(1);
+    ASSERT_CMD_RESPONSE(0, FileDownlink::OPCODE_SENDFILE, CMD_SEQ, Fw::CmdResponse::OK);
+    ASSERT_EQ(0U, this->component.m_outstanding);
+    ASSERT_EQ(FileDownlink::Mode::COOLDOWN, this->component.m_mode.get());
+
+    // Validate the packet order and the checksum
+    History<Fw::FilePacket::DataPacket> dataPackets(MAX_HISTORY_SIZE);
+    CFDP::Checksum checksum;
+    fileBufferOut.getChecksum(checksum);
+    validatePacketHistory(
+        *this->fromPortHistory_bufferSendOut,
+        dataPackets,
+        Fw::FilePacket::T_END,
+        numPackets,
+        checksum,
+        0
+    );
+
+    // Compare the outgoing and incoming files
+    FileBuffer fileBufferIn(dataPackets);
+    ASSERT_EQ(true, FileBuffer::compare(fileBufferIn, fileBufferOut));
+
+    // Remove the outgoing file
+    this->removeFile(sourceFileName);
+  }
+
+  void FileDownlinkTester ::
+    downlinkPriority()
+  {
+    // Create the files
+    const char *const lowFileName = "source_low.bin";
+    const char *const highFileName = "source_high.bin";
+    const char *const destFileName = "dest.bin";
+    U8 data[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+    FileBuffer fileBufferOut(data, sizeof(data));
+    fileBufferOut.write(lowFileName);
+    fileBufferOut.write(highFileName);
+
+    // An out of range priority is rejected
+    Fw::CmdStringArg lowCmdStringArg(lowFileName);
+    Fw::CmdStringArg highCmdStringArg(highFileName);
+    Fw::CmdStringArg destCmdStringArg(destFileName);
+    this->sendCmd_SendFilePriority(
+      INSTANCE,
+      CMD_SEQ,
+      highCmdStringArg,
+      destCmdStringArg,
+      FILEDOWNLINK_NUM_PRIORITIES
+    );
+    this->component.doDispatch();
+    ASSERT_CMD_RESPONSE_SIZE(1);
+    ASSERT_CMD_RESPONSE(0, FileDownlink::OPCODE_SENDFILEPRIORITY, CMD_SEQ, Fw::CmdResponse::VALIDATION_ERROR);
+    ASSERT_EVENTS_InvalidPriority_SIZE(1);
+    ASSERT_EVENTS_InvalidPriority(0, FILEDOWNLINK_NUM_PRIORITIES, highFileName);
+    this->clearHistory();
+
+    // Queue the default priority file first, then the high priority file
+    this->sendCmd_SendFile(INSTANCE, CMD_SEQ, lowCmdStringArg, destCmdStringArg);
+    this->sendCmd_SendFilePriority(
+      INSTANCE,
+      CMD_SEQ + 1,
+      highCmdStringArg,
+      destCmdStringArg,
+      FILEDOWNLINK_NUM_PRIORITIES - 1
+    );
+    this->component.doDispatch();
+    this->component.doDispatch();
+
+    // Run both downlinks to completion
+    for (U32 file = 0; file < 2; file++) {
+      this->component.Run_handler(0,0);
+      while (this->component.m_mode.get() != FileDownlink::Mode::IDLE) {
+        if(this->component.m_mode.get() != FileDownlink::Mode::COOLDOWN) {
+          this->component.doDispatch();
+        }
+        this->component.Run_handler(0,0);
+      }
+    }
+
+    // The high priority file went first
+    ASSERT_CMD_RESPONSE_SIZE(2);
+    ASSERT_CMD_RESPONSE(0, FileDownlink::OPCODE_SENDFILEPRIORITY, CMD_SEQ + 1, Fw::CmdResponse::OK);
+    ASSERT_CMD_RESPONSE(1, FileDownlink::OPCODE_SENDFILE, CMD_SEQ, Fw::CmdResponse::OK);
+    ASSERT_EVENTS_SendStarted_SIZE(2);
+    ASSERT_EVENTS_SendStarted(0, 10, highFileName, destFileName);
+    ASSERT_EVENTS_SendStarted(1, 10, lowFileName, destFileName);
+    ASSERT_EVENTS_FileSent_SIZE(2);
+
+    // Remove the outgoing files
+    this->removeFile(lowFileName);
+    this->removeFile(highFileName);
+  }
+
   // ----------------------------------------------------------------------
   // Handlers for from ports
   // ----------------------------------------------------------------------
@@ -408,6 +690,11 @@ namespace Svc {
     Fw::Buffer buffer_new = buffer;
     buffer_new.setData(data);
     pushFromPortEntry_bufferSendOut(buffer_new);
+    if (this->holdBuffers) {
+      ASSERT_LT(this->numHeldBuffers, FW_NUM_ARRAY_ELEMENTS(this->heldBuffers));
+      this->heldBuffers[this->numHeldBuffers++] = buffer;
+      return;
+    }
     invoke_to_bufferReturn(0, buffer);
   }
 
@@ -460,6 +747,12 @@ namespace Svc {
       this->component.get_SendFile_InputPort(0)
     );
 
+    // SendFilePriority
+    this->connect_to_SendFilePriority(
+      0,
+      this->component.get_SendFilePriority_InputPort(0)
+    );
+
     // timeCaller
     this->component.set_timeCaller_OutputPort(
         0,
@@ -599,6 +892,19 @@ namespace Svc {
     );
   }
 
+  void FileDownlinkTester ::
+    returnBuffer(const U32 index)
+  {
+    ASSERT_LT(index, this->numHeldBuffers);
+    Fw::Buffer buffer = this->heldBuffers[index];
+    for (U32 i = index + 1; i < this->numHeldBuffers; ++i) {
+      this->heldBuffers[i - 1] = this->heldBuffers[i];
+    }
+    --this->numHeldBuffers;
+    this->invoke_to_bufferReturn(0, buffer);
+    this->component.doDispatch();
+  }
+
   void FileDownlinkTester ::
     removeFile(const char *const name)
   {
@@ -18,7 +18,7 @@
 #include "FileDownlinkGTestBase.hpp"
 
 #define MAX_HISTORY_SIZE 10
-#define FILE_BUFFER_CAPACITY 100
+#define FILE_BUFFER_CAPACITY 1024
 
 namespace Svc {
 
@@ -90,7 +90,9 @@ namespace Svc {
 
       //! Construct object FileDownlinkTester
       //!
-      FileDownlinkTester();
+      explicit FileDownlinkTester(
+          const U32 windowSize = 1 //!< The window size to configure
+      );
 
       //! Destroy object FileDownlinkTester
       //!
@@ -135,6 +137,31 @@ namespace Svc {
       //!
       void sendFilePort();
 
+      //! Create a file F
+      //! Downlink F with a window of several buffers
+      //! Verify that all packets are sent before any buffer returns
+      //! Requires a window size of at least 3
+      //!
+      void downlinkWindowed();
+
+      //! Create a file F with more data packets than the window holds
+      //! Downlink F, holding the buffers sent
+      //! Verify that sending stops when the window is full and resumes as buffers return
+      //!
+      void downlinkWindowFull();
+
+      //! Create a file F with more data packets than the window holds
+      //! Downlink F, returning the newest buffer first
+      //! Verify that the packets are sent in order with the right checksum
+      //!
+      void downlinkWindowOutOfOrder();
+
+      //! Queue a file F at the default priority, then a file G at a higher priority
+      //! Verify that G is downlinked before F
+      //! Verify that an out of range priority is rejected
+      //!
+      void downlinkPriority();
+
     private:
 
       // ----------------------------------------------------------------------
@@ -203,6 +230,12 @@ namespace Svc {
           const Fw::CmdResponse response //!< The expected command response
       );
 
+      //! Return a held buffer to the component and dispatch the return
+      //!
+      void returnBuffer(
+          const U32 index //!< The index of the held buffer
+      );
+
       //! Remove a file
       //!
       void removeFile(
@@ -280,6 +313,18 @@ namespace Svc {
       //!
       U32 buffers_index;
 
+      //! Whether to hold sent buffers instead of returning them
+      //!
+      bool holdBuffers;
+
+      //! Buffers sent and not yet returned, in the order sent
+      //!
+      Fw::Buffer heldBuffers[FILEDOWNLINK_MAX_WINDOW_SIZE + 1];
+
+      //! The number of held buffers
+      //!
+      U32 numHeldBuffers;
+
       //! The current sequence index
       //!
       U32 sequenceIndex;
@@ -16,6 +16,21 @@
 
 namespace Svc {
 
+  static_assert(
+      FILEUPLINK_WRITE_ALIGNMENT > 0 && FILEUPLINK_WRITE_BUFFER_SIZE % FILEUPLINK_WRITE_ALIGNMENT == 0,
+      "write alignment must divide the write buffer size"
+  );
+
+  //! Round a file offset down to a block boundary
+  static U32 alignDown(const U32 offset) {
+    return offset / FILEUPLINK_WRITE_ALIGNMENT * FILEUPLINK_WRITE_ALIGNMENT;
+  }
+
+  //! Round a file offset up to a block boundary
+  static U32 alignUp(const U32 offset) {
+    return alignDown(offset + FILEUPLINK_WRITE_ALIGNMENT - 1);
+  }
+
   Os::File::Status FileUplink::File ::
     open(const Fw::FilePacket::StartPacket& startPacket)
   {
@@ -28,6 +43,9 @@ namespace Svc {
     this->size = startPacket.getFileSize();
     CFDP::Checksum checksum;
     this->m_checksum = checksum;
+    this->m_numExtents = 0;
+    this->m_position = 0;
+    this->m_positionKnown = true;
     return this->osFile.open(path, Os::File::OPEN_WRITE);
   }
 
@@ -39,20 +57,223 @@ namespace Svc {
     )
   {
 
+    // Report a closed file right away rather than on the next flush
+    if (not this->osFile.isOpen()) {
+        return Os::File::NOT_OPENED;
+    }
+    if (length == 0) {
+        return Os::File::OP_OK;
+    }
+
     Os::File::Status status;
-    status = this->osFile.seek(byteOffset, Os::File::SeekType::ABSOLUTE);
-    if (status != Os::File::OP_OK) {
+    if (not this->canBuffer(byteOffset, length)) {
+        // Write out the whole blocks first, and everything if the data still does not fit
+        status = this->flushBlocks();
+        if (status == Os::File::OP_OK && not this->canBuffer(byteOffset, length)) {
+            status = this->flush();
+        }
+        if (status != Os::File::OP_OK) {
+            return status;
+        }
+    }
+
+    // Data too large for the buffer goes straight to the OS file
+    if (length > FILEUPLINK_WRITE_BUFFER_SIZE) {
+        return this->writeOut(data, byteOffset, length);
+    }
+
+    if (this->m_numExtents == 0) {
+        this->m_bufferOffset = byteOffset;
+    } else if (byteOffset < this->m_bufferOffset) {
+        // Move the buffered bytes up to make room for data just before them
+        const Extent& last = this->m_extents[this->m_numExtents - 1];
+        const U32 shift = this->m_bufferOffset - byteOffset;
+        memmove(&this->m_buffer[shift], &this->m_buffer[0], last.offset + last.length - this->m_bufferOffset);
+        this->m_bufferOffset = byteOffset;
+    }
+    memcpy(&this->m_buffer[byteOffset - this->m_bufferOffset], data, length);
+    this->addExtent(byteOffset, length);
+    return Os::File::OP_OK;
+
+  }
+
+  Os::File::Status FileUplink::File ::
+    flush()
+  {
+    Os::File::Status status = Os::File::OP_OK;
+    // Write the ranges in offset order, so each contiguous range is a single write
+    for (U32 i = 0; i < this->m_numExtents && status == Os::File::OP_OK; i++) {
+        const Extent& extent = this->m_extents[i];
+        status = this->writeOut(
+            &this->m_buffer[extent.offset - this->m_bufferOffset],
+            extent.offset,
+            extent.length
+        );
+    }
+    this->m_numExtents = 0;
+    return status;
+  }
+
+  Os::File::Status FileUplink::File ::
+    flushBlocks()
+  {
+    // Count the partly filled blocks at the ends of the ranges, which stay in the buffer
+    U32 numKept = 0;
+    for (U32 i = 0; i < this->m_numExtents; i++) {
+        const Extent& extent = this->m_extents[i];
+        const U32 end = extent.offset + extent.length;
+        const U32 first = alignUp(extent.offset);
+        const U32 last = alignDown(end);
+        if (first >= last) {
+            numKept++;
+        } else {
+            numKept += ((extent.offset < first) ? 1 : 0) + ((last < end) ? 1 : 0);
+        }
+    }
+    if (numKept > FILEUPLINK_MAX_EXTENTS) {
+        return this->flush();
+    }
+
+    // Write the whole blocks of each range and note the rest
+    Extent kept[FILEUPLINK_MAX_EXTENTS];
+    numKept = 0;
+    Os::File::Status status = Os::File::OP_OK;
+    for (U32 i = 0; i < this->m_numExtents && status == Os::File::OP_OK; i++) {
+        const Extent& extent = this->m_extents[i];
+        const U32 end = extent.offset + extent.length;
+        const U32 first = alignUp(extent.offset);
+        const U32 last = alignDown(end);
+        if (first >= last) {
+            kept[numKept++] = extent;
+            continue;
+        }
+        if (extent.offset < first) {
+            kept[numKept].offset = extent.offset;
+            kept[numKept].length = first - extent.offset;
+            numKept++;
+        }
+        status = this->writeOut(&this->m_buffer[first - this->m_bufferOffset], first, last - first);
+        if (last < end) {
+            kept[numKept].offset = last;
+            kept[numKept].length = end - last;
+            numKept++;
+        }
+    }
+    if (status != Os::File::OP_OK || numKept == 0) {
+        this->m_numExtents = 0;
         return status;
     }
 
+    // Move the kept bytes to the front of the buffer
+    const U32 keptStart = kept[0].offset;
+    const U32 keptEnd = kept[numKept - 1].offset + kept[numKept - 1].length;
+    memmove(&this->m_buffer[0], &this->m_buffer[keptStart - this->m_bufferOffset], keptEnd - keptStart);
+    this->m_bufferOffset = keptStart;
+    for (U32 i = 0; i < numKept; i++) {
+        this->m_extents[i] = kept[i];
+    }
+    this->m_numExtents = numKept;
+    return Os::File::OP_OK;
+  }
+
+  bool FileUplink::File ::
+    canBuffer(
+        const U32 byteOffset,
+        const U32 length
+    ) const
+  {
+    if (this->m_numExtents == 0) {
+        return true;
+    }
+    // The buffered bytes and the new bytes must fit in the buffer together
+    const Extent& last = this->m_extents[this->m_numExtents - 1];
+    const U32 start = FW_MIN(byteOffset, this->m_bufferOffset);
+    const U32 end = FW_MAX(byteOffset + length, last.offset + last.length);
+    if (end - start > FILEUPLINK_WRITE_BUFFER_SIZE) {
+        return false;
+    }
+    // Overlapping data is not buffered, so every packet updates the checksum once as it did before
+    bool adjacent = false;
+    for (U32 i = 0; i < this->m_numExtents; i++) {
+        const Extent& extent = this->m_extents[i];
+        if (byteOffset < extent.offset + extent.length && extent.offset < byteOffset + length) {
+            return false;
+        }
+        if (byteOffset == extent.offset + extent.length || byteOffset + length == extent.offset) {
+            adjacent = true;
+        }
+    }
+    return adjacent || this->m_numExtents < FILEUPLINK_MAX_EXTENTS;
+  }
+
+  void FileUplink::File ::
+    addExtent(
+        const U32 byteOffset,
+        const U32 length
+    )
+  {
+    // Find the first range after the new one
+    U32 index = 0;
+    while (index < this->m_numExtents && this->m_extents[index].offset < byteOffset) {
+        index++;
+    }
+    const bool joinPrevious = (index > 0) &&
+        (this->m_extents[index - 1].offset + this->m_extents[index - 1].length == byteOffset);
+    const bool joinNext = (index < this->m_numExtents) &&
+        (byteOffset + length == this->m_extents[index].offset);
+
+    if (joinPrevious && joinNext) {
+        // The new range fills the gap between two ranges
+        this->m_extents[index - 1].length += length + this->m_extents[index].length;
+        for (U32 i = index + 1; i < this->m_numExtents; i++) {
+            this->m_extents[i - 1] = this->m_extents[i];
+        }
+        this->m_numExtents--;
+    } else if (joinPrevious) {
+        this->m_extents[index - 1].length += length;
+    } else if (joinNext) {
+        this->m_extents[index].offset = byteOffset;
+        this->m_extents[index].length += length;
+    } else {
+        FW_ASSERT(this->m_numExtents < FILEUPLINK_MAX_EXTENTS, this->m_numExtents);
+        for (U32 i = this->m_numExtents; i > index; i--) {
+            this->m_extents[i] = this->m_extents[i - 1];
+        }
+        this->m_extents[index].offset = byteOffset;
+        this->m_extents[index].length = length;
+        this->m_numExtents++;
+    }
+  }
+
+  Os::File::Status FileUplink::File ::
+    writeOut(
+        const U8 *const data,
+        const U32 byteOffset,
+        const U32 length
+    )
+  {
+
+    Os::File::Status status;
+    // Only seek when the data does not follow on from the last write
+    if (not this->m_positionKnown || this->m_position != byteOffset) {
+        this->m_positionKnown = false;
+        status = this->osFile.seek(byteOffset, Os::File::SeekType::ABSOLUTE);
+        if (status != Os::File::OP_OK) {
+            return status;
+        }
+    }
+
     FwSignedSizeType intLength = length;
     //Note: not waiting for the file write to finish
+    this->m_positionKnown = false;
     status = this->osFile.write(data, intLength, Os::File::WaitType::NO_WAIT);
     if (status != Os::File::OP_OK) {
         return status;
     }
 
     FW_ASSERT(static_cast<U32>(intLength) == length, intLength);
+    this->m_position = byteOffset + length;
+    this->m_positionKnown = true;
     this->m_checksum.update(data, byteOffset, length);
     return Os::File::OP_OK;
 
@@ -108,7 +108,7 @@ namespace Svc {
     this->log_WARNING_HI_PacketOutOfOrder_ThrottleClear();
     this->m_packetsReceived.packetReceived();
     if (this->m_receiveMode != START) {
-      this->m_file.osFile.close();
+      this->closeFile();
       this->m_warnings.invalidReceiveMode(Fw::FilePacket::T_START);
     }
     const Os::File::Status status = this->m_file.open(startPacket);
@@ -154,6 +154,10 @@ namespace Svc {
     if (this->m_receiveMode == DATA) {
       this->m_filesReceived.fileReceived();
       this->checkSequenceIndex(endPacket.asHeader().getSequenceIndex());
+      // Write out buffered data so the checksum covers the whole file
+      if (this->m_file.flush() != Os::File::OP_OK) {
+        this->m_warnings.fileWrite(this->m_file.name);
+      }
       this->compareChecksums(endPacket);
       this->log_ACTIVITY_HI_FileReceived(this->m_file.name);
     }
@@ -198,9 +202,18 @@ namespace Svc {
   }
 
   void FileUplink ::
-    goToStartMode()
+    closeFile()
   {
+    if (this->m_file.flush() != Os::File::OP_OK) {
+      this->m_warnings.fileWrite(this->m_file.name);
+    }
     this->m_file.osFile.close();
+  }
+
+  void FileUplink ::
+    goToStartMode()
+  {
+    this->closeFile();
     this->m_receiveMode = START;
     this->m_lastSequenceIndex = 0;
   }
@@ -13,6 +13,7 @@
 #ifndef Svc_FileUplink_HPP
 #define Svc_FileUplink_HPP
 
+#include <FileUplinkCfg.hpp>
 #include <Svc/FileUplink/FileUplinkComponentAc.hpp>
 #include <Fw/FilePacket/FilePacket.hpp>
 #include <Os/File.hpp>
@@ -33,8 +34,14 @@ namespace Svc {
       typedef enum { START, DATA } ReceiveMode;
 
       //! An object representing an incoming file
+      //! Data is gathered in a write-behind buffer and written to the OS file in larger pieces
       class File {
 
+        public:
+
+          //! Constructor
+          File() : size(0), m_bufferOffset(0), m_numExtents(0), m_position(0), m_positionKnown(false) { }
+
         public:
 
           //! The file size
@@ -48,9 +55,33 @@ namespace Svc {
 
         PRIVATE:
 
+          //! A range of file bytes held in the write buffer
+          struct Extent {
+            U32 offset; //!< Offset of the range in the file
+            U32 length; //!< Length of the range
+          };
+
           //! The checksum for the file
           ::CFDP::Checksum m_checksum;
 
+          //! Write-behind buffer holding data not yet written to the OS file
+          U8 m_buffer[FILEUPLINK_WRITE_BUFFER_SIZE];
+
+          //! File offset of the start of the write buffer
+          U32 m_bufferOffset;
+
+          //! Ranges held in the write buffer, sorted by offset and not adjacent to each other
+          Extent m_extents[FILEUPLINK_MAX_EXTENTS];
+
+          //! Number of ranges held in the write buffer
+          U32 m_numExtents;
+
+          //! Position of the OS file after the last write
+          U32 m_position;
+
+          //! Whether m_position is known to match the OS file
+          bool m_positionKnown;
+
         public:
 
           //! Open the OS file for writing and initialize the checksum
@@ -58,18 +89,47 @@ namespace Svc {
               const Fw::FilePacket::StartPacket& startPacket
           );
 
-          //! Write bytes into the OS file and update the checksum
+          //! Write bytes into the file
+          //! The bytes may be held in the write buffer until a later write or flush
           Os::File::Status write(
               const U8 *const data,
               const U32 byteOffset,
               const U32 length
           );
 
-          //! Get the checksum
+          //! Write all buffered bytes into the OS file and update the checksum
+          Os::File::Status flush();
+
+          //! Get the checksum of the bytes written to the OS file
           void getChecksum(::CFDP::Checksum& checksum) {
             checksum = this->m_checksum;
           }
 
+        PRIVATE:
+
+          //! Write the whole aligned blocks in the write buffer into the OS file and update the checksum
+          //! Partly filled blocks stay in the buffer, unless there are too many ranges to hold them
+          Os::File::Status flushBlocks();
+
+          //! Check whether bytes can be added to the write buffer without writing it out first
+          bool canBuffer(
+              const U32 byteOffset,
+              const U32 length
+          ) const;
+
+          //! Record a range added to the write buffer, merging it with adjacent ranges
+          void addExtent(
+              const U32 byteOffset,
+              const U32 length
+          );
+
+          //! Write bytes directly into the OS file and update the checksum
+          Os::File::Status writeOut(
+              const U8 *const data,
+              const U32 byteOffset,
+              const U32 length
+          );
+
       };
 
       //! Object to record files received
@@ -256,6 +316,9 @@ namespace Svc {
       //! Compare checksums
       void compareChecksums(const Fw::FilePacket::EndPacket& endPacket);
 
+      //! Write out buffered data and close the file
+      void closeFile();
+
       //! Go to START mode
       void goToStartMode();
 
@@ -59,6 +59,16 @@ TEST(FileUplink, CancelPacketInDataMode) {
   tester.cancelPacketInDataMode();
 }
 
+TEST(FileUplink, SendFileOutOfOrder) {
+  Svc::FileUplinkTester tester;
+  tester.sendFileOutOfOrder();
+}
+
+TEST(FileUplink, SendFileAligned) {
+  Svc::FileUplinkTester tester;
+  tester.sendFileAligned();
+}
+
 int main(int argc, char **argv) {
   ::testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
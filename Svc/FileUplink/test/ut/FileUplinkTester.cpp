@@ -460,6 +460,103 @@ namespace Svc {
 
   }
 
+  void FileUplinkTester ::
+    sendFileOutOfOrder()
+  {
+
+    const char *const sourcePath = "source.bin";
+    const char *const destPath = "dest.bin";
+    const U32 numPackets = 3;
+    U8 packetData[numPackets][5] = {
+      { 0, 1, 2, 3, 4 },
+      { 5, 6, 7, 8, 9 },
+      { 10, 11, 12, 13, 14 }
+    };
+    const U8 *const linearPacketData = reinterpret_cast<U8*>(packetData);
+    const size_t fileSize = sizeof(packetData);
+
+    // Send the start packet
+    this->sendStartPacket(sourcePath, destPath, fileSize);
+    ASSERT_EVENTS_SIZE(0);
+
+    // Send the last and first data packets, leaving a gap between them
+    this->sendDataPacket(2 * PACKET_SIZE, packetData[2]);
+    this->sendDataPacket(0, packetData[0]);
+    ASSERT_EVENTS_SIZE(0);
+    ASSERT_EQ(2U, this->component.m_file.m_numExtents);
+
+    // Fill the gap, joining the buffered data into one range
+    this->sendDataPacket(PACKET_SIZE, packetData[1]);
+    ASSERT_EVENTS_SIZE(0);
+    ASSERT_EQ(1U, this->component.m_file.m_numExtents);
+
+    // Send the end packet
+    CFDP::Checksum checksum;
+    checksum.update(linearPacketData, 0, fileSize);
+    this->sendEndPacket(checksum);
+    ASSERT_TLM_FilesReceived(0, 1);
+    ASSERT_EVENTS_SIZE(1);
+    ASSERT_EVENTS_FileReceived(0, destPath);
+    ASSERT_EQ(0U, this->component.m_file.m_numExtents);
+
+    // Verify the file data
+    this->verifyFileData(destPath, linearPacketData, fileSize);
+
+    // Remove the file
+    this->removeFile(destPath);
+
+  }
+
+  void FileUplinkTester ::
+    sendFileAligned()
+  {
+
+    const char *const sourcePath = "source.bin";
+    const char *const destPath = "dest.bin";
+    // Enough packets to spill past the write buffer
+    const U32 numPackets = FILEUPLINK_WRITE_BUFFER_SIZE / PACKET_SIZE + 10;
+    U8 packetData[numPackets][PACKET_SIZE];
+    for (U32 i = 0; i < numPackets; ++i) {
+      for (U32 j = 0; j < PACKET_SIZE; ++j) {
+        packetData[i][j] = static_cast<U8>(i * PACKET_SIZE + j);
+      }
+    }
+    const U8 *const linearPacketData = reinterpret_cast<U8*>(packetData);
+    const size_t fileSize = sizeof(packetData);
+
+    // Send the start packet
+    this->sendStartPacket(sourcePath, destPath, fileSize);
+    ASSERT_EVENTS_SIZE(0);
+
+    // Send the data packets
+    for (U32 i = 0; i < numPackets; ++i) {
+      this->sendDataPacket(i * PACKET_SIZE, packetData[i]);
+    }
+    ASSERT_EVENTS_SIZE(0);
+
+    // Only whole blocks have been written, and the partly filled block is still buffered
+    ASSERT_EQ(1U, this->component.m_file.m_numExtents);
+    ASSERT_LT(0U, this->component.m_file.m_bufferOffset);
+    ASSERT_EQ(0U, this->component.m_file.m_bufferOffset % FILEUPLINK_WRITE_ALIGNMENT);
+    ASSERT_EQ(this->component.m_file.m_bufferOffset, this->component.m_file.m_position);
+
+    // Send the end packet
+    CFDP::Checksum checksum;
+    checksum.update(linearPacketData, 0, fileSize);
+    this->sendEndPacket(checksum);
+    ASSERT_TLM_FilesReceived(0, 1);
+    ASSERT_EVENTS_SIZE(1);
+    ASSERT_EVENTS_FileReceived(0, destPath);
+    ASSERT_EQ(0U, this->component.m_file.m_numExtents);
+
+    // Verify the file data
+    this->verifyFileData(destPath, linearPacketData, fileSize);
+
+    // Remove the file
+    this->removeFile(destPath);
+
+  }
+
   // ----------------------------------------------------------------------
   // Handlers for from ports
   // ----------------------------------------------------------------------
@@ -88,6 +88,14 @@ namespace Svc {
       //!
       void cancelPacketInDataMode();
 
+      //! Send a file with data packets out of byte order
+      //!
+      void sendFileOutOfOrder();
+
+      //! Send a file larger than the write buffer, written in aligned blocks
+      //!
+      void sendFileAligned();
+
     private:
 
       // ----------------------------------------------------------------------
@@ -22,7 +22,7 @@ namespace Svc {
 // ----------------------------------------------------------------------
 
 Framer ::Framer(const char* const compName)
-    : FramerComponentBase(compName), FramingProtocolInterface(), m_protocol(nullptr), m_frame_sent(false) {}
+    : FramerComponentBase(compName), FramingProtocolInterface(), m_protocol(nullptr), m_frame_sent(false), m_in_batch(false) {}
 
 void Framer ::init(const NATIVE_INT_TYPE instance) {
     FramerComponentBase::init(instance);
@@ -40,8 +40,8 @@ void Framer ::handle_framing(const U8* const data, const U32 size, Fw::ComPacket
     FW_ASSERT(this->m_protocol != nullptr);
     this->m_frame_sent = false;  // Clear the flag to detect if frame was sent
     this->m_protocol->frame(data, size, packet_type);
-    // If no frame was sent, Framer has the obligation to report success
-    if (this->isConnected_comStatusOut_OutputPort(0) && (!this->m_frame_sent)) {
+    // If no frame was sent, Framer has the obligation to report success unless the batch is answered as a whole
+    if (this->isConnected_comStatusOut_OutputPort(0) && (!this->m_frame_sent) && (!this->m_in_batch)) {
         Fw::Success status = Fw::Success::SUCCESS;
         this->comStatusOut_out(0, status);
     }
@@ -67,6 +67,13 @@ void Framer ::comStatusIn_handler(const NATIVE_INT_TYPE portNum, Fw::Success& co
     }
 }
 
+void Framer ::comBatchIn_handler(const NATIVE_INT_TYPE portNum, bool start) {
+    // The downstream component answers the batch with one status, so it must see the batch too
+    FW_ASSERT(this->isConnected_comBatchOut_OutputPort(0));
+    this->m_in_batch = start;
+    this->comBatchOut_out(0, start);
+}
+
 // ----------------------------------------------------------------------
 // Framing protocol implementations
 // ----------------------------------------------------------------------
@@ -75,6 +75,11 @@ class Framer : public FramerComponentBase, public FramingProtocolInterface {
     void comStatusIn_handler(const NATIVE_INT_TYPE portNum, /*!< The port number*/
                              Fw::Success& condition /*!< The condition*/);
 
+    //! Handler implementation for comBatchIn
+    //!
+    void comBatchIn_handler(const NATIVE_INT_TYPE portNum, /*!< The port number*/
+                            bool start /*!< True before the first packet of the batch, false after the last*/);
+
     // ----------------------------------------------------------------------
     // Implementation of FramingProtocolInterface
     // ----------------------------------------------------------------------
@@ -111,6 +116,9 @@ class Framer : public FramerComponentBase, public FramingProtocolInterface {
 
     //! Flag determining if at least one frame was sent during framing
     bool m_frame_sent;
+
+    //! Flag determining if a batch is open, during which the downstream component answers for the whole batch
+    bool m_in_batch;
 };
 
 }  // end namespace Svc
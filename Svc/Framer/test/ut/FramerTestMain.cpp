@@ -51,6 +51,13 @@ TEST(Nominal, NoSendStatus) {
     tester.test_no_send_status();
 }
 
+TEST(Nominal, BatchNoSendStatus) {
+    COMMENT("Ensure no status on no-send within a batch");
+    REQUIREMENT("SVC-FRAMER-006");
+    Svc::FramerTester tester;
+    tester.test_batch_no_send_status();
+}
+
 TEST(SendError, Buffer) {
     COMMENT("Send one Fw::Buffer to the framer (send error)");
     REQUIREMENT("SVC-FRAMER-002");
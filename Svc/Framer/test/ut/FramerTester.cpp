@@ -121,6 +121,34 @@ void FramerTester ::test_no_send_status() {
     test_status_pass_through();
 }
 
+void FramerTester ::test_batch_no_send_status() {
+    m_mock.m_do_not_send = true;
+    invoke_to_comBatchIn(0, true);
+    ASSERT_from_comBatchOut_SIZE(1);
+    ASSERT_from_comBatchOut(0, true);
+
+    // Send com buffers and check no send and no status, as the downstream component answers the batch
+    Fw::ComBuffer com;
+    invoke_to_comIn(0, com, 0);
+    invoke_to_comIn(0, com, 0);
+    Fw::Buffer buffer(new U8[3412], 3412);
+    invoke_to_bufferIn(0, buffer);
+    ASSERT_from_framedOut_SIZE(0);
+    ASSERT_from_comStatusOut_SIZE(0);
+
+    invoke_to_comBatchIn(0, false);
+    ASSERT_from_comBatchOut_SIZE(2);
+    ASSERT_from_comBatchOut(1, false);
+    ASSERT_from_comStatusOut_SIZE(0);
+    clearFromPortHistory();
+
+    // Outside the batch the status on no-send returns
+    Fw::Success status = Fw::Success::SUCCESS;
+    invoke_to_comIn(0, com, 0);
+    ASSERT_from_comStatusOut_SIZE(1);
+    ASSERT_from_comStatusOut(0, status);
+}
+
 void FramerTester ::check_last_buffer(Fw::Buffer buffer) {
     ASSERT_EQ(buffer, m_buffer);
 }
@@ -157,6 +185,10 @@ void FramerTester ::from_comStatusOut_handler(const NATIVE_INT_TYPE portNum, Fw:
     this->pushFromPortEntry_comStatusOut(condition);
 }
 
+void FramerTester ::from_comBatchOut_handler(const NATIVE_INT_TYPE portNum, bool start) {
+    this->pushFromPortEntry_comBatchOut(start);
+}
+
 // ----------------------------------------------------------------------
 // Helper methods
 // ----------------------------------------------------------------------
@@ -182,6 +214,12 @@ void FramerTester ::connectPorts() {
 
     // comStatusOut
     this->component.set_comStatusOut_OutputPort(0, this->get_from_comStatusOut(0));
+
+    // comBatchIn
+    this->connect_to_comBatchIn(0, this->component.get_comBatchIn_InputPort(0));
+
+    // comBatchOut
+    this->component.set_comBatchOut_OutputPort(0, this->get_from_comBatchOut(0));
 }
 
 void FramerTester ::initComponents() {
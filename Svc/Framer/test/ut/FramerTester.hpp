@@ -69,6 +69,9 @@ class FramerTester : public FramerGTestBase {
     //! Tests statuses on no-send
     void test_no_send_status();
 
+    //! Tests that no-send statuses are held within a batch
+    void test_batch_no_send_status();
+
     //! Check that buffer is equal to the last buffer allocated
     void check_last_buffer(Fw::Buffer buffer);
 
@@ -103,6 +106,13 @@ class FramerTester : public FramerGTestBase {
         Fw::Success &condition /*!< Condition success/failure */
     );
 
+    //! Handler for from_comBatchOut
+    //!
+    void from_comBatchOut_handler(
+        const NATIVE_INT_TYPE portNum, /*!< The port number*/
+        bool start /*!< True before the first packet of the batch*/
+    );
+
   public:
 
     // ----------------------------------------------------------------------
@@ -24,7 +24,8 @@ namespace Svc {
 // Construction, initialization, and destruction
 // ----------------------------------------------------------------------
 
-GenericHubComponentImpl ::GenericHubComponentImpl(const char* const compName) : GenericHubComponentBase(compName) {}
+GenericHubComponentImpl ::GenericHubComponentImpl(const char* const compName)
+    : GenericHubComponentBase(compName), m_transferSize(0), m_pendingSize(0) {}
 
 void GenericHubComponentImpl ::init(const NATIVE_INT_TYPE instance) {
     GenericHubComponentBase::init(instance);
@@ -32,24 +33,123 @@ void GenericHubComponentImpl ::init(const NATIVE_INT_TYPE instance) {
 
 GenericHubComponentImpl ::~GenericHubComponentImpl() {}
 
+void GenericHubComponentImpl ::configure(const U32 transferSize) {
+    FW_ASSERT(this->m_pendingSize == 0, this->m_pendingSize);
+    this->m_transferSize = transferSize;
+}
+
+bool GenericHubComponentImpl ::coalesces(const HubType type) const {
+    // Buffers pass their transfer on as the outgoing buffer on the remote side, so they cannot share it
+    return (this->m_transferSize > 0) && (type != HUB_TYPE_BUFFER);
+}
+
 void GenericHubComponentImpl ::send_data(const HubType type,
                                          const NATIVE_INT_TYPE port,
                                          const U8* data,
                                          const U32 size) {
     FW_ASSERT(data != nullptr);
-    Fw::SerializeStatus status;
-    // Buffer to send and a buffer used to write to it
-    Fw::Buffer outgoing = dataOutAllocate_out(0, size + sizeof(U32) + sizeof(U32) + sizeof(FwBuffSizeType));
-    Fw::SerializeBufferBase& serialize = outgoing.getSerializeRepr();
-    // Write data to our buffer
-    status = serialize.serialize(static_cast<U32>(type));
+    Fw::ExternalSerializeBuffer payload;
+    bool pending = false;
+    Fw::Buffer outgoing = this->start_item(type, port, size, payload, pending);
+    Fw::SerializeStatus status = payload.serialize(data, size, true);
+    FW_ASSERT(status == Fw::FW_SERIALIZE_OK, static_cast<NATIVE_INT_TYPE>(status));
+    this->finish_item(pending, outgoing, payload);
+}
+
+Fw::Buffer GenericHubComponentImpl ::start_item(const HubType type,
+                                                const NATIVE_INT_TYPE port,
+                                                const U32 size,
+                                                Fw::ExternalSerializeBuffer& payload,
+                                                bool& pending) {
+    FW_ASSERT(size <= static_cast<FwBuffSizeType>(-1), size);
+    const U32 itemSize = ITEM_HEADER_SIZE + size;
+    Fw::Buffer outgoing;
+    U32 offset = 0;
+    pending = false;
+    if (this->coalesces(type)) {
+        this->m_lock.lock();
+        if ((this->m_pendingSize > 0) && (this->m_pendingSize + itemSize > this->m_pending.getSize())) {
+            // Send the full transfer first, keeping the order of port calls
+            Fw::Buffer full;
+            (void)this->take_pending(full);
+            this->m_lock.unLock();
+            dataOut_out(0, full);
+            this->m_lock.lock();
+        }
+        if ((this->m_pendingSize > 0) && (this->m_pendingSize + itemSize <= this->m_pending.getSize())) {
+            offset = this->m_pendingSize;
+            this->m_pendingSize += itemSize;
+            outgoing = this->m_pending;
+            pending = true;
+        } else {
+            this->m_lock.unLock();
+            outgoing = dataOutAllocate_out(0, FW_MAX(this->m_transferSize, itemSize));
+            FW_ASSERT(outgoing.getSize() >= itemSize, outgoing.getSize(), itemSize);
+            this->m_lock.lock();
+            if (this->m_pendingSize == 0) {
+                this->m_pending = outgoing;
+                this->m_pendingSize = itemSize;
+                pending = true;
+            } else {
+                // Items added while the lock was released started another transfer, send this item on its own
+                this->m_lock.unLock();
+                outgoing.setSize(itemSize);
+            }
+        }
+    } else {
+        // Keep the order of port calls by sending those coalesced before
+        if (this->m_transferSize > 0) {
+            this->send_pending();
+        }
+        outgoing = dataOutAllocate_out(0, itemSize);
+        FW_ASSERT(outgoing.getSize() >= itemSize, outgoing.getSize(), itemSize);
+        outgoing.setSize(itemSize);
+    }
+    FW_ASSERT(outgoing.getSize() >= offset + itemSize, outgoing.getSize(), offset, itemSize);
+
+    // Write the header, then leave the data to the caller such that it is serialized in place
+    Fw::ExternalSerializeBuffer header(outgoing.getData() + offset, ITEM_HEADER_SIZE);
+    Fw::SerializeStatus status = header.serialize(static_cast<U32>(type));
     FW_ASSERT(status == Fw::FW_SERIALIZE_OK, static_cast<NATIVE_INT_TYPE>(status));
-    status = serialize.serialize(static_cast<U32>(port));
+    status = header.serialize(static_cast<U32>(port));
     FW_ASSERT(status == Fw::FW_SERIALIZE_OK, static_cast<NATIVE_INT_TYPE>(status));
-    status = serialize.serialize(data, size);
+    status = header.serialize(static_cast<FwBuffSizeType>(size));
     FW_ASSERT(status == Fw::FW_SERIALIZE_OK, static_cast<NATIVE_INT_TYPE>(status));
-    outgoing.setSize(serialize.getBuffLength());
-    dataOut_out(0, outgoing);
+    payload.setExtBuffer(outgoing.getData() + offset + ITEM_HEADER_SIZE, size);
+    return outgoing;
+}
+
+void GenericHubComponentImpl ::finish_item(const bool pending,
+                                           Fw::Buffer& outgoing,
+                                           const Fw::ExternalSerializeBuffer& payload) {
+    FW_ASSERT(payload.getBuffLength() == payload.getBuffCapacity(), payload.getBuffLength(),
+              payload.getBuffCapacity());
+    if (pending) {
+        this->m_lock.unLock();
+    } else {
+        dataOut_out(0, outgoing);
+    }
+}
+
+bool GenericHubComponentImpl ::take_pending(Fw::Buffer& transfer) {
+    if (this->m_pendingSize == 0) {
+        return false;
+    }
+    transfer = this->m_pending;
+    transfer.setSize(this->m_pendingSize);
+    this->m_pending = Fw::Buffer();
+    this->m_pendingSize = 0;
+    return true;
+}
+
+void GenericHubComponentImpl ::send_pending() {
+    Fw::Buffer transfer;
+    this->m_lock.lock();
+    const bool taken = this->take_pending(transfer);
+    this->m_lock.unLock();
+    if (taken) {
+        dataOut_out(0, transfer);
+    }
 }
 
 // ----------------------------------------------------------------------
@@ -62,84 +162,93 @@ void GenericHubComponentImpl ::buffersIn_handler(const NATIVE_INT_TYPE portNum,
 }
 
 void GenericHubComponentImpl ::dataIn_handler(const NATIVE_INT_TYPE portNum, Fw::Buffer& fwBuffer) {
-    HubType type = HUB_TYPE_MAX;
-    U32 type_in = 0;
-    U32 port = 0;
-    FwBuffSizeType size = 0;
     Fw::SerializeStatus status = Fw::FW_SERIALIZE_OK;
 
     // Representation of incoming data prepped for serialization
     Fw::SerializeBufferBase& incoming = fwBuffer.getSerializeRepr();
-    FW_ASSERT(incoming.setBuffLen(fwBuffer.getSize()) == Fw::FW_SERIALIZE_OK);
 
     // Must inform buffer that there is *real* data in the buffer
     status = incoming.setBuffLen(fwBuffer.getSize());
     FW_ASSERT(status == Fw::FW_SERIALIZE_OK, static_cast<NATIVE_INT_TYPE>(status));
-    status = incoming.deserialize(type_in);
-    FW_ASSERT(status == Fw::FW_SERIALIZE_OK, static_cast<NATIVE_INT_TYPE>(status));
-    type = static_cast<HubType>(type_in);
-    FW_ASSERT(type < HUB_TYPE_MAX, type);
-    status = incoming.deserialize(port);
-    FW_ASSERT(status == Fw::FW_SERIALIZE_OK, static_cast<NATIVE_INT_TYPE>(status));
-    status = incoming.deserialize(size);
-    FW_ASSERT(status == Fw::FW_SERIALIZE_OK, static_cast<NATIVE_INT_TYPE>(status));
 
-    // invokeSerial deserializes arguments before calling a normal invoke, this will return ownership immediately
-    U8* rawData = fwBuffer.getData() + sizeof(U32) + sizeof(U32) + sizeof(FwBuffSizeType);
-    U32 rawSize = fwBuffer.getSize() - sizeof(U32) - sizeof(U32) - sizeof(FwBuffSizeType);
-    FW_ASSERT(rawSize == static_cast<U32>(size));
-    if (type == HUB_TYPE_PORT) {
-        // Com buffer representations should be copied before the call returns, so we need not "allocate" new data
-        Fw::ExternalSerializeBuffer wrapper(rawData, rawSize);
-        status = wrapper.setBuffLen(rawSize);
-        FW_ASSERT(status == Fw::FW_SERIALIZE_OK, static_cast<NATIVE_INT_TYPE>(status));
-        portOut_out(port, wrapper);
-        // Deallocate the existing buffer
-        dataInDeallocate_out(0, fwBuffer);
-    } else if (type == HUB_TYPE_BUFFER) {
-        // Fw::Buffers can reuse the existing data buffer as the storage type!  No deallocation done.
-        fwBuffer.set(rawData, rawSize, fwBuffer.getContext());
-        buffersOut_out(port, fwBuffer);
-    } else if (type == HUB_TYPE_EVENT) {
-        FwEventIdType id;
-        Fw::Time timeTag;
-        Fw::LogSeverity severity;
-        Fw::LogBuffer args;
-
-        // Deserialize tokens for events
-        status = incoming.deserialize(id);
-        FW_ASSERT(status == Fw::FW_SERIALIZE_OK, static_cast<NATIVE_INT_TYPE>(status));
-        status = incoming.deserialize(timeTag);
+    // A transfer holds one or more items, each a header followed by its data
+    while (incoming.getBuffLeft() > 0) {
+        HubType type = HUB_TYPE_MAX;
+        U32 type_in = 0;
+        U32 port = 0;
+        FwBuffSizeType size = 0;
+
+        status = incoming.deserialize(type_in);
         FW_ASSERT(status == Fw::FW_SERIALIZE_OK, static_cast<NATIVE_INT_TYPE>(status));
-        status = incoming.deserialize(severity);
+        type = static_cast<HubType>(type_in);
+        FW_ASSERT(type < HUB_TYPE_MAX, type);
+        status = incoming.deserialize(port);
         FW_ASSERT(status == Fw::FW_SERIALIZE_OK, static_cast<NATIVE_INT_TYPE>(status));
-        status = incoming.deserialize(args);
+        status = incoming.deserialize(size);
         FW_ASSERT(status == Fw::FW_SERIALIZE_OK, static_cast<NATIVE_INT_TYPE>(status));
+        FW_ASSERT(size <= incoming.getBuffLeft(), size, incoming.getBuffLeft());
 
-        // Send it!
-        this->LogSend_out(port, id, timeTag, severity, args);
-
-        // Deallocate the existing buffer
-        dataInDeallocate_out(0, fwBuffer);
-    } else if (type == HUB_TYPE_CHANNEL) {
-        FwChanIdType id;
-        Fw::Time timeTag;
-        Fw::TlmBuffer val;
+        // invokeSerial deserializes arguments before calling a normal invoke, this will return ownership immediately
+        U8* rawData = const_cast<U8*>(incoming.getBuffAddrLeft());
+        U32 rawSize = static_cast<U32>(size);
+        if (type == HUB_TYPE_BUFFER) {
+            // Fw::Buffers can reuse the existing data buffer as the storage type!  No deallocation done.
+            // Buffers are sent on their own, so the item is the whole transfer.
+            FW_ASSERT(rawData == fwBuffer.getData() + ITEM_HEADER_SIZE);
+            FW_ASSERT(rawSize == fwBuffer.getSize() - ITEM_HEADER_SIZE, rawSize, fwBuffer.getSize());
+            fwBuffer.set(rawData, rawSize, fwBuffer.getContext());
+            buffersOut_out(port, fwBuffer);
+            return;
+        }
 
-        // Deserialize tokens for channels
-        status = incoming.deserialize(id);
-        FW_ASSERT(status == Fw::FW_SERIALIZE_OK, static_cast<NATIVE_INT_TYPE>(status));
-        status = incoming.deserialize(timeTag);
-        FW_ASSERT(status == Fw::FW_SERIALIZE_OK, static_cast<NATIVE_INT_TYPE>(status));
-        status = incoming.deserialize(val);
+        // Com buffer representations should be copied before the call returns, so we need not "allocate" new data
+        Fw::ExternalSerializeBuffer wrapper(rawData, rawSize);
+        status = wrapper.setBuffLen(rawSize);
         FW_ASSERT(status == Fw::FW_SERIALIZE_OK, static_cast<NATIVE_INT_TYPE>(status));
+        if (type == HUB_TYPE_PORT) {
+            portOut_out(port, wrapper);
+        } else if (type == HUB_TYPE_EVENT) {
+            FwEventIdType id;
+            Fw::Time timeTag;
+            Fw::LogSeverity severity;
+            Fw::LogBuffer args;
+
+            // Deserialize tokens for events
+            status = wrapper.deserialize(id);
+            FW_ASSERT(status == Fw::FW_SERIALIZE_OK, static_cast<NATIVE_INT_TYPE>(status));
+            status = wrapper.deserialize(timeTag);
+            FW_ASSERT(status == Fw::FW_SERIALIZE_OK, static_cast<NATIVE_INT_TYPE>(status));
+            status = wrapper.deserialize(severity);
+            FW_ASSERT(status == Fw::FW_SERIALIZE_OK, static_cast<NATIVE_INT_TYPE>(status));
+            status = wrapper.deserialize(args);
+            FW_ASSERT(status == Fw::FW_SERIALIZE_OK, static_cast<NATIVE_INT_TYPE>(status));
+
+            // Send it!
+            this->LogSend_out(port, id, timeTag, severity, args);
+        } else if (type == HUB_TYPE_CHANNEL) {
+            FwChanIdType id;
+            Fw::Time timeTag;
+            Fw::TlmBuffer val;
 
-        // Send it!
-        this->TlmSend_out(port, id, timeTag, val);
+            // Deserialize tokens for channels
+            status = wrapper.deserialize(id);
+            FW_ASSERT(status == Fw::FW_SERIALIZE_OK, static_cast<NATIVE_INT_TYPE>(status));
+            status = wrapper.deserialize(timeTag);
+            FW_ASSERT(status == Fw::FW_SERIALIZE_OK, static_cast<NATIVE_INT_TYPE>(status));
+            status = wrapper.deserialize(val);
+            FW_ASSERT(status == Fw::FW_SERIALIZE_OK, static_cast<NATIVE_INT_TYPE>(status));
 
-        // Deallocate the existing buffer
-        dataInDeallocate_out(0, fwBuffer);
+            // Send it!
+            this->TlmSend_out(port, id, timeTag, val);
+        }
+        if (rawSize > 0) {
+            status = incoming.deserializeSkip(rawSize);
+            FW_ASSERT(status == Fw::FW_SERIALIZE_OK, static_cast<NATIVE_INT_TYPE>(status));
+        }
     }
+
+    // Deallocate the existing buffer
+    dataInDeallocate_out(0, fwBuffer);
 }
 
 void GenericHubComponentImpl ::LogRecv_handler(const NATIVE_INT_TYPE portNum,
@@ -148,9 +257,12 @@ void GenericHubComponentImpl ::LogRecv_handler(const NATIVE_INT_TYPE portNum,
                                   const Fw::LogSeverity& severity,
                                   Fw::LogBuffer& args) {
     Fw::SerializeStatus status = Fw::FW_SERIALIZE_OK;
-    U8 buffer[sizeof(FwEventIdType) + Fw::Time::SERIALIZED_SIZE + Fw::LogSeverity::SERIALIZED_SIZE + FW_LOG_BUFFER_MAX_SIZE];
-    Fw::ExternalSerializeBuffer serializer(buffer, sizeof(buffer));
-    serializer.resetSer();
+    // Serialize straight into the transfer buffer
+    const U32 size = sizeof(FwEventIdType) + Fw::Time::SERIALIZED_SIZE + Fw::LogSeverity::SERIALIZED_SIZE +
+                     sizeof(FwSizeStoreType) + args.getBuffLength();
+    Fw::ExternalSerializeBuffer serializer;
+    bool pending = false;
+    Fw::Buffer outgoing = this->start_item(HubType::HUB_TYPE_EVENT, portNum, size, serializer, pending);
     status = serializer.serialize(id);
     FW_ASSERT(status == Fw::SerializeStatus::FW_SERIALIZE_OK);
     status = serializer.serialize(timeTag);
@@ -159,9 +271,7 @@ void GenericHubComponentImpl ::LogRecv_handler(const NATIVE_INT_TYPE portNum,
     FW_ASSERT(status == Fw::SerializeStatus::FW_SERIALIZE_OK);
     status = serializer.serialize(args);
     FW_ASSERT(status == Fw::SerializeStatus::FW_SERIALIZE_OK);
-    U32 size = serializer.getBuffLength();
-    this->send_data(HubType::HUB_TYPE_EVENT, portNum, buffer, size);
-
+    this->finish_item(pending, outgoing, serializer);
 }
 
 void GenericHubComponentImpl ::TlmRecv_handler(const NATIVE_INT_TYPE portNum,
@@ -169,17 +279,22 @@ void GenericHubComponentImpl ::TlmRecv_handler(const NATIVE_INT_TYPE portNum,
                                   Fw::Time& timeTag,
                                   Fw::TlmBuffer& val) {
     Fw::SerializeStatus status = Fw::FW_SERIALIZE_OK;
-    U8 buffer[sizeof(FwChanIdType) + Fw::Time::SERIALIZED_SIZE + FW_TLM_BUFFER_MAX_SIZE];
-    Fw::ExternalSerializeBuffer serializer(buffer, sizeof(buffer));
-    serializer.resetSer();
+    // Serialize straight into the transfer buffer
+    const U32 size = sizeof(FwChanIdType) + Fw::Time::SERIALIZED_SIZE + sizeof(FwSizeStoreType) + val.getBuffLength();
+    Fw::ExternalSerializeBuffer serializer;
+    bool pending = false;
+    Fw::Buffer outgoing = this->start_item(HubType::HUB_TYPE_CHANNEL, portNum, size, serializer, pending);
     status = serializer.serialize(id);
     FW_ASSERT(status == Fw::SerializeStatus::FW_SERIALIZE_OK);
     status = serializer.serialize(timeTag);
     FW_ASSERT(status == Fw::SerializeStatus::FW_SERIALIZE_OK);
     status = serializer.serialize(val);
     FW_ASSERT(status == Fw::SerializeStatus::FW_SERIALIZE_OK);
-    U32 size = serializer.getBuffLength();
-    this->send_data(HubType::HUB_TYPE_CHANNEL, portNum, buffer, size);
+    this->finish_item(pending, outgoing, serializer);
+}
+
+void GenericHubComponentImpl ::schedIn_handler(const NATIVE_INT_TYPE portNum, U32 context) {
+    this->send_pending();
 }
 
 // ----------------------------------------------------------------------
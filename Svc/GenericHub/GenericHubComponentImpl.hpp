@@ -14,6 +14,7 @@
 #define GenericHub_HPP
 
 #include "Svc/GenericHub/GenericHubComponentAc.hpp"
+#include "Os/Mutex.hpp"
 
 namespace Svc {
 
@@ -33,6 +34,9 @@ class GenericHubComponentImpl : public GenericHubComponentBase {
     };
 
     const static U32 GENERIC_HUB_DATA_SIZE = 1024;
+
+    //! Size of the header preceding the data of each port call: type, port and data size
+    const static U32 ITEM_HEADER_SIZE = sizeof(U32) + sizeof(U32) + sizeof(FwBuffSizeType);
     // ----------------------------------------------------------------------
     // Construction, initialization, and destruction
     // ----------------------------------------------------------------------
@@ -51,6 +55,14 @@ class GenericHubComponentImpl : public GenericHubComponentBase {
     //!
     ~GenericHubComponentImpl();
 
+    //! Configure coalescing of port calls
+    //!
+    //! Port, event and telemetry calls are serialized one after another into a transfer buffer of the given size,
+    //! which is sent when the next call does not fit or on the next schedIn call. Buffer calls are still sent in a
+    //! transfer of their own, after the coalesced calls. Call before the hub is used.
+    void configure(const U32 transferSize /*!< Size of transfer buffers. 0 sends each port call on its own*/
+    );
+
   PRIVATE:
     // ----------------------------------------------------------------------
     // Handler implementations for user-defined typed input ports
@@ -93,8 +105,43 @@ class GenericHubComponentImpl : public GenericHubComponentBase {
                         Fw::SerializeBufferBase& Buffer /*!< The serialization buffer*/
     );
 
+    //! Handler implementation for schedIn
+    //!
+    void schedIn_handler(const NATIVE_INT_TYPE portNum, /*!< The port number*/
+                         U32 context                    /*!< The call order*/
+    );
+
     // Helpers and members
     void send_data(const HubType type, const NATIVE_INT_TYPE port, const U8* data, const U32 size);
+
+    //! Start an item in a transfer buffer and set the payload serializer to its data. Items added to the pending
+    //! transfer are written with m_lock held until finish_item. The lock is never held while calling out of the hub,
+    //! such that events and telemetry raised by those calls may come back into the hub.
+    //! \return the transfer buffer holding the item
+    Fw::Buffer start_item(const HubType type,
+                          const NATIVE_INT_TYPE port,
+                          const U32 size,
+                          Fw::ExternalSerializeBuffer& payload, /*!< Set to the data of the item*/
+                          bool& pending /*!< Set to whether the item is in the pending transfer*/
+    );
+
+    //! Finish an item once its data was serialized, sending its transfer unless it is pending
+    void finish_item(const bool pending, Fw::Buffer& transfer, const Fw::ExternalSerializeBuffer& payload);
+
+    //! Take the pending transfer out of the hub if it holds items. Called with m_lock held.
+    //! \return whether there was a transfer to take
+    bool take_pending(Fw::Buffer& transfer /*!< Set to the pending transfer*/);
+
+    //! Send the pending transfer if it holds items. Called without m_lock held.
+    void send_pending();
+
+    //! Whether items of a type are coalesced
+    bool coalesces(const HubType type) const;
+
+    U32 m_transferSize;         //!< Size of transfer buffers, 0 if port calls are not coalesced
+    Fw::Buffer m_pending;       //!< Transfer buffer coalesced items are written to, if allocated
+    U32 m_pendingSize;          //!< Bytes of items in the pending transfer
+    Os::Mutex m_lock;           //!< Protects the pending transfer from concurrent port calls
 };
 
 }  // end namespace Svc
@@ -30,6 +30,16 @@ TEST(Nominal, TestTelemetry) {
     tester.test_telemetry();
 }
 
+TEST(Nominal, TestCoalescing) {
+    Svc::GenericHubTester tester;
+    tester.test_coalescing();
+}
+
+TEST(Nominal, TestReentrantSend) {
+    Svc::GenericHubTester tester;
+    tester.test_reentrant_send();
+}
+
 int main(int argc, char **argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
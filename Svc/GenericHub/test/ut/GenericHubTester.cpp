@@ -31,7 +31,8 @@ GenericHubTester ::GenericHubTester()
       m_buffer_in(0),
       m_comm_out(0),
       m_buffer_out(0),
-      m_current_port(0) {
+      m_current_port(0),
+      m_reentrant_events(0) {
     this->initComponents();
     this->connectPorts();
 }
@@ -81,9 +82,12 @@ void GenericHubTester ::test_random_io() {
 }
 
 void GenericHubTester ::random_fill(Fw::SerializeBufferBase& buffer, U32 max_size) {
-    U32 random_size = STest::Pick::lowerUpper(0, max_size);
+    random_fill_exact(buffer, STest::Pick::lowerUpper(0, max_size));
+}
+
+void GenericHubTester ::random_fill_exact(Fw::SerializeBufferBase& buffer, U32 size) {
     buffer.resetSer();
-    for (U32 i = 0; i < random_size; i++) {
+    for (U32 i = 0; i < size; i++) {
         buffer.serialize(static_cast<U8>(STest::Pick::any()));
     }
 }
@@ -116,6 +120,119 @@ void GenericHubTester ::test_events() {
     ASSERT_from_LogSend(0, 123, time, severity, buffer);
     clearFromPortHistory();
 }
+
+void GenericHubTester ::test_coalescing() {
+    Fw::LogSeverity severity = Fw::LogSeverity::WARNING_HI;
+    Fw::LogBuffer event;
+    Fw::TlmBuffer channel;
+    // Fixed sizes such that the ten calls and the com buffer below fit in one transfer of DATA_SIZE
+    random_fill_exact(event, 20);
+    random_fill_exact(channel, 16);
+    Fw::Time time(100, 200);
+    const U32 channelSize = GenericHubComponentImpl::ITEM_HEADER_SIZE + sizeof(FwChanIdType) +
+                            Fw::Time::SERIALIZED_SIZE + sizeof(FwSizeStoreType) + channel.getBuffLength();
+    const U32 eventSize = GenericHubComponentImpl::ITEM_HEADER_SIZE + sizeof(FwEventIdType) +
+                          Fw::Time::SERIALIZED_SIZE + Fw::LogSeverity::SERIALIZED_SIZE + sizeof(FwSizeStoreType) +
+                          event.getBuffLength();
+    const U32 comSize = GenericHubComponentImpl::ITEM_HEADER_SIZE + sizeof(FwSizeStoreType) + FW_COM_BUFFER_MAX_SIZE;
+    ASSERT_LE(5 * (channelSize + eventSize) + comSize, static_cast<U32>(DATA_SIZE));
+
+    // Calls are held until schedIn, then sent in one transfer and expanded in order on the remote side
+    this->componentIn.configure(DATA_SIZE);
+    for (U32 i = 0; i < 5; i++) {
+        invoke_to_TlmRecv(0, 100 + i, time, channel);
+        invoke_to_LogRecv(0, 200 + i, time, severity, event);
+    }
+    random_fill(m_comm, FW_COM_BUFFER_MAX_SIZE);
+    m_current_port = 0;
+    invoke_to_portIn(0, m_comm);
+    ASSERT_from_dataOut_SIZE(0);
+    ASSERT_EQ(m_comm_out, 0u);
+    invoke_to_schedIn(0, 0);
+    ASSERT_from_dataOut_SIZE(1);
+    ASSERT_from_dataInDeallocate_SIZE(1);
+    ASSERT_from_TlmSend_SIZE(5);
+    ASSERT_from_LogSend_SIZE(5);
+    for (U32 i = 0; i < 5; i++) {
+        ASSERT_from_TlmSend(i, 100 + i, time, channel);
+        ASSERT_from_LogSend(i, 200 + i, time, severity, event);
+    }
+    ASSERT_EQ(m_comm_out, 1u);
+    clearFromPortHistory();
+
+    // Nothing is sent without pending calls
+    invoke_to_schedIn(0, 0);
+    ASSERT_from_dataOut_SIZE(0);
+
+    // Buffers are sent on their own, after the pending calls
+    invoke_to_TlmRecv(0, 100, time, channel);
+    m_buffer.set(m_data_store, sizeof(m_data_store));
+    random_fill(m_buffer.getSerializeRepr(), FW_COM_BUFFER_MAX_SIZE);
+    m_buffer.setSize(m_buffer.getSerializeRepr().getBuffLength());
+    m_current_port = 0;
+    invoke_to_buffersIn(0, m_buffer);
+    ASSERT_from_dataOut_SIZE(2);
+    ASSERT_from_TlmSend_SIZE(1);
+    ASSERT_from_bufferDeallocate_SIZE(1);
+    ASSERT_EQ(m_buffer_out, 1u);
+    ASSERT_from_dataInDeallocate_SIZE(2);
+    clearFromPortHistory();
+
+    // A full transfer is sent when the next call does not fit
+    this->componentIn.configure(2 * channelSize);
+    for (U32 i = 0; i < 3; i++) {
+        invoke_to_TlmRecv(0, 100 + i, time, channel);
+    }
+    ASSERT_from_dataOut_SIZE(1);
+    ASSERT_EQ(fromPortHistory_dataOut->at(0).fwBuffer.getSize(), 2 * channelSize);
+    ASSERT_from_TlmSend_SIZE(2);
+    invoke_to_schedIn(0, 0);
+    ASSERT_from_dataOut_SIZE(2);
+    ASSERT_from_TlmSend_SIZE(3);
+    ASSERT_from_TlmSend(2, 102, time, channel);
+    clearFromPortHistory();
+}
+
+void GenericHubTester ::test_reentrant_send() {
+    Fw::TlmBuffer channel;
+    random_fill_exact(channel, 16);
+    Fw::Time time(100, 200);
+
+    // The driver raises an event while the hub sends, which comes back into the hub on the same thread
+    this->componentIn.configure(DATA_SIZE);
+    invoke_to_TlmRecv(0, 100, time, channel);
+    m_reentrant_events = 1;
+    invoke_to_schedIn(0, 0);
+    ASSERT_EQ(m_reentrant_events, 0u);
+    ASSERT_from_dataOut_SIZE(1);
+    ASSERT_from_TlmSend_SIZE(1);
+    ASSERT_from_TlmSend(0, 100, time, channel);
+    ASSERT_from_LogSend_SIZE(0);
+
+    // The event is pending for the next transfer
+    invoke_to_schedIn(0, 0);
+    ASSERT_from_dataOut_SIZE(2);
+    ASSERT_from_LogSend_SIZE(1);
+    ASSERT_EQ(fromPortHistory_LogSend->at(0).id, 300u);
+    clearFromPortHistory();
+
+    // The same holds for the transfers sent before a buffer
+    invoke_to_TlmRecv(0, 101, time, channel);
+    m_reentrant_events = 1;
+    m_buffer.set(m_data_store, sizeof(m_data_store));
+    random_fill(m_buffer.getSerializeRepr(), FW_COM_BUFFER_MAX_SIZE);
+    m_buffer.setSize(m_buffer.getSerializeRepr().getBuffLength());
+    m_current_port = 0;
+    invoke_to_schedIn(0, 0);
+    ASSERT_from_dataOut_SIZE(1);
+    ASSERT_from_TlmSend_SIZE(1);
+    invoke_to_buffersIn(0, m_buffer);
+    ASSERT_from_dataOut_SIZE(3);
+    ASSERT_from_LogSend_SIZE(1);
+    ASSERT_EQ(m_buffer_out, 1u);
+    clearFromPortHistory();
+}
+
 // Helpers
 
 void GenericHubTester ::send_random_comm(U32 port) {
@@ -172,6 +289,14 @@ void GenericHubTester ::from_dataOut_handler(const NATIVE_INT_TYPE portNum, Fw::
     // Reuse m_allocate to pass into the otherside of the hub
     this->pushFromPortEntry_dataOut(fwBuffer);
     invoke_to_dataIn(0, fwBuffer);
+    // Raise events into the sending hub, as a driver reporting through the hub would
+    if (m_reentrant_events > 0) {
+        m_reentrant_events--;
+        Fw::LogBuffer args;
+        Fw::Time time(100, 200);
+        Fw::LogSeverity severity = Fw::LogSeverity::WARNING_HI;
+        invoke_to_LogRecv(0, 300, time, severity, args);
+    }
 }
 
 // ----------------------------------------------------------------------
@@ -250,6 +375,9 @@ void GenericHubTester ::connectPorts() {
     // dataIn
     this->connect_to_dataIn(0, this->componentOut.get_dataIn_InputPort(0));
 
+    // schedIn
+    this->connect_to_schedIn(0, this->componentIn.get_schedIn_InputPort(0));
+
     // buffersOut
     for (U32 i = 0; i < max; ++i) {
         this->componentOut.set_buffersOut_OutputPort(i, this->get_from_buffersOut(i));
@@ -60,6 +60,14 @@ class GenericHubTester : public GenericHubGTestBase {
     //!
     void test_events();
 
+    //! Test of port calls coalesced into shared transfers
+    //!
+    void test_coalescing();
+
+    //! Test of events raised into the hub while it sends a coalesced transfer
+    //!
+    void test_reentrant_send();
+
 
 
   private:
@@ -128,6 +136,8 @@ class GenericHubTester : public GenericHubGTestBase {
 
     void random_fill(Fw::SerializeBufferBase& buffer, U32 max_size);
 
+    void random_fill_exact(Fw::SerializeBufferBase& buffer, U32 size);
+
     // ----------------------------------------------------------------------
     // Helper methods
     // ----------------------------------------------------------------------
@@ -157,6 +167,7 @@ class GenericHubTester : public GenericHubGTestBase {
     U32 m_comm_out;
     U32 m_buffer_out;
     U32 m_current_port;
+    U32 m_reentrant_events;  //!< Events to send into the hub from the dataOut handler
     U8 m_data_store[DATA_SIZE];
     U8 m_data_for_allocation[DATA_SIZE];
 };
@@ -16,6 +16,9 @@
 
 namespace Svc {
 
+    static_assert(HealthPingRoundTrip::SERIALIZED_SIZE <= FW_TLM_BUFFER_MAX_SIZE,
+                  "HealthPingRoundTrip must fit in a telemetry buffer");
+
     // ----------------------------------------------------------------------
     // Construction, initialization, and destruction
     // ----------------------------------------------------------------------
@@ -23,6 +26,10 @@ namespace Svc {
     HealthImpl::HealthImpl(const char * const compName) :
             HealthComponentBase(compName),
             m_numPingEntries(0),
+            m_cycle(0),
+            m_dueCount(0),
+            m_reportHead(0),
+            m_reportCount(0),
             m_key(0),
             m_watchDogCode(0),
             m_warnings(0),
@@ -33,6 +40,15 @@ namespace Svc {
                 entry < FW_NUM_ARRAY_ELEMENTS(this->m_pingTrackerEntries);
                 entry++) {
             this->m_pingTrackerEntries[entry].enabled = Fw::Enabled::DISABLED;
+            this->m_pingTrackerEntries[entry].outstanding = false;
+            this->m_pingTrackerEntries[entry].sentCycle = 0;
+            this->m_pingTrackerEntries[entry].disabledCycle = 0;
+            this->m_pingTrackerEntries[entry].heapIndex = NOT_DUE;
+            this->m_pingTrackerEntries[entry].timedKey = 0;
+            this->m_pingTrackerEntries[entry].returnTimed = true;
+            this->m_pingTrackerEntries[entry].returnUsec = 0;
+            this->m_pingTrackerEntries[entry].roundTripLast = 0;
+            this->m_pingTrackerEntries[entry].reportQueued = false;
         }
     }
 
@@ -48,16 +64,21 @@ namespace Svc {
         // make sure not asking for more pings than ports
         FW_ASSERT(numPingEntries <= NUM_PINGSEND_OUTPUT_PORTS);
 
+        // drop the entries of a previous table
+        while (this->m_dueCount > 0) {
+            this->unschedule(this->m_dueHeap[0]);
+        }
         this->m_numPingEntries = numPingEntries;
         this->m_watchDogCode = watchDogCode;
 
-        // copy entries to private data
+        // copy entries to private data, each is pinged on the next cycle
         for (NATIVE_INT_TYPE entry = 0; entry < numPingEntries; entry++) {
             FW_ASSERT(pingEntries[entry].warnCycles <= pingEntries[entry].fatalCycles, pingEntries[entry].warnCycles, pingEntries[entry].fatalCycles);
             this->m_pingTrackerEntries[entry].entry = pingEntries[entry];
-            this->m_pingTrackerEntries[entry].cycleCount = 0;
+            this->m_pingTrackerEntries[entry].outstanding = false;
             this->m_pingTrackerEntries[entry].enabled = Fw::Enabled::ENABLED;
             this->m_pingTrackerEntries[entry].key = 0;
+            this->schedule(entry);
         }
     }
 
@@ -69,15 +90,43 @@ namespace Svc {
     // Handler implementations for user-defined typed input ports
     // ----------------------------------------------------------------------
 
+    void HealthImpl::PingReturn_preMsgHook(NATIVE_INT_TYPE portNum, U32 key) {
+        // the handler runs on the next cycle, so time the return here. Only the first return
+        // of the outstanding key is timed, wrong keys and duplicates are reported by the handler.
+        FW_ASSERT(portNum >= 0 && portNum < NUM_PINGSEND_OUTPUT_PORTS, portNum);
+        PingTracker& tracker = this->m_pingTrackerEntries[portNum];
+        if ((key == tracker.timedKey.load()) && (!tracker.returnTimed.exchange(true))) {
+            tracker.returnUsec.store(this->nowUsec(), std::memory_order_relaxed);
+        }
+    }
+
     void HealthImpl::PingReturn_handler(const NATIVE_INT_TYPE portNum, U32 key) {
-        // verify the key value
-        if (key != this->m_pingTrackerEntries[portNum].key) {
-            Fw::LogStringArg _arg = this->m_pingTrackerEntries[portNum].entry.entryName;
+        PingTracker& tracker = this->m_pingTrackerEntries[portNum];
+        // verify the key value, and that it returns the outstanding ping
+        if ((key != tracker.key) || (!tracker.outstanding)) {
+            Fw::LogStringArg _arg = tracker.entry.entryName;
             this->log_FATAL_HLTH_PING_WRONG_KEY(_arg,key);
         } else {
-            // reset the counter and clear the key
-            this->m_pingTrackerEntries[portNum].cycleCount = 0;
-            this->m_pingTrackerEntries[portNum].key = 0;
+            // record the round trip, the clock may have been set back since the ping
+            const U64 returnUsec = tracker.returnUsec.load(std::memory_order_relaxed);
+            const U64 elapsed = (returnUsec > tracker.sentUsec) ? (returnUsec - tracker.sentUsec) : 0;
+            const U32 roundTrip = (elapsed > 0xFFFFFFFF) ? 0xFFFFFFFF : static_cast<U32>(elapsed);
+            tracker.roundTrip.record(roundTrip);
+            tracker.roundTripLast = roundTrip;
+            // queue the entry for its report unless it already awaits one
+            if (!tracker.reportQueued) {
+                FW_ASSERT(this->m_reportCount < NUM_PINGSEND_OUTPUT_PORTS, this->m_reportCount);
+                this->m_reportQueue[(this->m_reportHead + this->m_reportCount) % NUM_PINGSEND_OUTPUT_PORTS] = portNum;
+                this->m_reportCount++;
+                tracker.reportQueued = true;
+            }
+
+            // clear the key and ping again on the next cycle
+            tracker.outstanding = false;
+            tracker.key = 0;
+            if ((Fw::Enabled::ENABLED == tracker.enabled) && (static_cast<U32>(portNum) < this->m_numPingEntries)) {
+                this->schedule(portNum);
+            }
         }
 
     }
@@ -93,48 +142,63 @@ namespace Svc {
         }
 
         if (this->m_enabled == Fw::Enabled::ENABLED) {
-            // cycle through ping table, pinging ports that are not awaiting a reply
-            // for ports that are awaiting a reply, decrement their counters
-            // and check for violations
-
-            for (NATIVE_UINT_TYPE entry = 0; entry < this->m_numPingEntries; entry++) {
-                if (Fw::Enabled::ENABLED == this->m_pingTrackerEntries[entry].enabled) {
-                    // If clear entry
-                    if (0 == this->m_pingTrackerEntries[entry].cycleCount) {
-                        // start a ping
-                        this->m_pingTrackerEntries[entry].key = this->m_key;
-                        // send ping
-                        this->PingSend_out(entry, this->m_pingTrackerEntries[entry].key);
-                        // increment key
-                        this->m_key++;
-                        // increment cycles for the entry
-                        this->m_pingTrackerEntries[entry].cycleCount++;
-                    } else {
-                        // check to see if it is at warning threshold
-                        if (this->m_pingTrackerEntries[entry].cycleCount ==
-                                this->m_pingTrackerEntries[entry].entry.warnCycles) {
-                            Fw::LogStringArg _arg = this->m_pingTrackerEntries[entry].entry.entryName;
-                            this->log_WARNING_HI_HLTH_PING_WARN(_arg);
-                            this->tlmWrite_PingLateWarnings(++this->m_warnings);
-                        } else {
-                            // check for FATAL timeout value
-                            if (this->m_pingTrackerEntries[entry].entry.fatalCycles ==
-                                    this->m_pingTrackerEntries[entry].cycleCount) {
-                                Fw::LogStringArg _arg = this->m_pingTrackerEntries[entry].entry.entryName;
-                                this->log_FATAL_HLTH_PING_LATE(_arg);
-                            }
-                        } // if at warning or fatal threshold
-
-                        this->m_pingTrackerEntries[entry].cycleCount++;
-                    } // if clear entry
-                } // if entry has ping enabled
-            } // for each entry
+            // visit the entries due this cycle, pinging ports that are not awaiting a reply
+            // and checking ports that are awaiting a reply against their thresholds.
+            // Disabled entries are not in the heap.
+            this->m_cycle++;
+
+            while ((this->m_dueCount > 0) &&
+                    (this->m_pingTrackerEntries[this->m_dueHeap[0]].dueCycle <= this->m_cycle)) {
+                const U32 entry = this->m_dueHeap[0];
+                PingTracker& tracker = this->m_pingTrackerEntries[entry];
+                // If clear entry
+                if (!tracker.outstanding) {
+                    // start a ping
+                    tracker.key = this->m_key;
+                    tracker.outstanding = true;
+                    tracker.sentCycle = this->m_cycle;
+                    tracker.sentUsec = this->nowUsec();
+                    // a late return of the previous key must not be timed, so the key is set first
+                    tracker.timedKey = tracker.key;
+                    tracker.returnTimed = false;
+                    // send ping
+                    this->PingSend_out(entry, tracker.key);
+                    // increment key
+                    this->m_key++;
+                } else {
+                    const U64 cycles = this->m_cycle - tracker.sentCycle;
+                    // check to see if it is at warning threshold
+                    if (cycles == tracker.entry.warnCycles) {
+                        Fw::LogStringArg _arg = tracker.entry.entryName;
+                        this->log_WARNING_HI_HLTH_PING_WARN(_arg);
+                        this->tlmWrite_PingLateWarnings(++this->m_warnings);
+                    } else if (cycles == tracker.entry.fatalCycles) {
+                        // FATAL timeout value
+                        Fw::LogStringArg _arg = tracker.entry.entryName;
+                        this->log_FATAL_HLTH_PING_LATE(_arg);
+                    } // if at warning or fatal threshold
+                } // if clear entry
+                this->schedule(entry);
+            } // for each entry due
 
             // do other specialized platform checks (e.g. VxWorks suspended tasks)
             this->doOtherChecks();
 
         } // If health checking is enabled
 
+        // report the round trips of one entry with a ping returned since its last report.
+        // One channel of any table size is written, the entries taking turns in return order.
+        if (this->m_reportCount > 0) {
+            const U32 entry = this->m_reportQueue[this->m_reportHead];
+            this->m_reportHead = (this->m_reportHead + 1) % NUM_PINGSEND_OUTPUT_PORTS;
+            this->m_reportCount--;
+            PingTracker& tracker = this->m_pingTrackerEntries[entry];
+            tracker.reportQueued = false;
+            const HealthPingRoundTrip roundTrip(entry, tracker.roundTripLast, tracker.roundTrip.getPercentile(99),
+                                                tracker.roundTrip.getMax());
+            this->tlmWrite_PingRoundTrip(roundTrip);
+        }
+
         // stroke watchdog.
         if (this->isConnected_WdogStroke_OutputPort(0)) {
             this->WdogStroke_out(0,this->m_watchDogCode);
@@ -165,7 +229,21 @@ namespace Svc {
             return;
         }
 
-        this->m_pingTrackerEntries[entryIndex].enabled = enable.e;
+        PingTracker& tracker = this->m_pingTrackerEntries[entryIndex];
+        if (tracker.enabled != enable.e) {
+            if (enable == Fw::Enabled::ENABLED) {
+                // an outstanding ping resumes counting from where it was disabled
+                tracker.sentCycle += this->m_cycle - tracker.disabledCycle;
+                tracker.enabled = enable.e;
+                if (static_cast<U32>(entryIndex) < this->m_numPingEntries) {
+                    this->schedule(entryIndex);
+                }
+            } else {
+                tracker.disabledCycle = this->m_cycle;
+                tracker.enabled = enable.e;
+                this->unschedule(entryIndex);
+            }
+        }
         Fw::Enabled isEnabled(Fw::Enabled::DISABLED);
         if (enable == Fw::Enabled::ENABLED) {
             isEnabled = Fw::Enabled::ENABLED;
@@ -195,6 +273,11 @@ namespace Svc {
 
         this->m_pingTrackerEntries[entryIndex].entry.warnCycles = warningValue;
         this->m_pingTrackerEntries[entryIndex].entry.fatalCycles = fatalValue;
+        // an outstanding ping is now due at the new thresholds
+        if ((Fw::Enabled::ENABLED == this->m_pingTrackerEntries[entryIndex].enabled) &&
+                (static_cast<U32>(entryIndex) < this->m_numPingEntries)) {
+            this->schedule(entryIndex);
+        }
         Fw::LogStringArg arg = entry;
         this->log_ACTIVITY_HI_HLTH_PING_UPDATED(arg,warningValue,fatalValue);
         this->cmdResponse_out(opCode,cmdSeq,Fw::CmdResponse::OK);
@@ -214,6 +297,88 @@ namespace Svc {
         return -1;
     }
 
+    void HealthImpl::schedule(U32 entry) {
+        FW_ASSERT(entry < this->m_numPingEntries, entry, this->m_numPingEntries);
+        PingTracker& tracker = this->m_pingTrackerEntries[entry];
+        U64 dueCycle = this->m_cycle + 1;
+        bool due = true;
+        if (tracker.outstanding) {
+            // the warning threshold takes precedence when both are equal, as in the checks of the run handler
+            const U64 warnCycle = tracker.sentCycle + tracker.entry.warnCycles;
+            const U64 fatalCycle = tracker.sentCycle + tracker.entry.fatalCycles;
+            if ((tracker.entry.warnCycles > 0) && (warnCycle > this->m_cycle)) {
+                dueCycle = warnCycle;
+            } else if ((tracker.entry.fatalCycles != tracker.entry.warnCycles) && (fatalCycle > this->m_cycle)) {
+                dueCycle = fatalCycle;
+            } else {
+                due = false;
+            }
+        }
+
+        if (!due) {
+            this->unschedule(entry);
+            return;
+        }
+        tracker.dueCycle = dueCycle;
+        if (NOT_DUE == tracker.heapIndex) {
+            FW_ASSERT(this->m_dueCount < NUM_PINGSEND_OUTPUT_PORTS, this->m_dueCount);
+            this->setHeap(this->m_dueCount++, entry);
+        }
+        this->siftHeap(tracker.heapIndex);
+    }
+
+    void HealthImpl::unschedule(U32 entry) {
+        const U32 index = this->m_pingTrackerEntries[entry].heapIndex;
+        if (NOT_DUE == index) {
+            return;
+        }
+        FW_ASSERT(index < this->m_dueCount, index, this->m_dueCount);
+        this->m_pingTrackerEntries[entry].heapIndex = NOT_DUE;
+        // fill the hole with the last element
+        this->m_dueCount--;
+        if (index < this->m_dueCount) {
+            this->setHeap(index, this->m_dueHeap[this->m_dueCount]);
+            this->siftHeap(index);
+        }
+    }
+
+    bool HealthImpl::dueBefore(U32 a, U32 b) const {
+        const U64 dueA = this->m_pingTrackerEntries[a].dueCycle;
+        const U64 dueB = this->m_pingTrackerEntries[b].dueCycle;
+        return (dueA < dueB) || ((dueA == dueB) && (a < b));
+    }
+
+    void HealthImpl::siftHeap(U32 index) {
+        const U32 entry = this->m_dueHeap[index];
+        // move up while due before the parent
+        while ((index > 0) && this->dueBefore(entry, this->m_dueHeap[(index - 1) / 2])) {
+            this->setHeap(index, this->m_dueHeap[(index - 1) / 2]);
+            index = (index - 1) / 2;
+        }
+        // move down while a child is due before
+        for (U32 child = 2 * index + 1; child < this->m_dueCount; child = 2 * index + 1) {
+            if ((child + 1 < this->m_dueCount) && this->dueBefore(this->m_dueHeap[child + 1], this->m_dueHeap[child])) {
+                child++;
+            }
+            if (!this->dueBefore(this->m_dueHeap[child], entry)) {
+                break;
+            }
+            this->setHeap(index, this->m_dueHeap[child]);
+            index = child;
+        }
+        this->setHeap(index, entry);
+    }
+
+    void HealthImpl::setHeap(U32 index, U32 entry) {
+        this->m_dueHeap[index] = entry;
+        this->m_pingTrackerEntries[entry].heapIndex = index;
+    }
+
+    U64 HealthImpl::nowUsec() {
+        const Fw::Time now = this->getTime();
+        return static_cast<U64>(now.getSeconds()) * 1000000 + now.getUSeconds();
+    }
+
 
 
 } // end namespace Svc
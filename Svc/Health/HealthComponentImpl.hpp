@@ -15,6 +15,8 @@
 
 #include <Svc/Health/HealthComponentAc.hpp>
 #include <Fw/Types/String.hpp>
+#include <Fw/Types/ProfileHistogram.hpp>
+#include <atomic>
 
 namespace Svc {
 
@@ -28,6 +30,11 @@ namespace Svc {
     //!  a counter is decremented, and its value is checked
     //!  against warning and fault thresholds. A watchdog is
     //!  always stroked in the run handler.
+    //!
+    //!  Entries are kept in a heap ordered by the cycle of their
+    //!  next ping or threshold, such that each cycle only visits
+    //!  the entries that are due. The round trip time of each
+    //!  returned ping is recorded in a histogram per entry.
 
     class HealthImpl: public HealthComponentBase {
 
@@ -94,6 +101,16 @@ namespace Svc {
             //!  \param key Key value
             void PingReturn_handler(const NATIVE_INT_TYPE portNum, U32 key);
 
+            //!  \brief ping return pre-message hook
+            //!
+            //!  Records the time the ping returned on the thread of the
+            //!  returning component, before the message waits on the queue.
+            //!  Only the first return of the outstanding key is timed.
+            //!
+            //!  \param portNum Port number
+            //!  \param key Key value
+            void PingReturn_preMsgHook(NATIVE_INT_TYPE portNum, U32 key);
+
             //!  \brief run handler
             //!
             //!  Handler implementation for run
@@ -137,15 +154,68 @@ namespace Svc {
             //!  Array for storing ping table entries
             struct PingTracker {
                 PingEntry entry; //!< entry passed by user
-                U32 cycleCount; //!< current cycle count
+                U64 sentCycle; //!< cycle the outstanding ping was sent
+                U64 dueCycle; //!< cycle of the next ping or threshold
+                U32 heapIndex; //!< position in the heap of due entries, NOT_DUE if none
                 U32 key; //!< key passed to ping
+                bool outstanding; //!< if a ping is awaiting its return
                 Fw::Enabled::t enabled; //!< if current ping result is checked
+                U64 disabledCycle; //!< cycle the entry was disabled
+                U64 sentUsec; //!< time the outstanding ping was sent
+                std::atomic<U32> timedKey; //!< key of the outstanding ping, read by the returning thread
+                std::atomic<bool> returnTimed; //!< if the return of the outstanding ping was timed
+                std::atomic<U64> returnUsec; //!< time the ping returned, written by the returning thread
+                Fw::ProfileHistogram roundTrip; //!< round trip times of returned pings
+                U32 roundTripLast; //!< round trip time of the latest returned ping
+                bool reportQueued; //!< if the entry awaits the report of its round trips
             } m_pingTrackerEntries[NUM_PINGSEND_OUTPUT_PORTS];
 
+            static const U32 NOT_DUE = 0xFFFFFFFF; //!< heap index of entries with nothing due
+
             NATIVE_INT_TYPE findEntry(const Fw::CmdStringArg& entry);
 
+            //!  \brief place an entry in the heap at its next due cycle
+            //!
+            //!  The next ping of an idle entry is due on the next cycle.
+            //!  An outstanding ping is due at its next threshold still ahead,
+            //!  and is no longer due once past its fatal threshold.
+            //!
+            //!  \param entry Ping entry number
+            void schedule(U32 entry);
+
+            //!  \brief remove an entry from the heap
+            //!
+            //!  \param entry Ping entry number
+            void unschedule(U32 entry);
+
+            //!  \brief compare the heap order of two entries
+            //!
+            //!  \return true if entry a is due before entry b. Entries due on the
+            //!          same cycle are ordered by entry number.
+            bool dueBefore(U32 a, U32 b) const;
+
+            //!  \brief move the heap element at an index to its place
+            //!
+            //!  \param index Heap index
+            void siftHeap(U32 index);
+
+            //!  \brief store an entry at a heap index
+            //!
+            //!  \param index Heap index
+            //!  \param entry Ping entry number
+            void setHeap(U32 index, U32 entry);
+
+            //!  \brief current time in microseconds
+            U64 nowUsec();
+
             //!  Private member data
             U32 m_numPingEntries; //!< stores number of entries passed to constructor
+            U64 m_cycle; //!< number of cycles run with health checks enabled
+            U32 m_dueHeap[NUM_PINGSEND_OUTPUT_PORTS]; //!< entries ordered by due cycle
+            U32 m_dueCount; //!< number of entries in the heap
+            U32 m_reportQueue[NUM_PINGSEND_OUTPUT_PORTS]; //!< entries awaiting a round trip report, in return order
+            U32 m_reportHead; //!< position of the next entry to report in the queue
+            U32 m_reportCount; //!< number of entries awaiting a round trip report
             U32 m_key; //!< current key value. Just increments for each ping entry.
             U32 m_watchDogCode; //!< stores code used for watchdog stroking
             U32 m_warnings; //!< number of slip warnings issued
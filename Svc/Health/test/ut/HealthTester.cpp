@@ -193,6 +193,30 @@ namespace Svc {
       }
   }
 
+  U32 HealthTester ::
+      cycleCount(NATIVE_UINT_TYPE entry)
+  {
+      const HealthImpl::PingTracker& tracker = this->component.m_pingTrackerEntries[entry];
+      if (!tracker.outstanding) {
+          return 0;
+      }
+      // disabled entries stop counting
+      const U64 cycle = (Fw::Enabled::ENABLED == tracker.enabled) ? this->component.m_cycle : tracker.disabledCycle;
+      return static_cast<U32>(cycle - tracker.sentCycle + 1);
+  }
+
+  void HealthTester ::
+      resetPings()
+  {
+      for (U32 entry = 0; entry < this->numPingEntries; entry++) {
+          this->component.m_pingTrackerEntries[entry].outstanding = false;
+          this->component.m_pingTrackerEntries[entry].key = 0;
+          if (Fw::Enabled::ENABLED == this->component.m_pingTrackerEntries[entry].enabled) {
+              this->component.schedule(entry);
+          }
+      }
+  }
+
   // ----------------------------------------------------------------------
   // Tests
   // ----------------------------------------------------------------------
@@ -220,15 +244,16 @@ namespace Svc {
 	          this->keys[port] += Svc::HealthComponentBase::NUM_PINGSEND_OUTPUT_PORTS;
 	      }
 
-		  // Check no events or telemetry have occurred
+		  // Check no events or late telemetry have occurred, round trips are reported once pings return
 		  ASSERT_EVENTS_SIZE(0);
-		  ASSERT_TLM_SIZE(0);
+		  ASSERT_TLM_PingLateWarnings_SIZE(0);
+		  ASSERT_TLM_PingRoundTrip_SIZE(i);
 		  ASSERT_CMD_RESPONSE_SIZE(0);
 	  }
 
-	  //Check no events or telemetry have occurred
+	  //Check no events or late telemetry have occurred
 	  ASSERT_EVENTS_SIZE(0);
-	  ASSERT_TLM_SIZE(0);
+	  ASSERT_TLM_PingLateWarnings_SIZE(0);
 	  ASSERT_CMD_RESPONSE_SIZE(0);
 
   }
@@ -249,7 +274,7 @@ namespace Svc {
       for (U32 i = 0; i < Svc::HealthComponentBase::NUM_PINGSEND_OUTPUT_PORTS*2; i++) {
           this->invoke_to_Run(0,0);
           for (NATIVE_UINT_TYPE port = 0; port < Svc::HealthComponentBase::NUM_PINGSEND_OUTPUT_PORTS; port++) {
-              ASSERT_EQ(i+1,this->component.m_pingTrackerEntries[port].cycleCount);
+              ASSERT_EQ(i+1,this->cycleCount(port));
           }
       }
 
@@ -283,7 +308,7 @@ namespace Svc {
       for (U32 i = 0; i < Svc::HealthComponentBase::NUM_PINGSEND_OUTPUT_PORTS*2; i++) {
           this->invoke_to_Run(0,0);
           for (NATIVE_UINT_TYPE port = 0; port < Svc::HealthComponentBase::NUM_PINGSEND_OUTPUT_PORTS; port++) {
-              ASSERT_EQ(i+1,this->component.m_pingTrackerEntries[port].cycleCount);
+              ASSERT_EQ(i+1,this->cycleCount(port));
           }
       }
 
@@ -305,7 +330,7 @@ namespace Svc {
       for (U32 i = 0; i < Svc::HealthComponentBase::NUM_PINGSEND_OUTPUT_PORTS; i++) {
           this->invoke_to_Run(0,0);
           for (NATIVE_UINT_TYPE port = 0; port < Svc::HealthComponentBase::NUM_PINGSEND_OUTPUT_PORTS; port++) {
-              ASSERT_EQ(Svc::HealthComponentBase::NUM_PINGSEND_OUTPUT_PORTS*2+i+1,this->component.m_pingTrackerEntries[port].cycleCount);
+              ASSERT_EQ(Svc::HealthComponentBase::NUM_PINGSEND_OUTPUT_PORTS*2+i+1,this->cycleCount(port));
           }
       }
       this->invoke_to_Run(0,0);
@@ -338,7 +363,7 @@ namespace Svc {
       for (U32 i = 0; i < Svc::HealthComponentBase::NUM_PINGSEND_OUTPUT_PORTS*2; i++) {
           this->invoke_to_Run(0,0);
           for (NATIVE_INT_TYPE entry = 0; entry < Svc::HealthComponentBase::NUM_PINGSEND_OUTPUT_PORTS; entry++) {
-              ASSERT_EQ(i+1,this->component.m_pingTrackerEntries[entry].cycleCount);
+              ASSERT_EQ(i+1,this->cycleCount(entry));
           }
       }
 
@@ -371,7 +396,7 @@ namespace Svc {
           // cycle count should stay the same
 
           ASSERT_EQ(static_cast<U32>(Svc::HealthComponentBase::NUM_PINGSEND_OUTPUT_PORTS)*2,
-                  this->component.m_pingTrackerEntries[0].cycleCount);
+                  this->cycleCount(0));
       }
 
       //confirm no telemetry was received
@@ -396,7 +421,7 @@ namespace Svc {
       for (U32 i = 0; i < Svc::HealthComponentBase::NUM_PINGSEND_OUTPUT_PORTS; i++) {
           this->invoke_to_Run(0,0);
           for (NATIVE_INT_TYPE entry = 0; entry < Svc::HealthComponentBase::NUM_PINGSEND_OUTPUT_PORTS; entry++) {
-              ASSERT_EQ(Svc::HealthComponentBase::NUM_PINGSEND_OUTPUT_PORTS*2+1+i,this->component.m_pingTrackerEntries[entry].cycleCount);
+              ASSERT_EQ(Svc::HealthComponentBase::NUM_PINGSEND_OUTPUT_PORTS*2+1+i,this->cycleCount(entry));
           }
       }
       this->invoke_to_Run(0,0);
@@ -430,9 +455,7 @@ namespace Svc {
           this->clearEvents();
           this->clearHistory();
           // reset cycle count
-          for (NATIVE_INT_TYPE e2 = 0; e2 < Svc::HealthComponentBase::NUM_PINGSEND_OUTPUT_PORTS; e2++) {
-              this->component.m_pingTrackerEntries[e2].cycleCount = 0;
-          }
+          this->resetPings();
           // disable entry
           char name[80];
           snprintf(name, sizeof(name), "task%d",entry);
@@ -455,10 +478,10 @@ namespace Svc {
               for (NATIVE_INT_TYPE e3 = 0; e3 < Svc::HealthComponentBase::NUM_PINGSEND_OUTPUT_PORTS; e3++) {
                   if (e3 == entry) {
                       // shouldn't be counting up
-                      ASSERT_EQ(0u,this->component.m_pingTrackerEntries[e3].cycleCount);
+                      ASSERT_EQ(0u,this->cycleCount(e3));
                   } else {
                       // others should be counting up
-                      ASSERT_EQ(static_cast<U32>(cycle+1),this->component.m_pingTrackerEntries[e3].cycleCount);
+                      ASSERT_EQ(static_cast<U32>(cycle+1),this->cycleCount(e3));
                   }
               }
           }
@@ -726,9 +749,7 @@ namespace Svc {
       this->component.m_key = 0;
 
       //reset cycle counts
-      for (U32 i = 0; i < this->numPingEntries; i++) {
-          this->component.m_pingTrackerEntries[i].cycleCount = 0;
-      }
+      this->resetPings();
 
       //invoke schedIn handler
       for (U32 i = 0; i < Svc::HealthComponentBase::NUM_PINGSEND_OUTPUT_PORTS*2; i++) {
@@ -750,12 +771,139 @@ namespace Svc {
       char name[80];
       snprintf(name, sizeof(name), "task%d",Svc::HealthComponentBase::NUM_PINGSEND_OUTPUT_PORTS-1);
       ASSERT_EVENTS_HLTH_PING_WARN(0,name);
-      ASSERT_TLM_SIZE(1);
+      // round trips are reported on each cycle after the first
+      ASSERT_TLM_SIZE(1 + Svc::HealthComponentBase::NUM_PINGSEND_OUTPUT_PORTS*2 - 1);
+      ASSERT_TLM_PingRoundTrip_SIZE(Svc::HealthComponentBase::NUM_PINGSEND_OUTPUT_PORTS*2 - 1);
       ASSERT_TLM_PingLateWarnings_SIZE(1);
       ASSERT_TLM_PingLateWarnings(0,1);
 
   }
 
+  void HealthTester ::
+  roundTripTlm()
+  {
+      TEST_CASE(900.1.11,"Ping round trip telemetry");
+      REQUIREMENT("ISF-HTH-008");
+      COMMENT("The Svc::Health component shall report the round trip time of the pings returned by each entry.");
+
+      ASSERT_EVENTS_SIZE(0);
+      ASSERT_TLM_SIZE(0);
+
+      // pings are sent at 1 second, and are not returned by the test port
+      Fw::Time time(TB_NONE, 1, 0);
+      this->setTestTime(time);
+      this->invoke_to_Run(0,0);
+      ASSERT_from_PingSend_SIZE(Svc::HealthComponentBase::NUM_PINGSEND_OUTPUT_PORTS);
+
+      // nothing returned, nothing reported
+      this->invoke_to_Run(0,0);
+      ASSERT_TLM_SIZE(0);
+
+      // the round trip ends when the ping returns, not when Health dispatches the return
+      time.set(TB_NONE, 1, 500);
+      this->setTestTime(time);
+      this->invoke_to_PingReturn(0, 0);
+      time.set(TB_NONE, 1, 3000);
+      this->setTestTime(time);
+      this->invoke_to_PingReturn(1, 1);
+      time.set(TB_NONE, 5, 0);
+      this->setTestTime(time);
+      this->invoke_to_Run(0,0);
+
+      // one entry is reported each cycle, in the order the pings returned
+      ASSERT_TLM_SIZE(1);
+      ASSERT_TLM_PingRoundTrip(0, HealthPingRoundTrip(0, 500, 500, 500));
+
+      // returned entries are pinged again on the same cycle
+      ASSERT_from_PingSend_SIZE(Svc::HealthComponentBase::NUM_PINGSEND_OUTPUT_PORTS + 2);
+      const U32 key = this->fromPortHistory_PingSend->at(Svc::HealthComponentBase::NUM_PINGSEND_OUTPUT_PORTS).key;
+
+      this->invoke_to_Run(0,0);
+      ASSERT_TLM_SIZE(2);
+      ASSERT_TLM_PingRoundTrip(1, HealthPingRoundTrip(1, 3000, 3000, 3000));
+
+      // nothing left to report
+      this->invoke_to_Run(0,0);
+      ASSERT_TLM_SIZE(2);
+
+      // a wrong key and a duplicate return are not timed, only the first return of the outstanding key is
+      this->clearHistory();
+      time.set(TB_NONE, 5, 50);
+      this->setTestTime(time);
+      this->invoke_to_PingReturn(0, key + 100);
+      time.set(TB_NONE, 5, 100);
+      this->setTestTime(time);
+      this->invoke_to_PingReturn(0, key);
+      time.set(TB_NONE, 5, 200);
+      this->setTestTime(time);
+      this->invoke_to_PingReturn(0, key);
+      this->invoke_to_Run(0,0);
+      ASSERT_EVENTS_HLTH_PING_WRONG_KEY_SIZE(2);
+
+      // the latest round trip is reported with the percentile and maximum of all round trips
+      ASSERT_TLM_SIZE(1);
+      ASSERT_TLM_PingRoundTrip(0, HealthPingRoundTrip(0, 100, 500, 500));
+      ASSERT_EQ(2u, this->component.m_pingTrackerEntries[0].roundTrip.getCount());
+  }
+
+  void HealthTester ::
+  dueEntries()
+  {
+      TEST_CASE(900.1.12,"Entries due each cycle");
+      REQUIREMENT("ISF-HTH-009");
+      COMMENT("The Svc::Health component shall only check the ping entries due on each cycle.");
+
+      // all entries are due on the first cycle
+      ASSERT_EQ(this->numPingEntries, this->component.m_dueCount);
+      this->invoke_to_Run(0,0);
+      ASSERT_from_PingSend_SIZE(Svc::HealthComponentBase::NUM_PINGSEND_OUTPUT_PORTS);
+
+      // entries are next due at their warning threshold, in entry order
+      ASSERT_EQ(this->numPingEntries, this->component.m_dueCount);
+      ASSERT_EQ(0u, this->component.m_dueHeap[0]);
+      ASSERT_EQ(1 + this->pingEntries[0].warnCycles, this->component.m_pingTrackerEntries[0].dueCycle);
+
+      // a disabled entry is never due
+      this->sendCmd_HLTH_PING_ENABLE(0,0,"task0",Fw::Enabled::DISABLED);
+      this->dispatchAll();
+      ASSERT_EQ(this->numPingEntries - 1, this->component.m_dueCount);
+      ASSERT_EQ(1u, this->component.m_dueHeap[0]);
+
+      // entries past their fatal threshold are no longer due
+      for (U32 cycle = 0; cycle < this->pingEntries[this->numPingEntries - 1].fatalCycles; cycle++) {
+          this->invoke_to_Run(0,0);
+      }
+      ASSERT_EQ(0u, this->component.m_dueCount);
+      ASSERT_EVENTS_HLTH_PING_WARN_SIZE(this->numPingEntries - 1);
+      ASSERT_EVENTS_HLTH_PING_LATE_SIZE(this->numPingEntries - 1);
+      this->clearEvents();
+      for (U32 cycle = 0; cycle < 10; cycle++) {
+          this->invoke_to_Run(0,0);
+      }
+      ASSERT_EVENTS_SIZE(0);
+
+      // a returned ping is due on the next cycle
+      this->clearHistory();
+      this->invoke_to_PingReturn(2, this->component.m_pingTrackerEntries[2].key);
+      this->invoke_to_Run(0,0);
+      ASSERT_from_PingSend_SIZE(1);
+      ASSERT_EQ(1u, this->component.m_dueCount);
+      ASSERT_EQ(2u, this->component.m_dueHeap[0]);
+
+      // the disabled entry resumes counting where it stopped, and is late on its fatal threshold
+      this->clearHistory();
+      this->sendCmd_HLTH_PING_ENABLE(0,0,"task0",Fw::Enabled::ENABLED);
+      this->dispatchAll();
+      ASSERT_EQ(2u, this->component.m_dueCount);
+      ASSERT_EQ(1u, this->cycleCount(0));
+      for (U32 cycle = 0; cycle < this->pingEntries[0].fatalCycles; cycle++) {
+          this->invoke_to_Run(0,0);
+      }
+      ASSERT_EVENTS_HLTH_PING_WARN_SIZE(2);
+      ASSERT_EVENTS_HLTH_PING_LATE_SIZE(1);
+      ASSERT_EVENTS_HLTH_PING_LATE(0, "task0");
+  }
+
   void HealthTester::textLogIn(const FwEventIdType id, //!< The event ID
           const Fw::Time& timeTag, //!< The time
           const Fw::LogSeverity severity, //!< The severity
@@ -52,6 +52,8 @@ namespace Svc {
       void nominalCmd();
       void nominal2CmdsDuringTlm();
       void miscellaneous();
+      void roundTripTlm();
+      void dueEntries();
 
     private:
 
@@ -89,6 +91,14 @@ namespace Svc {
 
       void dispatchAll();
 
+      //! Cycles since the outstanding ping of an entry was sent, counting the cycle it was sent
+      //!
+      U32 cycleCount(NATIVE_UINT_TYPE entry);
+
+      //! Clear outstanding pings, such that enabled entries are pinged on the next cycle
+      //!
+      void resetPings();
+
     private:
 
       // ----------------------------------------------------------------------
@@ -54,6 +54,16 @@ TEST(Test, Miscellaneous) {
   tester.miscellaneous();
 }
 
+TEST(Test, RoundTripTlm) {
+  Svc::HealthTester tester;
+  tester.roundTripTlm();
+}
+
+TEST(Test, DueEntries) {
+  Svc::HealthTester tester;
+  tester.dueEntries();
+}
+
 int main(int argc, char **argv) {
   ::testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
@@ -9,6 +9,7 @@
 #include <Fw/Types/Assert.hpp>
 
 #include <Os/File.hpp>
+#include <Os/FileSystem.hpp>
 
 #include <cstring>
 #include <cstdio>
@@ -18,36 +19,16 @@ namespace Svc {
 
     typedef PrmDb_PrmWriteError PrmWriteError;
     typedef PrmDb_PrmReadError PrmReadError;
-    // anonymous namespace for buffer declaration
-    namespace {
-        class WorkingBuffer : public Fw::SerializeBufferBase {
-            public:
-
-                NATIVE_UINT_TYPE getBuffCapacity() const {
-                    return sizeof(m_buff);
-                }
-
-                U8* getBuffAddr() {
-                    return m_buff;
-                }
-
-                const U8* getBuffAddr() const {
-                    return m_buff;
-                }
-
-            private:
-                // Set to max of parameter buffer + id
-                U8 m_buff[FW_PARAM_BUFFER_MAX_SIZE + sizeof(FwPrmIdType)];
-        };
-    }
 
-    PrmDbImpl::PrmDbImpl(const char* name) : PrmDbComponentBase(name) {
+    PrmDbImpl::PrmDbImpl(const char* name) : PrmDbComponentBase(name), m_numEntries(0) {
         this->clearDb();
     }
 
     void PrmDbImpl::configure(const char* file) {
         FW_ASSERT(file != nullptr);
         this->m_fileName = file;
+        this->m_tempFileName.format("%s.tmp", file);
+        FW_ASSERT(this->m_tempFileName.length() > this->m_fileName.length());
     }
 
     void PrmDbImpl::init(NATIVE_INT_TYPE queueDepth, NATIVE_INT_TYPE instance) {
@@ -59,6 +40,45 @@ namespace Svc {
             this->m_db[entry].used = false;
             this->m_db[entry].id = 0;
         }
+        for (NATIVE_UINT_TYPE slot = 0; slot < INDEX_SIZE; slot++) {
+            this->m_index[slot] = -1;
+        }
+        this->m_numEntries = 0;
+    }
+
+    NATIVE_UINT_TYPE PrmDbImpl::indexSlot(FwPrmIdType id) {
+        // Parameter IDs are component base IDs plus small offsets, so mix the bits before reducing to a slot
+        const U32 hash = static_cast<U32>(id) * 2654435761U;
+        return (hash ^ (hash >> 16)) % INDEX_SIZE;
+    }
+
+    NATIVE_INT_TYPE PrmDbImpl::findEntry(FwPrmIdType id) const {
+        NATIVE_UINT_TYPE slot = indexSlot(id);
+        // The index is never full, so probing always ends at an empty slot
+        while (this->m_index[slot] != -1) {
+            const NATIVE_INT_TYPE entry = this->m_index[slot];
+            if (this->m_db[entry].id == id) {
+                return entry;
+            }
+            slot = (slot + 1) % INDEX_SIZE;
+        }
+        return -1;
+    }
+
+    NATIVE_INT_TYPE PrmDbImpl::addEntry(FwPrmIdType id) {
+        if (this->m_numEntries >= PRMDB_NUM_DB_ENTRIES) {
+            return -1;
+        }
+        const NATIVE_INT_TYPE entry = this->m_numEntries++;
+        this->m_db[entry].used = true;
+        this->m_db[entry].id = id;
+
+        NATIVE_UINT_TYPE slot = indexSlot(id);
+        while (this->m_index[slot] != -1) {
+            slot = (slot + 1) % INDEX_SIZE;
+        }
+        this->m_index[slot] = entry;
+        return entry;
     }
 
     // If ports are no longer guarded, these accesses need to be protected from each other
@@ -68,14 +88,10 @@ namespace Svc {
         // search for entry
         Fw::ParamValid stat = Fw::ParamValid::INVALID;
 
-        for (I32 entry = 0; entry < PRMDB_NUM_DB_ENTRIES; entry++) {
-            if (this->m_db[entry].used) {
-                if (this->m_db[entry].id == id) {
-                    val = this->m_db[entry].val;
-                    stat = Fw::ParamValid::VALID;
-                    break;
-                }
-            }
+        const NATIVE_INT_TYPE entry = this->findEntry(id);
+        if (entry != -1) {
+            val = this->m_db[entry].val;
+            stat = Fw::ParamValid::VALID;
         }
 
         // if unable to find parameter, send error message
@@ -95,24 +111,16 @@ namespace Svc {
         bool existingEntry = false;
         bool noSlots = true;
 
-        for (NATIVE_INT_TYPE entry = 0; entry < PRMDB_NUM_DB_ENTRIES; entry++) {
-            if ((this->m_db[entry].used) && (id == this->m_db[entry].id)) {
+        NATIVE_INT_TYPE entry = this->findEntry(id);
+        if (entry != -1) {
+            this->m_db[entry].val = val;
+            existingEntry = true;
+        } else {
+            // if there is no existing entry, add one
+            entry = this->addEntry(id);
+            if (entry != -1) {
                 this->m_db[entry].val = val;
-                existingEntry = true;
-                break;
-            }
-        }
-
-        // if there is no existing entry, add one
-        if (!existingEntry) {
-            for (I32 entry = 0; entry < PRMDB_NUM_DB_ENTRIES; entry++) {
-                if (!(this->m_db[entry].used)) {
-                    this->m_db[entry].val = val;
-                    this->m_db[entry].id = id;
-                    this->m_db[entry].used = true;
-                    noSlots = false;
-                    break;
-                }
+                noSlots = false;
             }
         }
 
@@ -130,111 +138,69 @@ namespace Svc {
 
     void PrmDbImpl::PRM_SAVE_FILE_cmdHandler(FwOpcodeType opCode, U32 cmdSeq) {
         FW_ASSERT(this->m_fileName.length() > 0);
-        Os::File paramFile;
-        WorkingBuffer buff;
 
-        Os::File::Status stat = paramFile.open(this->m_fileName.toChar(),Os::File::OPEN_WRITE);
+        this->lock();
+
+        // Serialize the whole database into the file image. The image holds a full database, so it always fits.
+
+        U32 numRecords = 0;
+        Fw::ExternalSerializeBuffer buff(this->m_fileBuffer, sizeof(this->m_fileBuffer));
+
+        for (NATIVE_INT_TYPE entry = 0; entry < this->m_numEntries; entry++) {
+            // record size = id field + data
+            const U32 recordSize = sizeof(FwPrmIdType) + this->m_db[entry].val.getBuffLength();
+
+            Fw::SerializeStatus serStat = buff.serialize(static_cast<U8>(PRMDB_ENTRY_DELIMITER));
+            FW_ASSERT(Fw::FW_SERIALIZE_OK == serStat,static_cast<NATIVE_INT_TYPE>(serStat));
+            serStat = buff.serialize(recordSize);
+            FW_ASSERT(Fw::FW_SERIALIZE_OK == serStat,static_cast<NATIVE_INT_TYPE>(serStat));
+            serStat = buff.serialize(this->m_db[entry].id);
+            FW_ASSERT(Fw::FW_SERIALIZE_OK == serStat,static_cast<NATIVE_INT_TYPE>(serStat));
+            serStat = buff.serialize(this->m_db[entry].val.getBuffAddr(),
+                                     static_cast<FwSizeType>(this->m_db[entry].val.getBuffLength()),
+                                     Fw::Serialization::OMIT_LENGTH);
+            FW_ASSERT(Fw::FW_SERIALIZE_OK == serStat,static_cast<NATIVE_INT_TYPE>(serStat));
+            numRecords++;
+        }
+
+        this->unLock();
+
+        // Write the image to a temporary file in a single write, which waits until it is synced to storage. Renaming
+        // it over the parameter file then replaces the old parameters atomically, so a save interrupted at any point
+        // leaves either the old or the new file.
+
+        Os::File paramFile;
+        Os::File::Status stat = paramFile.open(this->m_tempFileName.toChar(),Os::File::OPEN_WRITE);
         if (stat != Os::File::OP_OK) {
             this->log_WARNING_HI_PrmFileWriteError(PrmWriteError::OPEN,0,stat);
             this->cmdResponse_out(opCode,cmdSeq,Fw::CmdResponse::EXECUTION_ERROR);
             return;
         }
 
-        this->lock();
-
-        // Traverse the parameter list, saving each entry
-
-        U32 numRecords = 0;
+        FwSignedSizeType writeSize = static_cast<FwSignedSizeType>(buff.getBuffLength());
+        stat = paramFile.write(this->m_fileBuffer,writeSize,Os::File::WaitType::WAIT);
+        paramFile.close();
+        if (stat != Os::File::OP_OK) {
+            (void) Os::FileSystem::removeFile(this->m_tempFileName.toChar());
+            this->log_WARNING_HI_PrmFileWriteError(PrmWriteError::WRITE,0,stat);
+            this->cmdResponse_out(opCode,cmdSeq,Fw::CmdResponse::EXECUTION_ERROR);
+            return;
+        }
+        if (writeSize != static_cast<FwSignedSizeType>(buff.getBuffLength())) {
+            (void) Os::FileSystem::removeFile(this->m_tempFileName.toChar());
+            this->log_WARNING_HI_PrmFileWriteError(PrmWriteError::WRITE_SIZE,0,writeSize);
+            this->cmdResponse_out(opCode,cmdSeq,Fw::CmdResponse::EXECUTION_ERROR);
+            return;
+        }
 
-        for (NATIVE_UINT_TYPE entry = 0; entry < FW_NUM_ARRAY_ELEMENTS(this->m_db); entry++) {
-            if (this->m_db[entry].used) {
-                // write delimiter
-                static const U8 delim = PRMDB_ENTRY_DELIMITER;
-                FwSignedSizeType writeSize = static_cast<FwSignedSizeType>(sizeof(delim));
-                stat = paramFile.write(&delim,writeSize,Os::File::WaitType::WAIT);
-                if (stat != Os::File::OP_OK) {
-                    this->unLock();
-                    this->log_WARNING_HI_PrmFileWriteError(PrmWriteError::DELIMITER,numRecords,stat);
-                    this->cmdResponse_out(opCode,cmdSeq,Fw::CmdResponse::EXECUTION_ERROR);
-                    return;
-                }
-                if (writeSize != sizeof(delim)) {
-                    this->unLock();
-                    this->log_WARNING_HI_PrmFileWriteError(PrmWriteError::DELIMITER_SIZE,numRecords,writeSize);
-                    this->cmdResponse_out(opCode,cmdSeq,Fw::CmdResponse::EXECUTION_ERROR);
-                    return;
-                }
-                // serialize record size = id field + data
-                U32 recordSize = sizeof(FwPrmIdType) + this->m_db[entry].val.getBuffLength();
-
-                // reset buffer
-                buff.resetSer();
-                Fw::SerializeStatus serStat = buff.serialize(recordSize);
-                // should always work
-                FW_ASSERT(Fw::FW_SERIALIZE_OK == serStat,static_cast<NATIVE_INT_TYPE>(serStat));
-
-                // write record size
-                writeSize = buff.getBuffLength();
-                stat = paramFile.write(buff.getBuffAddr(),writeSize,Os::File::WaitType::WAIT);
-                if (stat != Os::File::OP_OK) {
-                    this->unLock();
-                    this->log_WARNING_HI_PrmFileWriteError(PrmWriteError::RECORD_SIZE,numRecords,stat);
-                    this->cmdResponse_out(opCode,cmdSeq,Fw::CmdResponse::EXECUTION_ERROR);
-                    return;
-                }
-                if (writeSize != sizeof(recordSize)) {
-                    this->unLock();
-                    this->log_WARNING_HI_PrmFileWriteError(PrmWriteError::RECORD_SIZE_SIZE,numRecords,writeSize);
-                    this->cmdResponse_out(opCode,cmdSeq,Fw::CmdResponse::EXECUTION_ERROR);
-                    return;
-                }
-
-                // reset buffer
-                buff.resetSer();
-
-                // serialize parameter id
-
-                serStat = buff.serialize(this->m_db[entry].id);
-                // should always work
-                FW_ASSERT(Fw::FW_SERIALIZE_OK == serStat,static_cast<NATIVE_INT_TYPE>(serStat));
-
-                // write parameter ID
-                writeSize = buff.getBuffLength();
-                stat = paramFile.write(buff.getBuffAddr(),writeSize,Os::File::WaitType::WAIT);
-                if (stat != Os::File::OP_OK) {
-                    this->unLock();
-                    this->log_WARNING_HI_PrmFileWriteError(PrmWriteError::PARAMETER_ID,numRecords,stat);
-                    this->cmdResponse_out(opCode,cmdSeq,Fw::CmdResponse::EXECUTION_ERROR);
-                    return;
-                }
-                if (writeSize != static_cast<FwSignedSizeType>(buff.getBuffLength())) {
-                    this->unLock();
-                    this->log_WARNING_HI_PrmFileWriteError(PrmWriteError::PARAMETER_ID_SIZE,numRecords,writeSize);
-                    this->cmdResponse_out(opCode,cmdSeq,Fw::CmdResponse::EXECUTION_ERROR);
-                    return;
-                }
-
-                // write serialized parameter value
-
-                writeSize = this->m_db[entry].val.getBuffLength();
-                stat = paramFile.write(this->m_db[entry].val.getBuffAddr(),writeSize,Os::File::WaitType::WAIT);
-                if (stat != Os::File::OP_OK) {
-                    this->unLock();
-                    this->log_WARNING_HI_PrmFileWriteError(PrmWriteError::PARAMETER_VALUE,numRecords,stat);
-                    this->cmdResponse_out(opCode,cmdSeq,Fw::CmdResponse::EXECUTION_ERROR);
-                    return;
-                }
-                if (writeSize != static_cast<FwSignedSizeType>(this->m_db[entry].val.getBuffLength())) {
-                    this->unLock();
-                    this->log_WARNING_HI_PrmFileWriteError(PrmWriteError::PARAMETER_VALUE_SIZE,numRecords,writeSize);
-                    this->cmdResponse_out(opCode,cmdSeq,Fw::CmdResponse::EXECUTION_ERROR);
-                    return;
-                }
-                numRecords++;
-            } // end if record in use
-        } // end for each record
+        const Os::FileSystem::Status fsStat = Os::FileSystem::moveFile(this->m_tempFileName.toChar(),this->m_fileName.toChar());
+        if (fsStat != Os::FileSystem::OP_OK) {
+            (void) Os::FileSystem::removeFile(this->m_tempFileName.toChar());
+            this->log_WARNING_HI_PrmFileWriteError(PrmWriteError::RENAME,0,fsStat);
+            this->cmdResponse_out(opCode,cmdSeq,Fw::CmdResponse::EXECUTION_ERROR);
+            return;
+        }
 
-        this->unLock();
         this->log_ACTIVITY_HI_PrmFileSaveComplete(numRecords);
         this->cmdResponse_out(opCode,cmdSeq,Fw::CmdResponse::OK);
 
@@ -254,62 +220,50 @@ namespace Svc {
             return;
         }
 
-        WorkingBuffer buff;
-
-        U32 recordNum = 0;
-
         this->clearDb();
 
-        for (NATIVE_INT_TYPE entry = 0; entry < PRMDB_NUM_DB_ENTRIES; entry++)  {
+        // Read the file in one access. The image holds a full database, so bytes past it belong to records that
+        // would not be loaded anyway.
+        FwSignedSizeType readSize = static_cast<FwSignedSizeType>(sizeof(this->m_fileBuffer));
+        stat = paramFile.read(this->m_fileBuffer,readSize,Os::File::WaitType::WAIT);
+        paramFile.close();
+        if (stat != Os::File::OP_OK) {
+            this->log_WARNING_HI_PrmFileReadError(PrmReadError::READ,0,stat);
+            return;
+        }
 
-            U8 delimiter;
-            FwSignedSizeType readSize = static_cast<FwSignedSizeType>(sizeof(delimiter));
+        Fw::ExternalSerializeBuffer buff(this->m_fileBuffer, sizeof(this->m_fileBuffer));
+        // set serialized size to read size
+        Fw::SerializeStatus desStat = buff.setBuffLen(static_cast<Fw::Serializable::SizeType>(readSize));
+        // should never fail
+        FW_ASSERT(Fw::FW_SERIALIZE_OK == desStat,static_cast<NATIVE_INT_TYPE>(desStat));
 
-            // read delimiter
-            Os::File::Status fStat = paramFile.read(&delimiter,readSize,Os::File::WaitType::WAIT);
+        U32 recordNum = 0;
 
-            // check for end of file (read size 0)
-            if (0 == readSize) {
-                break;
-            }
+        for (NATIVE_INT_TYPE entry = 0; entry < PRMDB_NUM_DB_ENTRIES; entry++)  {
 
-            if (fStat != Os::File::OP_OK) {
-                this->log_WARNING_HI_PrmFileReadError(PrmReadError::DELIMITER,recordNum,fStat);
-                return;
+            // check for end of file
+            if (0 == buff.getBuffLeft()) {
+                break;
             }
 
-            if (sizeof(delimiter) != readSize) {
-                this->log_WARNING_HI_PrmFileReadError(PrmReadError::DELIMITER_SIZE,recordNum,readSize);
-                return;
-            }
+            U8 delimiter = 0;
+            desStat = buff.deserialize(delimiter);
+            FW_ASSERT(Fw::FW_SERIALIZE_OK == desStat,static_cast<NATIVE_INT_TYPE>(desStat));
 
             if (PRMDB_ENTRY_DELIMITER != delimiter) {
                 this->log_WARNING_HI_PrmFileReadError(PrmReadError::DELIMITER_VALUE,recordNum,delimiter);
                 return;
             }
 
-            U32 recordSize = 0;
             // read record size
-            readSize = sizeof(recordSize);
-
-            fStat = paramFile.read(buff.getBuffAddr(),readSize,Os::File::WaitType::WAIT);
-            if (fStat != Os::File::OP_OK) {
-                this->log_WARNING_HI_PrmFileReadError(PrmReadError::RECORD_SIZE,recordNum,fStat);
-                return;
-            }
-            if (sizeof(recordSize) != readSize) {
-                this->log_WARNING_HI_PrmFileReadError(PrmReadError::RECORD_SIZE_SIZE,recordNum,readSize);
+            U32 recordSize = 0;
+            if (buff.getBuffLeft() < sizeof(recordSize)) {
+                this->log_WARNING_HI_PrmFileReadError(PrmReadError::RECORD_SIZE_SIZE,recordNum,buff.getBuffLeft());
                 return;
             }
-            // set serialized size to read size
-            Fw::SerializeStatus desStat = buff.setBuffLen(readSize);
-            // should never fail
-            FW_ASSERT(Fw::FW_SERIALIZE_OK == desStat,static_cast<NATIVE_INT_TYPE>(desStat));
-            // reset deserialization
-            buff.resetDeser();
-            // deserialize, since record size is serialized in file
             desStat = buff.deserialize(recordSize);
-            FW_ASSERT(Fw::FW_SERIALIZE_OK == desStat);
+            FW_ASSERT(Fw::FW_SERIALIZE_OK == desStat,static_cast<NATIVE_INT_TYPE>(desStat));
 
             // sanity check value. It can't be larger than the maximum parameter buffer size + id
             // or smaller than the record id
@@ -320,46 +274,36 @@ namespace Svc {
 
             // read the parameter ID
             FwPrmIdType parameterId = 0;
-            readSize = static_cast<FwSignedSizeType>(sizeof(FwPrmIdType));
-
-            fStat = paramFile.read(buff.getBuffAddr(),readSize,Os::File::WaitType::WAIT);
-            if (fStat != Os::File::OP_OK) {
-                this->log_WARNING_HI_PrmFileReadError(PrmReadError::PARAMETER_ID,recordNum,fStat);
-                return;
-            }
-            if (sizeof(parameterId) != static_cast<FwSizeType>(readSize)) {
-                this->log_WARNING_HI_PrmFileReadError(PrmReadError::PARAMETER_ID_SIZE,recordNum,readSize);
+            if (buff.getBuffLeft() < sizeof(parameterId)) {
+                this->log_WARNING_HI_PrmFileReadError(PrmReadError::PARAMETER_ID_SIZE,recordNum,buff.getBuffLeft());
                 return;
             }
-
-            // set serialized size to read parameter ID
-            desStat = buff.setBuffLen(readSize);
-            // should never fail
-            FW_ASSERT(Fw::FW_SERIALIZE_OK == desStat,static_cast<NATIVE_INT_TYPE>(desStat));
-            // reset deserialization
-            buff.resetDeser();
-            // deserialize, since parameter ID is serialized in file
             desStat = buff.deserialize(parameterId);
-            FW_ASSERT(Fw::FW_SERIALIZE_OK == desStat);
-
-            // copy parameter
-            this->m_db[entry].used = true;
-            this->m_db[entry].id = parameterId;
-            readSize = recordSize-sizeof(parameterId);
-
-            fStat = paramFile.read(this->m_db[entry].val.getBuffAddr(),readSize);
+            FW_ASSERT(Fw::FW_SERIALIZE_OK == desStat,static_cast<NATIVE_INT_TYPE>(desStat));
 
-            if (fStat != Os::File::OP_OK) {
-                this->log_WARNING_HI_PrmFileReadError(PrmReadError::PARAMETER_VALUE,recordNum,fStat);
+            // check the parameter value is complete before storing the record
+            FwSizeType valueSize = recordSize-sizeof(parameterId);
+            if (buff.getBuffLeft() < valueSize) {
+                this->log_WARNING_HI_PrmFileReadError(PrmReadError::PARAMETER_VALUE_SIZE,recordNum,buff.getBuffLeft());
                 return;
             }
-            if (static_cast<U32>(readSize) != recordSize-sizeof(parameterId)) {
-                this->log_WARNING_HI_PrmFileReadError(PrmReadError::PARAMETER_VALUE_SIZE,recordNum,readSize);
-                return;
+
+            // copy parameter. Entries are filled in file order. A parameter repeated in the file is kept but not
+            // indexed, such that lookups return its first value.
+            FW_ASSERT(entry == this->m_numEntries, entry, this->m_numEntries);
+            if (this->findEntry(parameterId) == -1) {
+                (void) this->addEntry(parameterId);
+            } else {
+                this->m_db[entry].used = true;
+                this->m_db[entry].id = parameterId;
+                this->m_numEntries++;
             }
 
-            // set serialized size to read size
-            desStat = this->m_db[entry].val.setBuffLen(readSize);
+            desStat = buff.deserialize(this->m_db[entry].val.getBuffAddr(),valueSize,Fw::Serialization::OMIT_LENGTH);
+            FW_ASSERT(Fw::FW_SERIALIZE_OK == desStat,static_cast<NATIVE_INT_TYPE>(desStat));
+
+            // set serialized size to value size
+            desStat = this->m_db[entry].val.setBuffLen(static_cast<Fw::Serializable::SizeType>(valueSize));
             // should never fail
             FW_ASSERT(Fw::FW_SERIALIZE_OK == desStat,static_cast<NATIVE_INT_TYPE>(desStat));
             recordNum++;
@@ -53,7 +53,8 @@ namespace Svc {
 
             //!  \brief PrmDb configure method
             //!
-            //!  The configure method stores the file name for opening later.
+            //!  The configure method stores the file name for opening later. Saves are
+            //!  written to the same name with a ".tmp" suffix, then renamed over the file.
             //!
             //!  \param file file where parameters are stored.
             void configure(const char* file);
@@ -62,7 +63,7 @@ namespace Svc {
             //!  \brief PrmDb file read function
             //!
             //!  The readFile function reads the set of parameters from the file passed in to
-            //!  the constructor.
+            //!  the constructor. The file is read in one access and parsed from memory.
             //!
             void readParamFile(); // NOTE: Assumed to run at initialization time. No guard of data structure.
 
@@ -104,7 +105,9 @@ namespace Svc {
             //!
             //!  This function saves the parameter values stored in RAM to the file
             //!  specified in the constructor. Any updates to parameters are not saved
-            //!  until this function is called.
+            //!  until this function is called. The database is serialized into one image
+            //!  that is written and synced to a temporary file, which then replaces the
+            //!  parameter file by a rename, so a failed save leaves the previous file intact.
             //!
             //!  \param opCode The opcode of this commands
             //!  \param cmdSeq The sequence number of the command
@@ -117,7 +120,30 @@ namespace Svc {
 
             void clearDb(); //!< clear the parameter database
 
+            //!  \brief PrmDb entry lookup function
+            //!
+            //!  This function finds the database entry holding a parameter through the hash index
+            //!
+            //!  \param id identifier of the parameter
+            //!  \return the entry, or -1 if the parameter is not in the database
+            NATIVE_INT_TYPE findEntry(FwPrmIdType id) const;
+
+            //!  \brief PrmDb entry add function
+            //!
+            //!  This function stores a new parameter in the next free entry and indexes it
+            //!
+            //!  \param id identifier of the parameter, which must not be in the database
+            //!  \return the entry, or -1 if the database is full
+            NATIVE_INT_TYPE addEntry(FwPrmIdType id);
+
+            //!  \brief PrmDb index slot function
+            //!
+            //!  \param id identifier of the parameter
+            //!  \return the first index slot to probe for the parameter
+            static NATIVE_UINT_TYPE indexSlot(FwPrmIdType id);
+
             Fw::String m_fileName; //!< filename for parameter storage
+            Fw::String m_tempFileName; //!< filename saves are written to before replacing the parameter file
 
             struct t_dbStruct {
                 bool used; //!< whether slot is being used
@@ -125,6 +151,24 @@ namespace Svc {
                 Fw::ParamBuffer val; //!< the serialized value of the parameter
             } m_db[PRMDB_NUM_DB_ENTRIES];
 
+            NATIVE_INT_TYPE m_numEntries; //!< number of used entries, entries are filled in order
+
+            enum {
+                INDEX_SIZE = 2 * PRMDB_NUM_DB_ENTRIES //!< twice the database size such that probe sequences stay short
+            };
+
+            //! Open-addressed hash index of the used entries by parameter ID, with linear probing.
+            //! Slots hold an entry number or -1 if empty.
+            NATIVE_INT_TYPE m_index[INDEX_SIZE];
+
+            enum {
+                //! a full database in file form: delimiter, record size, ID and largest value of each entry
+                FILE_BUFFER_SIZE = PRMDB_NUM_DB_ENTRIES *
+                    (sizeof(U8) + sizeof(U32) + sizeof(FwPrmIdType) + FW_PARAM_BUFFER_MAX_SIZE)
+            };
+
+            U8 m_fileBuffer[FILE_BUFFER_SIZE]; //!< file image, such that the file is loaded and saved in one access
+
     };
 }
 
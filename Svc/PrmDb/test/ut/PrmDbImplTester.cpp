@@ -9,6 +9,7 @@
 #include <Fw/Com/ComBuffer.hpp>
 #include <Fw/Com/ComPacket.hpp>
 #include <Os/Stub/test/File.hpp>
+#include <Os/FileSystem.hpp>
 #include <cstdio>
 #include <gtest/gtest.h>
 
@@ -127,6 +128,9 @@ namespace Svc {
             pdb004 = true;
         }
 
+        // file contents go to the stub, the temporary file only needs to exist on disk to be renamed
+        this->createTempFile();
+
         this->sendCmd_PRM_SAVE_FILE(0,12);
         Fw::QueuedComponentBase::MsgDispatchStatus stat = this->m_impl.doDispatch();
         EXPECT_EQ(stat,Fw::QueuedComponentBase::MSG_DISPATCH_OK);
@@ -136,6 +140,19 @@ namespace Svc {
         ASSERT_EVENTS_PrmFileSaveComplete_SIZE(1);
         ASSERT_EVENTS_PrmFileSaveComplete(0,2);
 
+        // the whole database is written in one access and renamed over the parameter file
+        EXPECT_STREQ(Os::Stub::File::Test::StaticData::data.openPath,this->m_impl.m_tempFileName.toChar());
+        EXPECT_EQ(Os::Stub::File::Test::StaticData::data.writeSize,static_cast<FwSignedSizeType>(2 * RECORD_SIZE));
+        FwSignedSizeType fileSize = 0;
+        EXPECT_NE(Os::FileSystem::OP_OK,Os::FileSystem::getFileSize(this->m_impl.m_tempFileName.toChar(),fileSize));
+        EXPECT_EQ(Os::FileSystem::OP_OK,Os::FileSystem::removeFile(this->m_impl.m_fileName.toChar()));
+
+    }
+
+    void PrmDbImplTester::createTempFile() {
+        FILE* file = ::fopen(this->m_impl.m_tempFileName.toChar(),"w");
+        ASSERT_NE(file,nullptr);
+        ::fclose(file);
     }
 
     void PrmDbImplTester::runNominalLoadFile() {
@@ -211,6 +228,46 @@ namespace Svc {
 
     }
 
+    void PrmDbImplTester::runFullDbLookup() {
+
+        // clear database
+        this->m_impl.clearDb();
+
+        // fill the database with IDs spaced like component parameter bases, and values derived from the IDs
+        Fw::ParamBuffer pBuff;
+        for (FwPrmIdType entry = 0; entry < PRMDB_NUM_DB_ENTRIES; entry++) {
+            const FwPrmIdType id = (entry * 0x100) + (entry % 3);
+            pBuff.resetSer();
+            EXPECT_EQ(Fw::FW_SERIALIZE_OK,pBuff.serialize(static_cast<U32>(id + 7)));
+            this->invoke_to_setPrm(0,id,pBuff);
+            this->m_impl.doDispatch();
+        }
+
+        // every parameter is found with its own value, in reverse order of insertion
+        for (FwPrmIdType entry = PRMDB_NUM_DB_ENTRIES; entry > 0; entry--) {
+            const FwPrmIdType id = ((entry - 1) * 0x100) + ((entry - 1) % 3);
+            U32 testVal = 0;
+            pBuff.resetSer();
+            EXPECT_EQ(Fw::ParamValid::VALID,this->invoke_to_getPrm(0,id,pBuff).e);
+            EXPECT_EQ(Fw::FW_SERIALIZE_OK,pBuff.deserialize(testVal));
+            EXPECT_EQ(id + 7,testVal);
+        }
+
+        // missing parameters are not found in a full database
+        this->clearEvents();
+        EXPECT_EQ(Fw::ParamValid::INVALID,this->invoke_to_getPrm(0,0x102,pBuff).e);
+        ASSERT_EVENTS_PrmIdNotFound_SIZE(1);
+
+        // updates of a full database find the existing entry
+        this->clearEvents();
+        pBuff.resetSer();
+        EXPECT_EQ(Fw::FW_SERIALIZE_OK,pBuff.serialize(static_cast<U32>(0)));
+        this->invoke_to_setPrm(0,0x202,pBuff);
+        this->m_impl.doDispatch();
+        ASSERT_EVENTS_SIZE(1);
+        ASSERT_EVENTS_PrmIdUpdated(0,0x202);
+    }
+
     void PrmDbImplTester::runRefPrmFile() {
 
         {
@@ -404,41 +461,13 @@ namespace Svc {
     void PrmDbImplTester::runFileReadError() {
         // Preconditions setup and test
         this->runNominalLoadFile();
+        const FwSignedSizeType fileSize = Os::Stub::File::Test::StaticData::data.readResultSize;
+        ASSERT_EQ(fileSize,static_cast<FwSignedSizeType>(2 * RECORD_SIZE));
 
-
-        this->clearEvents();
-        // Loop through all size errors testing each
+        // Loop through failure statuses of the file read
         Os::Stub::File::Test::StaticData::setNextStatus(Os::File::OP_OK);
-        this->m_errorType = FILE_SIZE_ERROR;
-        for (FwSizeType i = 0; i < 4; i++) {
-            clearEvents();
-            this->m_waits = i;
-            this->m_impl.readParamFile();
-            ASSERT_EVENTS_SIZE(1);
-            switch (i) {
-                case 0:
-                    ASSERT_EVENTS_PrmFileReadError_SIZE(1);
-                    ASSERT_EVENTS_PrmFileReadError(0, PrmReadError::DELIMITER_SIZE, 0, sizeof(U8) + 1);
-                    break;
-                case 1:
-                    ASSERT_EVENTS_PrmFileReadError_SIZE(1);
-                    ASSERT_EVENTS_PrmFileReadError(0, PrmReadError::RECORD_SIZE_SIZE, 0, sizeof(U32) + 1);
-                    break;
-                case 2:
-                    ASSERT_EVENTS_PrmFileReadError_SIZE(1);
-                    ASSERT_EVENTS_PrmFileReadError(0,PrmReadError::PARAMETER_ID_SIZE, 0, sizeof(FwPrmIdType) + 1);
-                    break;
-                case 3:
-                    ASSERT_EVENTS_PrmFileReadError_SIZE(1);
-                    ASSERT_EVENTS_PrmFileReadError(0, PrmReadError::PARAMETER_VALUE_SIZE, 0, sizeof(U32) + 1);
-                    break;
-                default:
-                    FAIL() << "Reached unknown case";
-            }
-        }
-        // Loop through failure statuses
+        this->m_errorType = FILE_STATUS_ERROR;
         for (FwSizeType i = 0; i < 2; i++) {
-            this->m_errorType = FILE_STATUS_ERROR;
             // Set various file errors
             switch (i) {
                 case 0:
@@ -450,59 +479,81 @@ namespace Svc {
                 default:
                     FAIL() << "Reached unknown case";
             }
-            // Loop through various field reads
-            for (FwSizeType j = 0; j < 4; j++) {
-                clearEvents();
-                this->m_waits = j;
-                this->m_impl.readParamFile();
-                ASSERT_EVENTS_SIZE(1);
-                switch (j) {
-                    case 0:
-                        ASSERT_EVENTS_PrmFileReadError_SIZE(1);
-                        ASSERT_EVENTS_PrmFileReadError(0,PrmReadError::DELIMITER, 0, this->m_status);
-                        break;
-                    case 1:
-                        ASSERT_EVENTS_PrmFileReadError_SIZE(1);
-                        ASSERT_EVENTS_PrmFileReadError(0, PrmReadError::RECORD_SIZE, 0, this->m_status);
-                        break;
-                    case 2:
-                        ASSERT_EVENTS_PrmFileReadError_SIZE(1);
-                        ASSERT_EVENTS_PrmFileReadError(0, PrmReadError::PARAMETER_ID, 0, this->m_status);
-                        break;
-                    case 3:
-                        ASSERT_EVENTS_PrmFileReadError_SIZE(1);
-                        ASSERT_EVENTS_PrmFileReadError(0, PrmReadError::PARAMETER_VALUE, 0, this->m_status);
-                        break;
-                    default:
-                        FAIL() << "Reached unknown case";
-                }
-            }
-        }
-        this->m_errorType = FILE_DATA_ERROR;
-        for (FwSizeType i = 0; i < 2; i++) {
             clearEvents();
-            this->m_waits = i;
+            this->m_waits = 0;
             this->m_impl.readParamFile();
             ASSERT_EVENTS_SIZE(1);
+            ASSERT_EVENTS_PrmFileReadError_SIZE(1);
+            ASSERT_EVENTS_PrmFileReadError(0, PrmReadError::READ, 0, this->m_status);
+        }
+        this->m_errorType = FILE_READ_NO_ERROR;
+
+        // Loop through files truncated inside each field, leaving two bytes of the field
+        for (FwSizeType i = 0; i < 4; i++) {
+            clearEvents();
             switch (i) {
                 case 0:
+                    Os::Stub::File::Test::StaticData::setReadResult(m_io_data, sizeof(U8));
+                    this->m_impl.readParamFile();
                     ASSERT_EVENTS_PrmFileReadError_SIZE(1);
-                    // Parameter read error caused by adding one to the expected read
-                    ASSERT_EVENTS_PrmFileReadError(0, PrmReadError::DELIMITER_VALUE, 0, PRMDB_ENTRY_DELIMITER + 1);
+                    ASSERT_EVENTS_PrmFileReadError(0, PrmReadError::RECORD_SIZE_SIZE, 0, 0);
                     break;
-                case 1: {
-                    // Data in this test is corrupted by adding 1 to the first data byte read. Since data is stored in
-                    // big-endian format the highest order byte of the record size (U32) must have one added to it.
-                    // Expected result of '8' inherited from original design of test.
-                    U32 expected_error_value = 8 + (1 << ((sizeof(U32) - 1) * 8));
+                case 1:
+                    Os::Stub::File::Test::StaticData::setReadResult(m_io_data, sizeof(U8) + 2);
+                    this->m_impl.readParamFile();
+                    ASSERT_EVENTS_PrmFileReadError_SIZE(1);
+                    ASSERT_EVENTS_PrmFileReadError(0, PrmReadError::RECORD_SIZE_SIZE, 0, 2);
+                    break;
+                case 2:
+                    Os::Stub::File::Test::StaticData::setReadResult(m_io_data, sizeof(U8) + sizeof(U32) + 2);
+                    this->m_impl.readParamFile();
                     ASSERT_EVENTS_PrmFileReadError_SIZE(1);
-                    ASSERT_EVENTS_PrmFileReadError(0, PrmReadError::RECORD_SIZE_VALUE, 0, expected_error_value);
+                    ASSERT_EVENTS_PrmFileReadError(0, PrmReadError::PARAMETER_ID_SIZE, 0, 2);
+                    break;
+                case 3:
+                    Os::Stub::File::Test::StaticData::setReadResult(m_io_data, RECORD_SIZE - 2);
+                    this->m_impl.readParamFile();
+                    ASSERT_EVENTS_PrmFileReadError_SIZE(1);
+                    ASSERT_EVENTS_PrmFileReadError(0, PrmReadError::PARAMETER_VALUE_SIZE, 0, 2);
                     break;
-                }
                 default:
                     FAIL() << "Reached unknown case";
             }
+            ASSERT_EVENTS_SIZE(1);
         }
+
+        // A file truncated in the second record keeps the first
+        clearEvents();
+        Os::Stub::File::Test::StaticData::setReadResult(m_io_data, RECORD_SIZE + sizeof(U8) + 2);
+        this->m_impl.readParamFile();
+        ASSERT_EVENTS_PrmFileReadError_SIZE(1);
+        ASSERT_EVENTS_PrmFileReadError(0, PrmReadError::RECORD_SIZE_SIZE, 1, 2);
+        Fw::ParamBuffer pBuff;
+        EXPECT_EQ(Fw::ParamValid::VALID,this->invoke_to_getPrm(0,0x21,pBuff).e);
+        EXPECT_EQ(Fw::ParamValid::INVALID,this->invoke_to_getPrm(0,0x25,pBuff).e);
+        Os::Stub::File::Test::StaticData::setReadResult(m_io_data, fileSize);
+
+        // Corrupt the delimiter as it is read
+        clearEvents();
+        this->m_errorType = FILE_DATA_ERROR;
+        this->m_waits = 0;
+        this->m_impl.readParamFile();
+        ASSERT_EVENTS_SIZE(1);
+        ASSERT_EVENTS_PrmFileReadError_SIZE(1);
+        // Parameter read error caused by adding one to the expected read
+        ASSERT_EVENTS_PrmFileReadError(0, PrmReadError::DELIMITER_VALUE, 0, PRMDB_ENTRY_DELIMITER + 1);
+        this->m_errorType = FILE_READ_NO_ERROR;
+
+        // Corrupt the record size. Since data is stored in big-endian format the highest order byte of the record
+        // size (U32) has one added to it. Expected result of '8' inherited from original design of test.
+        clearEvents();
+        m_io_data[sizeof(U8)] += 1;
+        this->m_impl.readParamFile();
+        m_io_data[sizeof(U8)] -= 1;
+        U32 expected_error_value = 8 + (1 << ((sizeof(U32) - 1) * 8));
+        ASSERT_EVENTS_SIZE(1);
+        ASSERT_EVENTS_PrmFileReadError_SIZE(1);
+        ASSERT_EVENTS_PrmFileReadError(0, PrmReadError::RECORD_SIZE_VALUE, 0, expected_error_value);
     }
 
 
@@ -527,44 +578,25 @@ namespace Svc {
 
         this->runNominalPopulate();
 
-        // Loop through all size errors testing each
+        // Short write of the file image
+        Os::Stub::File::Test::StaticData::setWriteResult(m_io_data, sizeof m_io_data);
         Os::Stub::File::Test::StaticData::setNextStatus(Os::File::OP_OK);
         this->m_errorType = FILE_SIZE_ERROR;
-        for (FwSizeType i = 0; i < 4; i++) {
-            clearEvents();
-            this->clearHistory();
-            this->m_waits = i;
-            this->sendCmd_PRM_SAVE_FILE(0,12);
-            stat = this->m_impl.doDispatch();
-            ASSERT_EQ(stat, Fw::QueuedComponentBase::MSG_DISPATCH_OK);
-            ASSERT_EVENTS_SIZE(1);
-            switch (i) {
-                case 0:
-                    ASSERT_EVENTS_PrmFileWriteError_SIZE(1);
-                    ASSERT_EVENTS_PrmFileWriteError(0, PrmWriteError::DELIMITER_SIZE, 0, sizeof(U8) + 1);
-                    break;
-                case 1:
-                    ASSERT_EVENTS_PrmFileWriteError_SIZE(1);
-                    ASSERT_EVENTS_PrmFileWriteError(0, PrmWriteError::RECORD_SIZE_SIZE, 0, sizeof(U32) + 1);
-                    break;
-                case 2:
-                    ASSERT_EVENTS_PrmFileWriteError_SIZE(1);
-                    ASSERT_EVENTS_PrmFileWriteError(0, PrmWriteError::PARAMETER_ID_SIZE, 0, sizeof(FwPrmIdType) + 1);
-                    break;
-                case 3:
-                    ASSERT_EVENTS_PrmFileWriteError_SIZE(1);
-                    ASSERT_EVENTS_PrmFileWriteError(0, PrmWriteError::PARAMETER_VALUE_SIZE, 0, sizeof(U32) + 1);
-                    break;
-                default:
-                    FAIL() << "Reached unknown case";
-            }
-            ASSERT_CMD_RESPONSE_SIZE(1);
-            ASSERT_CMD_RESPONSE(0,PrmDbImpl::OPCODE_PRM_SAVE_FILE,12,Fw::CmdResponse::EXECUTION_ERROR);
-        }
+        clearEvents();
+        this->clearHistory();
+        this->m_waits = 0;
+        this->sendCmd_PRM_SAVE_FILE(0,12);
+        stat = this->m_impl.doDispatch();
+        ASSERT_EQ(stat, Fw::QueuedComponentBase::MSG_DISPATCH_OK);
+        ASSERT_EVENTS_SIZE(1);
+        ASSERT_EVENTS_PrmFileWriteError_SIZE(1);
+        ASSERT_EVENTS_PrmFileWriteError(0, PrmWriteError::WRITE_SIZE, 0, 2 * RECORD_SIZE + 1);
+        ASSERT_CMD_RESPONSE_SIZE(1);
+        ASSERT_CMD_RESPONSE(0,PrmDbImpl::OPCODE_PRM_SAVE_FILE,12,Fw::CmdResponse::EXECUTION_ERROR);
 
         // Loop through failure statuses
+        this->m_errorType = FILE_STATUS_ERROR;
         for (FwSizeType i = 0; i < 2; i++) {
-            this->m_errorType = FILE_STATUS_ERROR;
             // Set various file errors
             switch (i) {
                 case 0:
@@ -576,39 +608,31 @@ namespace Svc {
                 default:
                     FAIL() << "Reached unknown case";
             }
-            // Loop through various field reads
-            for (FwSizeType j = 0; j < 4; j++) {
-                clearEvents();
-                this->clearHistory();
-                this->m_waits = j;
-                this->sendCmd_PRM_SAVE_FILE(0,12);
-                stat = this->m_impl.doDispatch();
-                ASSERT_EQ(stat, Fw::QueuedComponentBase::MSG_DISPATCH_OK);
-                ASSERT_EVENTS_SIZE(1);
-                switch (j) {
-                    case 0:
-                        ASSERT_EVENTS_PrmFileWriteError_SIZE(1);
-                        ASSERT_EVENTS_PrmFileWriteError(0, PrmWriteError::DELIMITER, 0, this->m_status);
-                        break;
-                    case 1:
-                        ASSERT_EVENTS_PrmFileWriteError_SIZE(1);
-                        ASSERT_EVENTS_PrmFileWriteError(0, PrmWriteError::RECORD_SIZE, 0, this->m_status);
-                        break;
-                    case 2:
-                        ASSERT_EVENTS_PrmFileWriteError_SIZE(1);
-                        ASSERT_EVENTS_PrmFileWriteError(0, PrmWriteError::PARAMETER_ID, 0, this->m_status);
-                        break;
-                    case 3:
-                        ASSERT_EVENTS_PrmFileWriteError_SIZE(1);
-                        ASSERT_EVENTS_PrmFileWriteError(0, PrmWriteError::PARAMETER_VALUE, 0, this->m_status);
-                        break;
-                    default:
-                        FAIL() << "Reached unknown case";
-                }
-                ASSERT_CMD_RESPONSE_SIZE(1);
-                ASSERT_CMD_RESPONSE(0,PrmDbImpl::OPCODE_PRM_SAVE_FILE,12,Fw::CmdResponse::EXECUTION_ERROR);
-            }
+            clearEvents();
+            this->clearHistory();
+            this->m_waits = 0;
+            this->sendCmd_PRM_SAVE_FILE(0,12);
+            stat = this->m_impl.doDispatch();
+            ASSERT_EQ(stat, Fw::QueuedComponentBase::MSG_DISPATCH_OK);
+            ASSERT_EVENTS_SIZE(1);
+            ASSERT_EVENTS_PrmFileWriteError_SIZE(1);
+            ASSERT_EVENTS_PrmFileWriteError(0, PrmWriteError::WRITE, 0, this->m_status);
+            ASSERT_CMD_RESPONSE_SIZE(1);
+            ASSERT_CMD_RESPONSE(0,PrmDbImpl::OPCODE_PRM_SAVE_FILE,12,Fw::CmdResponse::EXECUTION_ERROR);
         }
+        this->m_errorType = FILE_READ_NO_ERROR;
+
+        // The written temporary file cannot be renamed when it is not on disk
+        clearEvents();
+        this->clearHistory();
+        this->sendCmd_PRM_SAVE_FILE(0,12);
+        stat = this->m_impl.doDispatch();
+        ASSERT_EQ(stat, Fw::QueuedComponentBase::MSG_DISPATCH_OK);
+        ASSERT_EVENTS_SIZE(1);
+        ASSERT_EVENTS_PrmFileWriteError_SIZE(1);
+        ASSERT_EVENTS_PrmFileWriteError(0, PrmWriteError::RENAME, 0, Os::FileSystem::INVALID_PATH);
+        ASSERT_CMD_RESPONSE_SIZE(1);
+        ASSERT_CMD_RESPONSE(0,PrmDbImpl::OPCODE_PRM_SAVE_FILE,12,Fw::CmdResponse::EXECUTION_ERROR);
     }
 
     PrmDbImplTester::PrmDbImplTester(Svc::PrmDbImpl& inst) :
@@ -24,6 +24,7 @@ namespace Svc {
             void runNominalSaveFile();
             void runNominalLoadFile();
             void runMissingExtraParams();
+            void runFullDbLookup();
             void runFileReadError();
             void runFileWriteError();
 
@@ -40,6 +41,12 @@ namespace Svc {
             );
             Svc::PrmDbImpl& m_impl;
             void resetEvents();
+            void createTempFile(); //!< create the temporary file of a save on disk, such that it can be renamed
+
+            enum {
+                //! file size of a record holding a U32 value, as populated by runNominalPopulate()
+                RECORD_SIZE = sizeof(U8) + sizeof(U32) + sizeof(FwPrmIdType) + sizeof(U32)
+            };
 
 
 
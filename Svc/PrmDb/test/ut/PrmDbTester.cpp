@@ -144,6 +144,27 @@ TEST(ParameterDbTest,PrmMissingExtraParamsTest) {
 
 }
 
+TEST(ParameterDbTest,PrmFullDbLookupTest) {
+
+    TEST_CASE(105.2.4,"Full database lookup test");
+    COMMENT("Fill the database and verify every parameter is found through the index");
+
+    Svc::PrmDbImpl impl("PrmDbImpl");
+
+    impl.init(10,0);
+    impl.configure("TestFile.prm");
+    Svc::PrmDbImplTester tester(impl);
+
+    tester.init();
+
+    // connect ports
+    connectPorts(impl,tester);
+
+    // run test
+    tester.runFullDbLookup();
+
+}
+
 TEST(ParameterDbTest,PrmFileReadError) {
 
     TEST_CASE(105.2.2,"File read errors");
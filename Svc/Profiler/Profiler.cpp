@@ -0,0 +1,274 @@
+// ======================================================================
+// \title  Profiler.cpp
+// \brief  cpp file for Profiler component implementation class
+//
+// \copyright
+// Copyright 2009-2024, by the California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#include <Svc/Profiler/Profiler.hpp>
+#include <Fw/Port/PortBase.hpp>
+#include <FpConfig.hpp>
+#include <Os/IntervalTimer.hpp>
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+
+namespace Svc {
+
+#if FW_PORT_TRACE_RECORDING == 1
+namespace {
+//! Start of the trace clock in raw time, advanced on each run so the microsecond difference from it does not wrap
+struct TraceEpoch {
+    Os::IntervalTimer::RawTime raw;  //!< Raw time of the epoch
+    U64 usec;                        //!< Trace clock at the epoch
+};
+
+//! Epochs are double buffered so port calls on other threads read a complete epoch while run writes the other one
+TraceEpoch s_traceEpochs[2];
+std::atomic<U32> s_traceEpoch(0);
+
+U64 traceClock() {
+    const TraceEpoch& epoch = s_traceEpochs[s_traceEpoch.load(std::memory_order_acquire)];
+    Os::IntervalTimer::RawTime now;
+    Os::IntervalTimer::getRawTime(now);
+    return epoch.usec + Os::IntervalTimer::getDiffUsec(now, epoch.raw);
+}
+
+void advanceTraceEpoch() {
+    const U32 next = 1 - s_traceEpoch.load(std::memory_order_relaxed);
+    Os::IntervalTimer::getRawTime(s_traceEpochs[next].raw);
+    const TraceEpoch& current = s_traceEpochs[1 - next];
+    s_traceEpochs[next].usec = current.usec + Os::IntervalTimer::getDiffUsec(s_traceEpochs[next].raw, current.raw);
+    s_traceEpoch.store(next, std::memory_order_release);
+}
+}  // namespace
+#endif
+
+// ----------------------------------------------------------------------
+// Construction, initialization, and destruction
+// ----------------------------------------------------------------------
+
+Profiler ::Profiler(const char* const compName) : ProfilerComponentBase(compName) {
+#if FW_PORT_TRACE_RECORDING == 1
+    s_traceEpochs[0].usec = 0;
+    Os::IntervalTimer::getRawTime(s_traceEpochs[0].raw);
+    s_traceEpoch.store(0);
+    Fw::PortTrace::setClock(traceClock);
+#endif
+#if FW_PROFILING == 1
+    for (U32 i = 0; i < ProfilerCounts::SIZE; i++) {
+        this->m_slots[i] = nullptr;
+        this->m_prevDispatches[i] = 0;
+        this->m_prevHandlerTotal[i] = 0;
+        this->m_prevLatencyTotal[i] = 0;
+    }
+#endif
+}
+
+Profiler ::~Profiler() {
+#if FW_PORT_TRACE_RECORDING == 1
+    Fw::PortTrace::setClock(nullptr);
+#endif
+}
+
+// ----------------------------------------------------------------------
+// Handler implementations for user-defined typed input ports
+// ----------------------------------------------------------------------
+
+void Profiler ::run_handler(const NATIVE_INT_TYPE portNum, U32 context) {
+#if FW_PORT_TRACE_RECORDING == 1
+    advanceTraceEpoch();
+#endif
+#if FW_PROFILING == 1
+    ProfilerCounts dispatches;
+    ProfilerUsec handlerTime;
+    ProfilerUsec latency;
+    Fw::ActiveComponentBase* component = Fw::ActiveComponentBase::getFirstProfiled();
+
+    for (U32 slot = 0; slot < ProfilerCounts::SIZE; slot++) {
+        dispatches[slot] = 0;
+        handlerTime[slot] = 0;
+        latency[slot] = 0;
+        if (component == nullptr) {
+            this->m_slots[slot] = nullptr;
+            continue;
+        }
+        // Components are read while their tasks run, so counts and totals may be off by the message in progress
+        const Fw::ProfileHistogram& handler = component->getHandlerProfile();
+        const Fw::ProfileHistogram& waited = component->getLatencyProfile();
+        const U32 count = handler.getCount();
+        const U64 handlerTotal = handler.getTotal();
+        const U64 latencyTotal = waited.getTotal();
+        if (this->m_slots[slot] != component) {
+            // New component in this slot, its interval starts now
+            Fw::LogStringArg name;
+            componentName(*component, name);
+            this->log_ACTIVITY_LO_PROFILER_SLOT(slot, name);
+            this->m_slots[slot] = component;
+        } else {
+            dispatches[slot] = count - this->m_prevDispatches[slot];
+            handlerTime[slot] = static_cast<U32>(handlerTotal - this->m_prevHandlerTotal[slot]);
+            latency[slot] = (dispatches[slot] == 0)
+                                ? 0
+                                : static_cast<U32>((latencyTotal - this->m_prevLatencyTotal[slot]) / dispatches[slot]);
+        }
+        this->m_prevDispatches[slot] = count;
+        this->m_prevHandlerTotal[slot] = handlerTotal;
+        this->m_prevLatencyTotal[slot] = latencyTotal;
+        component = component->getNextProfiled();
+    }
+    this->tlmWrite_DISPATCHES(dispatches);
+    this->tlmWrite_HANDLER_TIME(handlerTime);
+    this->tlmWrite_QUEUE_LATENCY(latency);
+#endif
+}
+
+// ----------------------------------------------------------------------
+// Command handler implementations
+// ----------------------------------------------------------------------
+
+void Profiler ::DUMP_cmdHandler(const FwOpcodeType opCode, const U32 cmdSeq) {
+#if FW_PROFILING == 1
+    for (Fw::ActiveComponentBase* component = Fw::ActiveComponentBase::getFirstProfiled(); component != nullptr;
+         component = component->getNextProfiled()) {
+        const Fw::ProfileHistogram& handler = component->getHandlerProfile();
+        const Fw::ProfileHistogram& waited = component->getLatencyProfile();
+        const U32 count = handler.getCount();
+        Fw::LogStringArg name;
+        componentName(*component, name);
+        this->log_ACTIVITY_LO_COMPONENT_PROFILE(
+            name, count, (count == 0) ? 0 : static_cast<U32>(handler.getTotal() / count), handler.getPercentile(99),
+            handler.getMax(), (count == 0) ? 0 : static_cast<U32>(waited.getTotal() / count),
+            waited.getPercentile(99), waited.getMax());
+    }
+#if FW_PORT_TRACING == 1 && FW_PORT_TRACE_RECORDING == 1
+    // Ports are found through their trace identifiers, those never called are left out
+    const U32 ports = Fw::PortTrace::getPortCount();
+    for (U32 id = 0; (id < ports) && (id < FW_PORT_TRACE_MAX_PORTS); id++) {
+        // Only ports register with the trace
+        Fw::PortBase* port = static_cast<Fw::PortBase*>(Fw::PortTrace::getPort(id));
+        if ((port == nullptr) || (port->getCallCount() == 0)) {
+            continue;
+        }
+        Fw::LogStringArg name;
+#if FW_OBJECT_NAMES == 1
+        name = port->getObjName();
+#else
+        char portName[16];
+        (void)snprintf(portName, sizeof(portName), "port %" PRIu32, id);
+        name = portName;
+#endif
+        this->log_ACTIVITY_LO_PORT_CALLS(name, port->getCallCount());
+    }
+#endif
+    this->cmdResponse_out(opCode, cmdSeq, Fw::CmdResponse::OK);
+#else
+    this->log_WARNING_LO_PROFILING_DISABLED();
+    this->cmdResponse_out(opCode, cmdSeq, Fw::CmdResponse::EXECUTION_ERROR);
+#endif
+}
+
+void Profiler ::DUMP_TRACE_cmdHandler(const FwOpcodeType opCode, const U32 cmdSeq, const Fw::CmdStringArg& file) {
+#if FW_PORT_TRACE_RECORDING == 1
+    Fw::LogStringArg logName(file.toChar());
+    Os::File trace;
+    U32 records = 0;
+    Os::File::Status status = trace.open(file.toChar(), Os::File::OPEN_WRITE);
+    if (status == Os::File::OP_OK) {
+        status = this->writeTrace(trace, records);
+        trace.close();
+    }
+    if (status != Os::File::OP_OK) {
+        this->log_WARNING_HI_TRACE_FILE_ERROR(logName, status);
+        this->cmdResponse_out(opCode, cmdSeq, Fw::CmdResponse::EXECUTION_ERROR);
+        return;
+    }
+    this->log_ACTIVITY_LO_TRACE_WRITTEN(logName, records, Fw::PortTrace::getDropped());
+    this->cmdResponse_out(opCode, cmdSeq, Fw::CmdResponse::OK);
+#else
+    (void)file;
+    this->log_WARNING_LO_TRACING_DISABLED();
+    this->cmdResponse_out(opCode, cmdSeq, Fw::CmdResponse::EXECUTION_ERROR);
+#endif
+}
+
+void Profiler ::TRACE_ENABLE_cmdHandler(const FwOpcodeType opCode, const U32 cmdSeq, Fw::Enabled enable) {
+#if FW_PORT_TRACE_RECORDING == 1
+    Fw::PortTrace::setEnabled(enable == Fw::Enabled::ENABLED);
+    this->cmdResponse_out(opCode, cmdSeq, Fw::CmdResponse::OK);
+#else
+    (void)enable;
+    this->log_WARNING_LO_TRACING_DISABLED();
+    this->cmdResponse_out(opCode, cmdSeq, Fw::CmdResponse::EXECUTION_ERROR);
+#endif
+}
+
+#if FW_PORT_TRACE_RECORDING == 1
+Os::File::Status Profiler ::writeTrace(Os::File& file, U32& records) {
+    Os::File::Status status = writeString(file, "{\"traceEvents\":[");
+    const char* separator = "\n";
+    records = 0;
+    // Each ring holds the calls of one thread, reported as one row of the trace viewer
+    for (U32 ring = 0; (ring < Fw::PortTrace::getRingCount()) && (status == Os::File::OP_OK); ring++) {
+        const U32 count = Fw::PortTrace::snapshot(ring, this->m_traceRecords, FW_PORT_TRACE_RING_SIZE);
+        for (U32 i = 0; (i < count) && (status == Os::File::OP_OK); i++) {
+            const Fw::PortTrace::Record& record = this->m_traceRecords[i];
+            const char* portName = nullptr;
+#if FW_OBJECT_NAMES == 1
+            // Port names are prefixed by the name of their component
+            Fw::ObjBase* port = Fw::PortTrace::getPort(record.port);
+            if (port != nullptr) {
+                portName = port->getObjName();
+            }
+#endif
+#if FW_OBJECT_NAMES == 1
+            char name[FW_OBJ_NAME_MAX_SIZE + 16];
+#else
+            char name[16];
+#endif
+            if (portName != nullptr) {
+                (void)snprintf(name, sizeof(name), "%s", portName);
+            } else {
+                (void)snprintf(name, sizeof(name), "port %" PRIu32, record.port);
+            }
+            char event[sizeof(name) + 96];
+            (void)snprintf(event, sizeof(event),
+                           "%s{\"name\":\"%s\",\"ph\":\"i\",\"s\":\"t\",\"ts\":%" PRIu64 ",\"pid\":0,\"tid\":%" PRIu32 "}",
+                           separator, name, record.time, ring);
+            status = writeString(file, event);
+            separator = ",\n";
+            records++;
+        }
+    }
+    if (status == Os::File::OP_OK) {
+        status = writeString(file, "\n]}\n");
+    }
+    return status;
+}
+
+Os::File::Status Profiler ::writeString(Os::File& file, const char* string) {
+    const FwSignedSizeType length = static_cast<FwSignedSizeType>(strlen(string));
+    FwSignedSizeType size = length;
+    Os::File::Status status = file.write(reinterpret_cast<const U8*>(string), size, Os::File::WaitType::WAIT);
+    if ((status == Os::File::OP_OK) && (size != length)) {
+        status = Os::File::OTHER_ERROR;
+    }
+    return status;
+}
+#endif
+
+#if FW_PROFILING == 1
+void Profiler ::componentName(Fw::ActiveComponentBase& component, Fw::LogStringArg& name) {
+#if FW_OBJECT_NAMES == 1
+    name = component.getObjName();
+#else
+    name = "unnamed";
+#endif
+}
+#endif
+
+}  // end namespace Svc
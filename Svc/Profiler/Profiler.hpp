@@ -0,0 +1,105 @@
+// ======================================================================
+// \title  Profiler.hpp
+// \brief  hpp file for Profiler component implementation class
+//
+// \copyright
+// Copyright 2009-2024, by the California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#ifndef Svc_Profiler_HPP
+#define Svc_Profiler_HPP
+
+#include <Fw/Comp/ActiveComponentBase.hpp>
+#include <Fw/Port/PortTrace.hpp>
+#include <Os/File.hpp>
+#include "Svc/Profiler/ProfilerComponentAc.hpp"
+
+namespace Svc {
+
+class Profiler : public ProfilerComponentBase {
+  public:
+    // ----------------------------------------------------------------------
+    // Construction, initialization, and destruction
+    // ----------------------------------------------------------------------
+
+    //! Construct object Profiler
+    //!
+    Profiler(const char* const compName /*!< The component name*/
+    );
+
+    //! Destroy object Profiler
+    //!
+    ~Profiler();
+
+  PRIVATE:
+    // ----------------------------------------------------------------------
+    // Handler implementations for user-defined typed input ports
+    // ----------------------------------------------------------------------
+
+    //! Handler implementation for run
+    //!
+    void run_handler(const NATIVE_INT_TYPE portNum, /*!< The port number*/
+                     U32 context                    /*!< The call order*/
+    );
+
+    // ----------------------------------------------------------------------
+    // Command handler implementations
+    // ----------------------------------------------------------------------
+
+    //! Implementation for DUMP command handler
+    //! Report the profile accumulated since startup of every active component, and the calls of every port
+    //! when FW_PORT_TRACE_RECORDING is also enabled, as events
+    void DUMP_cmdHandler(const FwOpcodeType opCode, /*!< The opcode*/
+                         const U32 cmdSeq           /*!< The command sequence number*/
+    );
+
+    //! Implementation for DUMP_TRACE command handler
+    //! Write the port call trace recorded when FW_PORT_TRACE_RECORDING is enabled to a file in Chrome trace event format
+    void DUMP_TRACE_cmdHandler(const FwOpcodeType opCode, /*!< The opcode*/
+                               const U32 cmdSeq,          /*!< The command sequence number*/
+                               const Fw::CmdStringArg& file /*!< The file to write*/
+    );
+
+    //! Implementation for TRACE_ENABLE command handler
+    //! Start or stop recording port calls when FW_PORT_TRACE_RECORDING is enabled, recording is off at startup
+    void TRACE_ENABLE_cmdHandler(const FwOpcodeType opCode, /*!< The opcode*/
+                                 const U32 cmdSeq,          /*!< The command sequence number*/
+                                 Fw::Enabled enable         /*!< Whether port calls are recorded*/
+    );
+
+#if FW_PORT_TRACE_RECORDING == 1
+    //! Write the records of every trace ring to an open file
+    //! \return status of the file writes
+    Os::File::Status writeTrace(Os::File& file, /*!< The open file*/
+                                U32& records    /*!< (output) The number of records written*/
+    );
+
+    //! Write a string to an open file
+    //! \return status of the file write
+    static Os::File::Status writeString(Os::File& file, /*!< The open file*/
+                                        const char* string /*!< The string to write*/
+    );
+
+    Fw::PortTrace::Record m_traceRecords[FW_PORT_TRACE_RING_SIZE];  //!< Copy of the trace ring being written
+#endif
+
+#if FW_PROFILING == 1
+    //! Name of a profiled component for events
+    //!
+    static void componentName(Fw::ActiveComponentBase& component, /*!< The component*/
+                              Fw::LogStringArg& name              /*!< (output) The component name*/
+    );
+
+    Fw::ActiveComponentBase* m_slots[ProfilerCounts::SIZE];  //!< Component reported in each slot
+    U32 m_prevDispatches[ProfilerCounts::SIZE];              //!< Dispatch count at the previous run
+    U64 m_prevHandlerTotal[ProfilerCounts::SIZE];            //!< Total handler time at the previous run
+    U64 m_prevLatencyTotal[ProfilerCounts::SIZE];            //!< Total queue latency at the previous run
+#endif
+};
+
+}  // end namespace Svc
+
+#endif
@@ -0,0 +1,34 @@
+// ----------------------------------------------------------------------
+// TestMain.cpp
+// ----------------------------------------------------------------------
+
+#include "ProfilerTester.hpp"
+
+#if FW_PROFILING == 1
+TEST(Nominal, Profile) {
+    Svc::ProfilerTester tester;
+    tester.test_profile();
+}
+#else
+TEST(OffNominal, Disabled) {
+    Svc::ProfilerTester tester;
+    tester.test_disabled();
+}
+#endif
+
+#if FW_PORT_TRACE_RECORDING == 1
+TEST(Nominal, Trace) {
+    Svc::ProfilerTester tester;
+    tester.test_trace();
+}
+#else
+TEST(OffNominal, TraceDisabled) {
+    Svc::ProfilerTester tester;
+    tester.test_trace_disabled();
+}
+#endif
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,271 @@
+// ======================================================================
+// \title  Profiler/test/ut/ProfilerTester.cpp
+// \brief  cpp file for Profiler test harness implementation class
+//
+// \copyright
+// Copyright 2009-2024, by the California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#include "ProfilerTester.hpp"
+#include <Fw/Types/Assert.hpp>
+#include <Os/File.hpp>
+#include <cstring>
+#include <thread>
+
+#define INSTANCE 0
+#define MAX_HISTORY_SIZE 100
+
+namespace Svc {
+
+#if FW_PROFILING == 1
+//! Minimal active component dispatching messages carrying a single I32
+class ProfiledComponent : public Fw::ActiveComponentBase {
+  public:
+    static const I32 MESSAGE = ACTIVE_COMPONENT_EXIT + 1;
+
+    ProfiledComponent() : Fw::ActiveComponentBase("Profiled"), m_received(0) {}
+
+    void init() {
+        Fw::ActiveComponentBase::init(INSTANCE);
+        Os::Queue::QueueStatus status = this->createQueue(10, sizeof(I32));
+        FW_ASSERT(status == Os::Queue::QUEUE_OK, status);
+    }
+
+    void send() {
+        MessageBuffer buffer;
+        Fw::SerializeStatus status = buffer.serialize(MESSAGE);
+        FW_ASSERT(status == Fw::FW_SERIALIZE_OK, status);
+        Os::Queue::QueueStatus sendStatus = this->m_queue.send(buffer, 0, Os::Queue::QUEUE_NONBLOCKING);
+        FW_ASSERT(sendStatus == Os::Queue::QUEUE_OK, sendStatus);
+    }
+
+    U32 m_received;
+
+  PROTECTED:
+    MsgDispatchStatus doDispatch() {
+        MessageBuffer buffer;
+        NATIVE_INT_TYPE priority = 0;
+        I32 message = 0;
+        Os::Queue::QueueStatus status = this->m_queue.receive(buffer, priority, Os::Queue::QUEUE_BLOCKING);
+        FW_ASSERT(status == Os::Queue::QUEUE_OK, status);
+        Fw::SerializeStatus deserStatus = buffer.deserialize(message);
+        FW_ASSERT(deserStatus == Fw::FW_SERIALIZE_OK, deserStatus);
+        if (message == ACTIVE_COMPONENT_EXIT) {
+            return MSG_DISPATCH_EXIT;
+        }
+        this->m_received++;
+        return MSG_DISPATCH_OK;
+    }
+
+  private:
+    class MessageBuffer : public Fw::SerializeBufferBase {
+      public:
+        NATIVE_UINT_TYPE getBuffCapacity() const { return sizeof(m_buff); }
+        U8* getBuffAddr() { return m_buff; }
+        const U8* getBuffAddr() const { return m_buff; }
+
+      private:
+        U8 m_buff[sizeof(I32)];
+    };
+};
+#endif
+
+// ----------------------------------------------------------------------
+// Construction and destruction
+// ----------------------------------------------------------------------
+
+ProfilerTester ::ProfilerTester() : ProfilerGTestBase("Tester", MAX_HISTORY_SIZE), component("Profiler") {
+    this->initComponents();
+    this->connectPorts();
+}
+
+ProfilerTester ::~ProfilerTester() {}
+
+// ----------------------------------------------------------------------
+// Tests
+// ----------------------------------------------------------------------
+
+#if FW_PROFILING == 1
+void ProfilerTester ::test_profile() {
+    ProfiledComponent profiled;
+    profiled.init();
+
+    // First run assigns the slot, nothing dispatched yet
+    this->invoke_to_run(0, 0);
+    ASSERT_EVENTS_PROFILER_SLOT_SIZE(1);
+    ASSERT_EVENTS_PROFILER_SLOT(0, 0, "Profiled");
+    ASSERT_TLM_DISPATCHES_SIZE(1);
+    ASSERT_EQ(this->tlmHistory_DISPATCHES->at(0).arg[0], 0u);
+    ASSERT_EQ(this->tlmHistory_DISPATCHES->at(0).arg[1], 0u);
+
+    // Queue messages before starting such that they wait on the queue
+    profiled.send();
+    profiled.send();
+    profiled.send();
+    Os::Task::delay(10);
+    profiled.start();
+    profiled.exit();
+    ASSERT_EQ(profiled.join(nullptr), Os::Task::TASK_OK);
+    ASSERT_EQ(profiled.m_received, 3u);
+
+    this->clearHistory();
+    this->invoke_to_run(0, 0);
+    ASSERT_EVENTS_PROFILER_SLOT_SIZE(0);
+    ASSERT_TLM_DISPATCHES_SIZE(1);
+    ASSERT_EQ(this->tlmHistory_DISPATCHES->at(0).arg[0], 3u);
+    ASSERT_TLM_HANDLER_TIME_SIZE(1);
+    ASSERT_TLM_QUEUE_LATENCY_SIZE(1);
+    ASSERT_GE(this->tlmHistory_QUEUE_LATENCY->at(0).arg[0], 10000u);
+
+    // Interval telemetry restarts each run, the dump reports totals
+    this->clearHistory();
+    this->invoke_to_run(0, 0);
+    ASSERT_EQ(this->tlmHistory_DISPATCHES->at(0).arg[0], 0u);
+    this->sendCmd_DUMP(0, 0);
+    ASSERT_CMD_RESPONSE_SIZE(1);
+    ASSERT_CMD_RESPONSE(0, ProfilerComponentBase::OPCODE_DUMP, 0, Fw::CmdResponse::OK);
+    ASSERT_EVENTS_COMPONENT_PROFILE_SIZE(1);
+    ASSERT_EQ(this->eventHistory_COMPONENT_PROFILE->at(0).dispatches, 3u);
+    ASSERT_GE(this->eventHistory_COMPONENT_PROFILE->at(0).latencyMax, 10000u);
+    ASSERT_LE(this->eventHistory_COMPONENT_PROFILE->at(0).handlerMean,
+              this->eventHistory_COMPONENT_PROFILE->at(0).handlerMax);
+#if FW_PORT_TRACING == 1 && FW_PORT_TRACE_RECORDING == 1
+    // The run port of the component was called three times
+    ASSERT_GE(this->eventHistory_PORT_CALLS->size(), 1u);
+    bool found = false;
+    for (U32 i = 0; i < this->eventHistory_PORT_CALLS->size(); i++) {
+#if FW_OBJECT_NAMES == 1
+        if (strcmp(this->eventHistory_PORT_CALLS->at(i).name.toChar(),
+                   this->component.get_run_InputPort(0)->getObjName()) == 0) {
+            ASSERT_EQ(this->eventHistory_PORT_CALLS->at(i).calls, 3u);
+            found = true;
+        }
+#else
+        found = found || (this->eventHistory_PORT_CALLS->at(i).calls == 3u);
+#endif
+    }
+    ASSERT_TRUE(found);
+#endif
+}
+#else
+void ProfilerTester ::test_disabled() {
+    this->invoke_to_run(0, 0);
+    ASSERT_TLM_SIZE(0);
+    ASSERT_EVENTS_SIZE(0);
+
+    this->sendCmd_DUMP(0, 0);
+    ASSERT_EVENTS_PROFILING_DISABLED_SIZE(1);
+    ASSERT_CMD_RESPONSE_SIZE(1);
+    ASSERT_CMD_RESPONSE(0, ProfilerComponentBase::OPCODE_DUMP, 0, Fw::CmdResponse::EXECUTION_ERROR);
+}
+#endif
+
+#if FW_PORT_TRACE_RECORDING == 1
+void ProfilerTester ::test_trace() {
+    // Nothing is recorded until recording is enabled
+    this->invoke_to_run(0, 0);
+    Fw::CmdStringArg file("trace.json");
+    this->sendCmd_DUMP_TRACE(0, 0, file);
+    ASSERT_EVENTS_TRACE_WRITTEN_SIZE(1);
+    ASSERT_EQ(this->eventHistory_TRACE_WRITTEN->at(0).records, 0u);
+    this->clearHistory();
+
+    this->sendCmd_TRACE_ENABLE(0, 0, Fw::Enabled::ENABLED);
+    ASSERT_CMD_RESPONSE(0, ProfilerComponentBase::OPCODE_TRACE_ENABLE, 0, Fw::CmdResponse::OK);
+    this->clearHistory();
+
+    // Calls through the run port of the component are recorded on the ring of this thread
+    this->invoke_to_run(0, 0);
+    this->invoke_to_run(0, 0);
+
+    this->sendCmd_DUMP_TRACE(0, 0, file);
+    ASSERT_CMD_RESPONSE_SIZE(1);
+    ASSERT_CMD_RESPONSE(0, ProfilerComponentBase::OPCODE_DUMP_TRACE, 0, Fw::CmdResponse::OK);
+    ASSERT_EVENTS_TRACE_WRITTEN_SIZE(1);
+    ASSERT_GE(this->eventHistory_TRACE_WRITTEN->at(0).records, 2u);
+
+    // Check the file holds trace events
+    Os::File trace;
+    ASSERT_EQ(trace.open("trace.json", Os::File::OPEN_READ), Os::File::OP_OK);
+    char contents[256];
+    FwSignedSizeType size = sizeof(contents) - 1;
+    ASSERT_EQ(trace.read(reinterpret_cast<U8*>(contents), size, Os::File::WaitType::WAIT), Os::File::OP_OK);
+    trace.close();
+    contents[size] = 0;
+    ASSERT_EQ(strncmp(contents, "{\"traceEvents\":[", strlen("{\"traceEvents\":[")), 0);
+    ASSERT_NE(strstr(contents, "\"ph\":\"i\""), nullptr);
+#if FW_OBJECT_NAMES == 1
+    ASSERT_NE(strstr(contents, "Profiler"), nullptr);
+#endif
+
+    // A thread releases its ring when it exits, and the next thread claims it again
+    std::thread first([this]() { this->invoke_to_run(0, 0); });
+    first.join();
+    const U32 rings = Fw::PortTrace::getRingCount();
+    std::thread second([this]() { this->invoke_to_run(0, 0); });
+    second.join();
+    ASSERT_EQ(Fw::PortTrace::getRingCount(), rings);
+
+    // File errors fail the command
+    this->clearHistory();
+    Fw::CmdStringArg badFile("missing/directory/trace.json");
+    this->sendCmd_DUMP_TRACE(0, 0, badFile);
+    ASSERT_EVENTS_TRACE_FILE_ERROR_SIZE(1);
+    ASSERT_CMD_RESPONSE(0, ProfilerComponentBase::OPCODE_DUMP_TRACE, 0, Fw::CmdResponse::EXECUTION_ERROR);
+
+    this->sendCmd_TRACE_ENABLE(0, 0, Fw::Enabled::DISABLED);
+    ASSERT_CMD_RESPONSE(1, ProfilerComponentBase::OPCODE_TRACE_ENABLE, 0, Fw::CmdResponse::OK);
+}
+#else
+void ProfilerTester ::test_trace_disabled() {
+    Fw::CmdStringArg file("trace.json");
+    this->sendCmd_DUMP_TRACE(0, 0, file);
+    ASSERT_EVENTS_TRACING_DISABLED_SIZE(1);
+    ASSERT_CMD_RESPONSE_SIZE(1);
+    ASSERT_CMD_RESPONSE(0, ProfilerComponentBase::OPCODE_DUMP_TRACE, 0, Fw::CmdResponse::EXECUTION_ERROR);
+
+    this->sendCmd_TRACE_ENABLE(0, 0, Fw::Enabled::ENABLED);
+    ASSERT_EVENTS_TRACING_DISABLED_SIZE(2);
+    ASSERT_CMD_RESPONSE(1, ProfilerComponentBase::OPCODE_TRACE_ENABLE, 0, Fw::CmdResponse::EXECUTION_ERROR);
+}
+#endif
+
+// ----------------------------------------------------------------------
+// Helper methods
+// ----------------------------------------------------------------------
+
+void ProfilerTester ::connectPorts() {
+    // run
+    this->connect_to_run(0, this->component.get_run_InputPort(0));
+
+    // CmdDisp
+    this->connect_to_CmdDisp(0, this->component.get_CmdDisp_InputPort(0));
+
+    // CmdStatus
+    this->component.set_CmdStatus_OutputPort(0, this->get_from_CmdStatus(0));
+
+    // CmdReg
+    this->component.set_CmdReg_OutputPort(0, this->get_from_CmdReg(0));
+
+    // Tlm
+    this->component.set_Tlm_OutputPort(0, this->get_from_Tlm(0));
+
+    // Time
+    this->component.set_Time_OutputPort(0, this->get_from_Time(0));
+
+    // Log
+    this->component.set_Log_OutputPort(0, this->get_from_Log(0));
+
+    // LogText
+    this->component.set_LogText_OutputPort(0, this->get_from_LogText(0));
+}
+
+void ProfilerTester ::initComponents() {
+    this->init();
+    this->component.init(INSTANCE);
+}
+
+}  // end namespace Svc
@@ -0,0 +1,84 @@
+// ======================================================================
+// \title  Profiler/test/ut/ProfilerTester.hpp
+// \brief  hpp file for Profiler test harness implementation class
+//
+// \copyright
+// Copyright 2009-2024, by the California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#ifndef PROFILER_TESTER_HPP
+#define PROFILER_TESTER_HPP
+
+#include "ProfilerGTestBase.hpp"
+#include "Svc/Profiler/Profiler.hpp"
+
+namespace Svc {
+
+class ProfilerTester : public ProfilerGTestBase {
+    // ----------------------------------------------------------------------
+    // Construction and destruction
+    // ----------------------------------------------------------------------
+
+  public:
+    //! Construct object ProfilerTester
+    //!
+    ProfilerTester();
+
+    //! Destroy object ProfilerTester
+    //!
+    ~ProfilerTester();
+
+  public:
+    // ----------------------------------------------------------------------
+    // Tests
+    // ----------------------------------------------------------------------
+
+#if FW_PROFILING == 1
+    //! Test the telemetry and dump of a profiled active component
+    //!
+    void test_profile();
+#else
+    //! Test the profiler reports that profiling is compiled out
+    //!
+    void test_disabled();
+#endif
+
+#if FW_PORT_TRACE_RECORDING == 1
+    //! Test writing the port call trace to a file
+    //!
+    void test_trace();
+#else
+    //! Test the profiler reports that port tracing is compiled out
+    //!
+    void test_trace_disabled();
+#endif
+
+  private:
+    // ----------------------------------------------------------------------
+    // Helper methods
+    // ----------------------------------------------------------------------
+
+    //! Connect ports
+    //!
+    void connectPorts();
+
+    //! Initialize components
+    //!
+    void initComponents();
+
+  private:
+    // ----------------------------------------------------------------------
+    // Variables
+    // ----------------------------------------------------------------------
+
+    //! The component under test
+    //!
+    Profiler component;
+};
+
+}  // end namespace Svc
+
+#endif
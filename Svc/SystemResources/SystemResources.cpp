@@ -22,24 +22,30 @@ namespace Svc {
 // ----------------------------------------------------------------------
 
 SystemResources ::SystemResources(const char* const compName)
-    : SystemResourcesComponentBase(compName), m_cpu_count(0), m_enable(true) {
+    : SystemResourcesComponentBase(compName), m_cpu_count(0), m_enable(true), m_thread_enable(false) {
+    static_assert(ThreadCpuUtil::SIZE <= Os::SystemResourcesCfg::MAX_THREADS,
+                  "SystemResourcesThreads exceeds Os::SystemResourcesCfg::MAX_THREADS");
 
     // Structure initializations
     m_mem.used = 0;
     m_mem.total = 0;
+    m_snapshot.cpuCount = 0;
+    m_snapshot.threadCount = 0;
+    m_total_prev.used = 0;
+    m_total_prev.total = 0;
     for (U32 i = 0; i < CPU_COUNT; i++) {
-        m_cpu[i].used = 0;
-        m_cpu[i].total = 0;
         m_cpu_prev[i].used = 0;
         m_cpu_prev[i].total = 0;
     }
+    for (U32 i = 0; i < ThreadCpuUtil::SIZE; i++) {
+        m_thread_prev[i].id = 0;
+        m_thread_prev[i].ticks = 0;
+    }
 
     if (Os::SystemResources::getCpuCount(m_cpu_count) == Os::SystemResources::SYSTEM_RESOURCES_ERROR) {
         m_cpu_count = 0;
     }
 
-    m_cpu_count = (m_cpu_count >= CPU_COUNT) ? CPU_COUNT : m_cpu_count;
-
     m_cpu_tlm_functions[0] = &Svc::SystemResources::tlmWrite_CPU_00;
     m_cpu_tlm_functions[1] = &Svc::SystemResources::tlmWrite_CPU_01;
     m_cpu_tlm_functions[2] = &Svc::SystemResources::tlmWrite_CPU_02;
@@ -97,6 +103,17 @@ void SystemResources ::VERSION_cmdHandler(const FwOpcodeType opCode, const U32 c
     this->cmdResponse_out(opCode, cmdSeq, Fw::CmdResponse::OK);
 }
 
+void SystemResources ::ENABLE_THREAD_CPU_cmdHandler(const FwOpcodeType opCode,
+                                                    const U32 cmdSeq,
+                                                    SystemResourceEnabled enable) {
+    m_thread_enable = (enable == SystemResourceEnabled::ENABLED);
+    // Thread ticks are not sampled while disabled, so forget them and re-announce the slots
+    for (U32 i = 0; i < ThreadCpuUtil::SIZE; i++) {
+        m_thread_prev[i].id = 0;
+    }
+    this->cmdResponse_out(opCode, cmdSeq, Fw::CmdResponse::OK);
+}
+
 F32 SystemResources::compCpuUtil(Os::SystemResources::CpuTicks current, Os::SystemResources::CpuTicks previous) {
     F32 util = 100.0f;
     // Prevent divide by zero on fast-sample
@@ -113,11 +130,12 @@ void SystemResources::Cpu() {
     U32 count = 0;
     F32 cpuAvg = 0;
 
-    for (U32 i = 0; i < m_cpu_count && i < CPU_COUNT; i++) {
-        Os::SystemResources::SystemResourcesStatus status = Os::SystemResources::getCpuTicks(m_cpu[i], i);
-        // Best-effort calculations and telemetry
-        if (status == Os::SystemResources::SYSTEM_RESOURCES_OK) {
-            F32 cpuUtil = compCpuUtil(m_cpu[i], m_cpu_prev[i]);
+    // A single snapshot covers every CPU (and every thread when enabled) for this run
+    Os::SystemResources::SystemResourcesStatus status = Os::SystemResources::getSnapshot(m_snapshot, m_thread_enable);
+    // Best-effort calculations and telemetry
+    if (status == Os::SystemResources::SYSTEM_RESOURCES_OK) {
+        for (U32 i = 0; i < m_snapshot.cpuCount && i < m_cpu_count && i < CPU_COUNT; i++) {
+            F32 cpuUtil = compCpuUtil(m_snapshot.cpu[i], m_cpu_prev[i]);
             cpuAvg += cpuUtil;
 
             // Send telemetry using telemetry output table
@@ -125,15 +143,44 @@ void SystemResources::Cpu() {
             (this->*m_cpu_tlm_functions[i])(cpuUtil, Fw::Time());
 
             // Store cpu used and total
-            m_cpu_prev[i] = m_cpu[i];
+            m_cpu_prev[i] = m_snapshot.cpu[i];
             count++;
         }
+        if (m_thread_enable) {
+            Threads();
+        }
+        m_total_prev = m_snapshot.total;
     }
 
     cpuAvg = (count == 0) ? 0.0f : (cpuAvg / static_cast<F32>(count));
     this->tlmWrite_CPU(cpuAvg);
 }
 
+void SystemResources::Threads() {
+    ThreadCpuUtil utils;
+    // Total ticks are summed across all CPUs, thread utilization is reported against a single CPU
+    const FwSizeType elapsed = (m_snapshot.total.total - m_total_prev.total) / ((m_cpu_count == 0) ? 1 : m_cpu_count);
+
+    for (U32 i = 0; i < ThreadCpuUtil::SIZE; i++) {
+        F32 util = 0.0f;
+        if (i < m_snapshot.threadCount) {
+            const Os::SystemResources::ThreadTicks& thread = m_snapshot.threads[i];
+            if (thread.id != m_thread_prev[i].id) {
+                // New thread in this slot, utilization is available from the next run
+                Fw::LogStringArg name(thread.name);
+                this->log_ACTIVITY_LO_THREAD_CPU_SLOT(i, name, thread.id);
+            } else if (elapsed != 0) {
+                util = (static_cast<F32>(thread.ticks - m_thread_prev[i].ticks) / static_cast<F32>(elapsed)) * 100.0f;
+            }
+            m_thread_prev[i] = thread;
+        } else {
+            m_thread_prev[i].id = 0;
+        }
+        utils[i] = util;
+    }
+    this->tlmWrite_THREAD_CPU(utils);
+}
+
 void SystemResources::Mem() {
     if (Os::SystemResources::getMemUtil(m_mem) == Os::SystemResources::SYSTEM_RESOURCES_OK) {
         this->tlmWrite_MEMORY_TOTAL(m_mem.total / 1024);
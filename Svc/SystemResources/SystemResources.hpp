@@ -73,8 +73,17 @@ class SystemResources : public SystemResourcesComponentBase {
                             const U32 cmdSeq           /*!< The command sequence number*/
     );
 
+    //! Implementation for ENABLE_THREAD_CPU command handler
+    //! A command to enable or disable per-thread CPU telemetry
+    void ENABLE_THREAD_CPU_cmdHandler(
+        const FwOpcodeType opCode,   /*!< The opcode*/
+        const U32 cmdSeq,            /*!< The command sequence number*/
+        SystemResourceEnabled enable /*!< whether or not per-thread CPU telemetry is enabled*/
+    );
+
   private:
     void Cpu();
+    void Threads();
     void Mem();
     void PhysMem();
     void Version();
@@ -84,11 +93,14 @@ class SystemResources : public SystemResourcesComponentBase {
     static const U32 CPU_COUNT = 16; /*!< Maximum number of CPUs to report as telemetry */
 
     cpuTlmFunc m_cpu_tlm_functions[CPU_COUNT];       /*!< Function pointer to specific CPU telemetry */
-    U32 m_cpu_count;                                     /*!< Number of CPUs used by the system */
+    U32 m_cpu_count;                                     /*!< Number of CPUs used by the system, may exceed CPU_COUNT */
     Os::SystemResources::MemUtil m_mem;                  /*!< RAM memory information */
-    Os::SystemResources::CpuTicks m_cpu[CPU_COUNT];      /*!< CPU information for each CPU on the system */
+    Os::SystemResources::Snapshot m_snapshot;            /*!< CPU and thread information read once per run */
     Os::SystemResources::CpuTicks m_cpu_prev[CPU_COUNT]; /*!< Previous iteration CPU information */
+    Os::SystemResources::CpuTicks m_total_prev;          /*!< Previous iteration CPU information summed across CPUs */
+    Os::SystemResources::ThreadTicks m_thread_prev[ThreadCpuUtil::SIZE]; /*!< Previous iteration thread information */
     bool m_enable;                                       /*!< Send telemetry when TRUE.  Don't send when FALSE */
+    bool m_thread_enable;                                /*!< Send per-thread CPU telemetry when TRUE */
 };
 
 }  // end namespace Svc
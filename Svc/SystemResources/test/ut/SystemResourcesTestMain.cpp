@@ -19,6 +19,11 @@ TEST(Nominal, Events) {
     tester.test_version_evr();
 }
 
+TEST(Nominal, ThreadCpu) {
+    Svc::SystemResourcesTester tester;
+    tester.test_thread_cpu();
+}
+
 int main(int argc, char **argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
@@ -138,6 +138,41 @@ void SystemResourcesTester ::test_version_evr() {
     ASSERT_EVENTS_PROJECT_VERSION(0, FRAMEWORK_VERSION);
 }
 
+void SystemResourcesTester ::test_thread_cpu() {
+    Os::SystemResources::Snapshot snapshot;
+    // Disabled by default
+    this->invoke_to_run(0, 0);
+    ASSERT_TLM_THREAD_CPU_SIZE(0);
+
+    this->sendCmd_ENABLE_THREAD_CPU(0, 0, SystemResourceEnabled::ENABLED);
+    ASSERT_CMD_RESPONSE_SIZE(1);
+    ASSERT_CMD_RESPONSE(0, SystemResourcesComponentBase::OPCODE_ENABLE_THREAD_CPU, 0, Fw::CmdResponse::OK);
+    if (Os::SystemResources::getSnapshot(snapshot, true) == Os::SystemResources::SYSTEM_RESOURCES_OK) {
+        const U32 threads = (snapshot.threadCount < ThreadCpuUtil::SIZE) ? snapshot.threadCount : ThreadCpuUtil::SIZE;
+        this->clearHistory();
+        this->invoke_to_run(0, 0);
+        ASSERT_TLM_THREAD_CPU_SIZE(1);
+        // Each slot is announced once, the test runs single-threaded so slot 0 is this thread
+        ASSERT_EVENTS_THREAD_CPU_SLOT_SIZE(threads);
+        if (threads > 0) {
+            ASSERT_EQ(this->eventHistory_THREAD_CPU_SLOT->at(0).slot, 0u);
+            ASSERT_EQ(this->eventHistory_THREAD_CPU_SLOT->at(0).threadId, snapshot.threads[0].id);
+        }
+        this->clearHistory();
+        this->invoke_to_run(0, 0);
+        ASSERT_TLM_THREAD_CPU_SIZE(1);
+        ASSERT_EVENTS_THREAD_CPU_SLOT_SIZE(0);
+        for (U32 i = 0; i < ThreadCpuUtil::SIZE; i++) {
+            ASSERT_GE(this->tlmHistory_THREAD_CPU->at(0).arg[i], 0.0f);
+        }
+    }
+
+    this->sendCmd_ENABLE_THREAD_CPU(0, 0, SystemResourceEnabled::DISABLED);
+    this->clearHistory();
+    this->invoke_to_run(0, 0);
+    ASSERT_TLM_THREAD_CPU_SIZE(0);
+}
+
 // ----------------------------------------------------------------------
 // Helper methods
 // ----------------------------------------------------------------------
@@ -49,6 +49,10 @@ class SystemResourcesTester : public SystemResourcesGTestBase {
     //!
     void test_version_evr();
 
+    //! Test the per-thread CPU telemetry
+    //!
+    void test_thread_cpu();
+
   private:
     // ----------------------------------------------------------------------
     // Helper methods
@@ -0,0 +1,206 @@
+// ======================================================================
+// \title  TimerWheel.cpp
+// \brief  cpp file for TimerWheel component implementation class
+//
+// \copyright
+// Copyright 2009-2024, by the California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#include <Fw/Types/Assert.hpp>
+#include <Svc/TimerWheel/TimerWheel.hpp>
+
+namespace Svc {
+
+// ----------------------------------------------------------------------
+// Construction, initialization, and destruction
+// ----------------------------------------------------------------------
+
+TimerWheel ::TimerWheel(const char* const compName)
+    : TimerWheelComponentBase(compName), m_tickUsec(0), m_nextTick(0), m_dueCount(0) {
+    for (U32 i = 0; i < CLIENTS; i++) {
+        this->m_timers[i].tick = 0;
+        this->m_timers[i].next = nullptr;
+        this->m_timers[i].link = nullptr;
+        this->m_timers[i].armed = false;
+    }
+    for (U32 level = 0; level < LEVELS; level++) {
+        for (U32 slot = 0; slot < SLOTS; slot++) {
+            this->m_slots[level][slot] = nullptr;
+        }
+    }
+}
+
+TimerWheel ::~TimerWheel() {}
+
+void TimerWheel ::configure(const U32 tickUsec) {
+    FW_ASSERT(tickUsec > 0);
+    this->m_mutex.lock();
+    this->m_tickUsec = tickUsec;
+    this->m_mutex.unLock();
+}
+
+// ----------------------------------------------------------------------
+// Handler implementations for user-defined typed input ports
+// ----------------------------------------------------------------------
+
+void TimerWheel ::CycleIn_handler(const NATIVE_INT_TYPE portNum, Svc::TimerVal& cycleStart) {
+    FW_ASSERT(this->m_tickUsec > 0);
+    const U64 now = toUsec(this->getTime()) / this->m_tickUsec;
+
+    NATIVE_INT_TYPE due[CLIENTS];
+    Fw::Time deadlines[CLIENTS];
+    this->m_mutex.lock();
+    this->m_dueCount = 0;
+    // Processing a tick is cheap, but a clock set forward or back is better handled by placing the timers again
+    if ((now + 1 < this->m_nextTick) || ((now >= this->m_nextTick) && (now - this->m_nextTick >= SLOTS))) {
+        this->rebuild(now);
+    } else {
+        while (this->m_nextTick <= now) {
+            this->step();
+        }
+    }
+    const U32 dueCount = this->m_dueCount;
+    for (U32 i = 0; i < dueCount; i++) {
+        due[i] = this->m_due[i];
+        deadlines[i] = this->m_timers[due[i]].deadline;
+    }
+    this->m_mutex.unLock();
+
+    // Clients may arm their timer again from the call
+    for (U32 i = 0; i < dueCount; i++) {
+        if (this->isConnected_timerExpired_OutputPort(due[i])) {
+            this->timerExpired_out(due[i], deadlines[i]);
+        }
+    }
+}
+
+void TimerWheel ::timerSet_handler(const NATIVE_INT_TYPE portNum, const Fw::Time& deadline) {
+    FW_ASSERT(portNum >= 0 && portNum < CLIENTS, portNum);
+    this->m_mutex.lock();
+    FW_ASSERT(this->m_tickUsec > 0);
+    Timer& timer = this->m_timers[portNum];
+    if (timer.armed) {
+        this->remove(timer);
+    }
+    timer.deadline = deadline;
+    // Round up, such that the timer never expires before the deadline
+    timer.tick = (toUsec(deadline) + this->m_tickUsec - 1) / this->m_tickUsec;
+    this->insert(timer);
+    this->m_mutex.unLock();
+}
+
+void TimerWheel ::timerCancel_handler(const NATIVE_INT_TYPE portNum) {
+    FW_ASSERT(portNum >= 0 && portNum < CLIENTS, portNum);
+    this->m_mutex.lock();
+    Timer& timer = this->m_timers[portNum];
+    if (timer.armed) {
+        this->remove(timer);
+    }
+    this->m_mutex.unLock();
+}
+
+// ----------------------------------------------------------------------
+// Helper methods
+// ----------------------------------------------------------------------
+
+U64 TimerWheel ::toUsec(const Fw::Time& time) {
+    return static_cast<U64>(time.getSeconds()) * 1000000 + time.getUSeconds();
+}
+
+void TimerWheel ::insert(Timer& timer) {
+    FW_ASSERT(!timer.armed);
+    U32 level = 0;
+    U64 slotTick = timer.tick;
+    if (timer.tick < this->m_nextTick) {
+        // Already due, processed with the next tick
+        slotTick = this->m_nextTick;
+    } else {
+        U64 delta = timer.tick - this->m_nextTick;
+        // Deadlines beyond the span wait in the farthest slot, and are placed again when it is cascaded
+        if (delta >= (static_cast<U64>(1) << SPAN_BITS)) {
+            delta = (static_cast<U64>(1) << SPAN_BITS) - 1;
+            slotTick = this->m_nextTick + delta;
+        }
+        while (delta >= (static_cast<U64>(1) << (SLOT_BITS * (level + 1)))) {
+            level++;
+        }
+    }
+    const U32 slot = static_cast<U32>(slotTick >> (SLOT_BITS * level)) & (SLOTS - 1);
+    Timer*& head = this->m_slots[level][slot];
+    timer.next = head;
+    if (head != nullptr) {
+        head->link = &timer.next;
+    }
+    timer.link = &head;
+    head = &timer;
+    timer.armed = true;
+}
+
+void TimerWheel ::remove(Timer& timer) {
+    FW_ASSERT(timer.armed);
+    *timer.link = timer.next;
+    if (timer.next != nullptr) {
+        timer.next->link = timer.link;
+    }
+    timer.next = nullptr;
+    timer.link = nullptr;
+    timer.armed = false;
+}
+
+U32 TimerWheel ::cascade(const U32 level) {
+    FW_ASSERT(level > 0 && level < LEVELS, level);
+    const U32 slot = static_cast<U32>(this->m_nextTick >> (SLOT_BITS * level)) & (SLOTS - 1);
+    Timer* timer = this->m_slots[level][slot];
+    this->m_slots[level][slot] = nullptr;
+    while (timer != nullptr) {
+        Timer* next = timer->next;
+        timer->armed = false;
+        this->insert(*timer);
+        timer = next;
+    }
+    return slot;
+}
+
+void TimerWheel ::step() {
+    const U32 slot = static_cast<U32>(this->m_nextTick) & (SLOTS - 1);
+    // Once the lowest level wrapped, bring down the timers of the next slot of each level that wrapped
+    if (slot == 0) {
+        for (U32 level = 1; (level < LEVELS) && (this->cascade(level) == 0); level++) {
+        }
+    }
+    while (this->m_slots[0][slot] != nullptr) {
+        this->expire(*this->m_slots[0][slot]);
+    }
+    this->m_nextTick++;
+}
+
+void TimerWheel ::rebuild(const U64 now) {
+    bool wasArmed[CLIENTS];
+    for (U32 i = 0; i < CLIENTS; i++) {
+        wasArmed[i] = this->m_timers[i].armed;
+        if (wasArmed[i]) {
+            this->remove(this->m_timers[i]);
+        }
+    }
+    this->m_nextTick = now + 1;
+    for (U32 i = 0; i < CLIENTS; i++) {
+        if (wasArmed[i]) {
+            if (this->m_timers[i].tick <= now) {
+                this->m_due[this->m_dueCount++] = static_cast<NATIVE_INT_TYPE>(i);
+            } else {
+                this->insert(this->m_timers[i]);
+            }
+        }
+    }
+}
+
+void TimerWheel ::expire(Timer& timer) {
+    FW_ASSERT(this->m_dueCount < CLIENTS, this->m_dueCount);
+    this->remove(timer);
+    this->m_due[this->m_dueCount++] = static_cast<NATIVE_INT_TYPE>(&timer - this->m_timers);
+}
+
+}  // end namespace Svc
@@ -0,0 +1,120 @@
+// ======================================================================
+// \title  TimerWheel.hpp
+// \brief  hpp file for TimerWheel component implementation class
+//
+// \copyright
+// Copyright 2009-2024, by the California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#ifndef Svc_TimerWheel_HPP
+#define Svc_TimerWheel_HPP
+
+#include <Os/Mutex.hpp>
+#include "Svc/TimerWheel/TimerWheelComponentAc.hpp"
+
+namespace Svc {
+
+//! The TimerWheel keeps one deadline per client and calls the client only when its deadline arrives, such that
+//! clients waiting on time need no rate group tick. Each cycle advances the wheel to the current time in ticks of
+//! the configured period, doing constant work per tick whatever the number of armed timers. Deadlines are rounded up
+//! to the next tick, so a client is never woken early and at most one tick late.
+class TimerWheel : public TimerWheelComponentBase {
+  public:
+    enum {
+        SLOT_BITS = 6,                     //!< Bits of the tick selecting the slot of a level
+        SLOTS = 1 << SLOT_BITS,            //!< Slots of each level
+        LEVELS = 4,                        //!< Levels of the wheel, each slot of a level spanning a revolution of the one below
+        SPAN_BITS = SLOT_BITS * LEVELS,    //!< Ticks ahead the wheel holds deadlines at their slot
+        CLIENTS = NUM_TIMERSET_INPUT_PORTS //!< Timers of the wheel, one per client
+    };
+
+    // ----------------------------------------------------------------------
+    // Construction, initialization, and destruction
+    // ----------------------------------------------------------------------
+
+    //! Construct object TimerWheel
+    //!
+    TimerWheel(const char* const compName /*!< The component name*/
+    );
+
+    //! Destroy object TimerWheel
+    //!
+    ~TimerWheel();
+
+    //! Set the tick of the wheel, which must be called before the first cycle
+    void configure(const U32 tickUsec  //!< Period of the wheel in microseconds, usually the period of CycleIn
+    );
+
+  PRIVATE:
+    //! A timer of a client, linked in the slot of its deadline when armed
+    struct Timer {
+        U64 tick;           //!< Tick of the deadline
+        Fw::Time deadline;  //!< Deadline passed back to the client
+        Timer* next;        //!< Next timer of the slot
+        Timer** link;       //!< Pointer to this timer, in the slot or the previous timer
+        bool armed;         //!< Whether the timer is linked in a slot
+    };
+
+    // ----------------------------------------------------------------------
+    // Handler implementations for user-defined typed input ports
+    // ----------------------------------------------------------------------
+
+    //! Handler implementation for CycleIn
+    //!
+    void CycleIn_handler(const NATIVE_INT_TYPE portNum, /*!< The port number*/
+                         Svc::TimerVal& cycleStart     /*!< Cycle start timer value*/
+    );
+
+    //! Handler implementation for timerSet
+    //!
+    void timerSet_handler(const NATIVE_INT_TYPE portNum, /*!< The port number*/
+                          const Fw::Time& deadline      /*!< Time at which the client is woken*/
+    );
+
+    //! Handler implementation for timerCancel
+    //!
+    void timerCancel_handler(const NATIVE_INT_TYPE portNum /*!< The port number*/
+    );
+
+    // ----------------------------------------------------------------------
+    // Helper methods
+    // ----------------------------------------------------------------------
+
+    //! \return the microseconds of a time
+    static U64 toUsec(const Fw::Time& time);
+
+    //! Link a timer in the slot of its tick, relative to the next tick processed
+    void insert(Timer& timer);
+
+    //! Unlink a timer from its slot
+    void remove(Timer& timer);
+
+    //! Move the timers of a slot of an upper level to the levels below
+    //! \return the index of the slot
+    U32 cascade(const U32 level);
+
+    //! Process the next tick, moving its timers to the due list
+    void step();
+
+    //! Relink every armed timer relative to a new current tick, moving those already due to the due list. Used when
+    //! the clock jumped, instead of processing each tick skipped.
+    void rebuild(const U64 now);
+
+    //! Unlink a timer and add its client to the due list
+    void expire(Timer& timer);
+
+    Os::Mutex m_mutex;                     //!< Protects the wheel from clients arming timers during cycles
+    U32 m_tickUsec;                        //!< Period of a tick in microseconds
+    U64 m_nextTick;                        //!< Next tick to process
+    Timer m_timers[CLIENTS];               //!< Timer of each client
+    Timer* m_slots[LEVELS][SLOTS];         //!< Timers linked in each slot
+    NATIVE_INT_TYPE m_due[CLIENTS];        //!< Clients to wake once the cycle released the mutex
+    U32 m_dueCount;                        //!< Number of clients to wake
+};
+
+}  // end namespace Svc
+
+#endif
@@ -0,0 +1,25 @@
+// ----------------------------------------------------------------------
+// TestMain.cpp
+// ----------------------------------------------------------------------
+
+#include "TimerWheelTester.hpp"
+
+TEST(Nominal, Expire) {
+    Svc::TimerWheelTester tester;
+    tester.test_expire();
+}
+
+TEST(Nominal, Cancel) {
+    Svc::TimerWheelTester tester;
+    tester.test_cancel();
+}
+
+TEST(OffNominal, ClockJump) {
+    Svc::TimerWheelTester tester;
+    tester.test_clock_jump();
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
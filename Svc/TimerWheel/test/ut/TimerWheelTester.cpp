@@ -0,0 +1,204 @@
+// ======================================================================
+// \title  TimerWheel/test/ut/TimerWheelTester.cpp
+// \brief  cpp file for TimerWheel test harness implementation class
+//
+// \copyright
+// Copyright 2009-2024, by the California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#include "TimerWheelTester.hpp"
+
+#define INSTANCE 0
+#define MAX_HISTORY_SIZE 100
+
+namespace Svc {
+
+//! Tick of the wheel in microseconds
+static const U32 TICK_USEC = 1000;
+
+//! Ticks covered by the wheel, beyond which deadlines wait in the farthest slot
+static const U64 SPAN_TICKS = static_cast<U64>(1) << TimerWheel::SPAN_BITS;
+
+// ----------------------------------------------------------------------
+// Construction and destruction
+// ----------------------------------------------------------------------
+
+TimerWheelTester ::TimerWheelTester()
+    : TimerWheelGTestBase("Tester", MAX_HISTORY_SIZE), component("TimerWheel"), m_nowUsec(0), m_wokenCount(0) {
+    this->initComponents();
+    this->connectPorts();
+    this->component.configure(TICK_USEC);
+    for (U32 i = 0; i < TimerWheel::CLIENTS; i++) {
+        this->m_deadlines[i] = 0;
+    }
+}
+
+TimerWheelTester ::~TimerWheelTester() {}
+
+// ----------------------------------------------------------------------
+// Tests
+// ----------------------------------------------------------------------
+
+void TimerWheelTester ::test_expire() {
+    this->cycle(0);
+    ASSERT_from_timerExpired_SIZE(0);
+
+    // A deadline between ticks is rounded up
+    this->set(0, 5500);
+    this->cycle(5000);
+    ASSERT_from_timerExpired_SIZE(0);
+    this->cycle(6000);
+    ASSERT_from_timerExpired_SIZE(1);
+    ASSERT_from_timerExpired(0, Fw::Time(0, 5500));
+    this->m_deadlines[0] = 0;
+
+    // Deadlines on each level of the wheel, on the same slots, and beyond the span of the wheel
+    this->set(0, this->m_nowUsec + 10 * TICK_USEC);
+    this->set(1, this->m_nowUsec + 10 * TICK_USEC);
+    this->set(2, this->m_nowUsec + 1000 * TICK_USEC + 1);
+    this->set(3, this->m_nowUsec + 100000 * TICK_USEC + 7);
+    this->set(4, this->m_nowUsec + 300000 * TICK_USEC);
+    this->set(5, this->m_nowUsec + (SPAN_TICKS + 5000) * TICK_USEC);
+    // Advance less than a revolution of the lowest level per cycle, such that the wheel processes every tick
+    this->runUntil(this->m_nowUsec + (SPAN_TICKS + 6000) * TICK_USEC, 63 * TICK_USEC);
+    for (U32 i = 0; i < TimerWheel::CLIENTS; i++) {
+        ASSERT_EQ(this->m_deadlines[i], 0u) << "client " << i;
+    }
+}
+
+void TimerWheelTester ::test_cancel() {
+    this->cycle(1000000);
+
+    // Cancelled timers do not expire
+    this->set(0, this->m_nowUsec + 5 * TICK_USEC);
+    this->set(1, this->m_nowUsec + 5000 * TICK_USEC);
+    this->invoke_to_timerCancel(0);
+    this->invoke_to_timerCancel(1);
+    this->m_deadlines[0] = 0;
+    this->m_deadlines[1] = 0;
+    // Cancelling a disarmed timer does nothing
+    this->invoke_to_timerCancel(2);
+    this->runUntil(this->m_nowUsec + 6000 * TICK_USEC, 10 * TICK_USEC);
+    ASSERT_from_timerExpired_SIZE(0);
+
+    // Arming again replaces the deadline, earlier or later
+    this->set(0, this->m_nowUsec + 100 * TICK_USEC);
+    this->set(0, this->m_nowUsec + 20 * TICK_USEC);
+    this->set(1, this->m_nowUsec + 20 * TICK_USEC);
+    this->set(1, this->m_nowUsec + 3000 * TICK_USEC);
+    this->runUntil(this->m_nowUsec + 4000 * TICK_USEC, 10 * TICK_USEC);
+    ASSERT_EQ(this->m_deadlines[0], 0u);
+    ASSERT_EQ(this->m_deadlines[1], 0u);
+
+    // A deadline already passed expires with the next tick
+    this->set(2, this->m_nowUsec - 50 * TICK_USEC);
+    this->cycle(this->m_nowUsec + TICK_USEC);
+    ASSERT_from_timerExpired_SIZE(1);
+    ASSERT_from_timerExpired(0, Fw::Time(static_cast<U32>(this->m_deadlines[2] / 1000000),
+                                         static_cast<U32>(this->m_deadlines[2] % 1000000)));
+}
+
+void TimerWheelTester ::test_clock_jump() {
+    this->cycle(1000000);
+    this->set(0, 2000000);
+    this->set(1, 11000000);
+    this->set(2, 100000000);
+
+    // Setting the clock forward wakes only the clients whose deadline passed
+    this->runUntil(6000000, 5000000);
+    ASSERT_EQ(this->m_deadlines[0], 0u);
+    ASSERT_NE(this->m_deadlines[1], 0u);
+
+    // Setting the clock back delays the deadlines, which are still woken once reached
+    this->runUntil(3000000, 0);
+    ASSERT_from_timerExpired_SIZE(0);
+    this->runUntil(12000000, 50 * TICK_USEC);
+    ASSERT_EQ(this->m_deadlines[1], 0u);
+    ASSERT_NE(this->m_deadlines[2], 0u);
+    this->runUntil(100000000, 1000000);
+    ASSERT_EQ(this->m_deadlines[2], 0u);
+}
+
+// ----------------------------------------------------------------------
+// Handlers for typed from ports
+// ----------------------------------------------------------------------
+
+void TimerWheelTester ::from_timerExpired_handler(const NATIVE_INT_TYPE portNum, const Fw::Time& deadline) {
+    ASSERT_LT(this->m_wokenCount, static_cast<U32>(TimerWheel::CLIENTS));
+    this->m_woken[this->m_wokenCount++] = portNum;
+    this->pushFromPortEntry_timerExpired(deadline);
+}
+
+// ----------------------------------------------------------------------
+// Helper methods
+// ----------------------------------------------------------------------
+
+void TimerWheelTester ::cycle(const U64 usec) {
+    this->clearFromPortHistory();
+    this->m_wokenCount = 0;
+    this->m_nowUsec = usec;
+    this->setTestTime(Fw::Time(static_cast<U32>(usec / 1000000), static_cast<U32>(usec % 1000000)));
+    Svc::TimerVal cycleStart;
+    this->invoke_to_CycleIn(0, cycleStart);
+}
+
+void TimerWheelTester ::runUntil(const U64 usec, const U32 periodUsec) {
+    // A period of 0 runs a single cycle at the time, such as to set the clock back
+    U64 now = (periodUsec == 0) ? usec : this->m_nowUsec + periodUsec;
+    while (true) {
+        this->cycle(now);
+        // Each client woken has a deadline passed since the previous cycle
+        for (U32 woken = 0; woken < this->m_wokenCount; woken++) {
+            const NATIVE_INT_TYPE client = this->m_woken[woken];
+            const U64 deadline = this->m_deadlines[client];
+            ASSERT_NE(deadline, 0u) << "client " << client;
+            ASSERT_LE(deadline, now) << "client " << client;
+            this->m_deadlines[client] = 0;
+        }
+        // Each client not woken has a deadline still ahead, in ticks
+        for (U32 client = 0; client < TimerWheel::CLIENTS; client++) {
+            const U64 deadline = this->m_deadlines[client];
+            if (deadline != 0) {
+                ASSERT_GT((deadline + TICK_USEC - 1) / TICK_USEC, now / TICK_USEC) << "client " << client;
+            }
+        }
+        if (now >= usec) {
+            break;
+        }
+        now = ((usec - now) < periodUsec) ? usec : now + periodUsec;
+    }
+}
+
+void TimerWheelTester ::set(const NATIVE_INT_TYPE client, const U64 usec) {
+    this->m_deadlines[client] = usec;
+    this->invoke_to_timerSet(client, Fw::Time(static_cast<U32>(usec / 1000000), static_cast<U32>(usec % 1000000)));
+}
+
+void TimerWheelTester ::connectPorts() {
+    // CycleIn
+    this->connect_to_CycleIn(0, this->component.get_CycleIn_InputPort(0));
+
+    for (NATIVE_INT_TYPE i = 0; i < TimerWheel::CLIENTS; i++) {
+        // timerSet
+        this->connect_to_timerSet(i, this->component.get_timerSet_InputPort(i));
+
+        // timerCancel
+        this->connect_to_timerCancel(i, this->component.get_timerCancel_InputPort(i));
+
+        // timerExpired
+        this->component.set_timerExpired_OutputPort(i, this->get_from_timerExpired(i));
+    }
+
+    // timeCaller
+    this->component.set_timeCaller_OutputPort(0, this->get_from_timeCaller(0));
+}
+
+void TimerWheelTester ::initComponents() {
+    this->init();
+    this->component.init(INSTANCE);
+}
+
+}  // end namespace Svc
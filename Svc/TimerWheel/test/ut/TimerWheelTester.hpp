@@ -0,0 +1,117 @@
+// ======================================================================
+// \title  TimerWheel/test/ut/TimerWheelTester.hpp
+// \brief  hpp file for TimerWheel test harness implementation class
+//
+// \copyright
+// Copyright 2009-2024, by the California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#ifndef TIMER_WHEEL_TESTER_HPP
+#define TIMER_WHEEL_TESTER_HPP
+
+#include "TimerWheelGTestBase.hpp"
+#include "Svc/TimerWheel/TimerWheel.hpp"
+
+namespace Svc {
+
+class TimerWheelTester : public TimerWheelGTestBase {
+    // ----------------------------------------------------------------------
+    // Construction and destruction
+    // ----------------------------------------------------------------------
+
+  public:
+    //! Construct object TimerWheelTester
+    //!
+    TimerWheelTester();
+
+    //! Destroy object TimerWheelTester
+    //!
+    ~TimerWheelTester();
+
+  public:
+    // ----------------------------------------------------------------------
+    // Tests
+    // ----------------------------------------------------------------------
+
+    //! Test timers expire on the first cycle at or after their deadline, on every level of the wheel
+    //!
+    void test_expire();
+
+    //! Test cancelling and arming timers again
+    //!
+    void test_cancel();
+
+    //! Test timers across the clock being set forward and back
+    //!
+    void test_clock_jump();
+
+  private:
+    // ----------------------------------------------------------------------
+    // Handlers for typed from ports
+    // ----------------------------------------------------------------------
+
+    //! Handler for from_timerExpired
+    //!
+    void from_timerExpired_handler(const NATIVE_INT_TYPE portNum, /*!< The port number*/
+                                   const Fw::Time& deadline      /*!< The deadline that arrived*/
+    );
+
+  private:
+    // ----------------------------------------------------------------------
+    // Helper methods
+    // ----------------------------------------------------------------------
+
+    //! Set the time and run a cycle
+    //!
+    void cycle(const U64 usec /*!< The time in microseconds*/
+    );
+
+    //! Run cycles of the given period up to a time, checking each client is woken on the first cycle at or after its
+    //! deadline
+    //!
+    void runUntil(const U64 usec,    /*!< The time of the last cycle in microseconds*/
+                  const U32 periodUsec /*!< The time between cycles in microseconds*/
+    );
+
+    //! Arm the timer of a client
+    //!
+    void set(const NATIVE_INT_TYPE client, /*!< The client*/
+             const U64 usec                /*!< The deadline in microseconds*/
+    );
+
+    //! Connect ports
+    //!
+    void connectPorts();
+
+    //! Initialize components
+    //!
+    void initComponents();
+
+  private:
+    // ----------------------------------------------------------------------
+    // Variables
+    // ----------------------------------------------------------------------
+
+    //! The component under test
+    //!
+    TimerWheel component;
+
+    //! The time of the last cycle in microseconds
+    U64 m_nowUsec;
+
+    //! The deadline of each client in microseconds, or 0 if not armed
+    U64 m_deadlines[TimerWheel::CLIENTS];
+
+    //! The clients woken by the last cycle
+    NATIVE_INT_TYPE m_woken[TimerWheel::CLIENTS];
+
+    //! The number of clients woken by the last cycle
+    U32 m_wokenCount;
+};
+
+}  // end namespace Svc
+
+#endif
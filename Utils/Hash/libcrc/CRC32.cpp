@@ -14,6 +14,61 @@
 
 namespace Utils {
 
+    namespace {
+
+        //! Tables for computing the CRC-32 of 8 bytes at a time ("slicing-by-8"). Table 0 is the byte-at-a-time table
+        //! of lib_crc, table k holds the CRC of a byte followed by k zero bytes. The result is identical to
+        //! update_crc_32 applied to each byte.
+        class Crc32Tables {
+          public:
+            Crc32Tables() {
+                for (U32 i = 0; i < 256; i++) {
+                    U32 crc = i;
+                    for (U32 j = 0; j < 8; j++) {
+                        crc = (crc & 1) ? ((crc >> 1) ^ 0xEDB88320) : (crc >> 1);
+                    }
+                    this->table[0][i] = crc;
+                }
+                for (U32 i = 0; i < 256; i++) {
+                    for (U32 k = 1; k < 8; k++) {
+                        const U32 previous = this->table[k - 1][i];
+                        this->table[k][i] = (previous >> 8) ^ this->table[0][previous & 0xFF];
+                    }
+                }
+            }
+
+            U32 table[8][256];
+        };
+
+        const Crc32Tables& crc32Tables() {
+            // Built on first use, initialization of local statics is thread safe
+            static const Crc32Tables tables;
+            return tables;
+        }
+
+        U32 updateCrc32(U32 crc, const void* const data, const NATIVE_INT_TYPE len) {
+            const U32 (&table)[8][256] = crc32Tables().table;
+            const U8* bytes = static_cast<const U8*>(data);
+            NATIVE_INT_TYPE remaining = len;
+            // Bytes are assembled explicitly so the result does not depend on alignment or endianness
+            while (remaining >= 8) {
+                const U32 low = crc ^ (static_cast<U32>(bytes[0]) | (static_cast<U32>(bytes[1]) << 8) |
+                                       (static_cast<U32>(bytes[2]) << 16) | (static_cast<U32>(bytes[3]) << 24));
+                crc = table[7][low & 0xFF] ^ table[6][(low >> 8) & 0xFF] ^ table[5][(low >> 16) & 0xFF] ^
+                      table[4][low >> 24] ^ table[3][bytes[4]] ^ table[2][bytes[5]] ^ table[1][bytes[6]] ^
+                      table[0][bytes[7]];
+                bytes += 8;
+                remaining -= 8;
+            }
+            while (remaining > 0) {
+                crc = (crc >> 8) ^ table[0][(crc ^ *bytes) & 0xFF];
+                bytes++;
+                remaining--;
+            }
+            return crc;
+        }
+    }
+
     Hash ::
         Hash()
     {
@@ -31,11 +86,7 @@ namespace Utils {
         HASH_HANDLE_TYPE local_hash_handle;
         local_hash_handle = 0xffffffffL;
         FW_ASSERT(data);
-        char c;
-        for(int index = 0; index < len; index++) {
-            c = static_cast<const char*>(data)[index];
-            local_hash_handle = update_crc_32(local_hash_handle, c);
-        }
+        local_hash_handle = updateCrc32(local_hash_handle, data, len);
         HashBuffer bufferOut;
         // For CRC32 we need to return the one's complement of the result:
         Fw::SerializeStatus status = bufferOut.serialize(~(local_hash_handle));
@@ -53,11 +104,7 @@ namespace Utils {
         update(const void *const data, NATIVE_INT_TYPE len)
     {
         FW_ASSERT(data);
-        char c;
-        for(int index = 0; index < len; index++) {
-            c = static_cast<const char*>(data)[index];
-            this->hash_handle = update_crc_32(this->hash_handle, c);
-        }
+        this->hash_handle = updateCrc32(this->hash_handle, data, len);
     }
 
     void Hash ::
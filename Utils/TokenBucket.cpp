@@ -45,6 +45,16 @@ namespace Utils {
     FW_ASSERT(this->m_maxTokens <= MAX_TOKEN_BUCKET_TOKENS, this->m_maxTokens);
   }
 
+  TokenBucket ::
+    TokenBucket () :
+      m_replenishInterval(0),
+      m_maxTokens(0),
+      m_replenishRate(0),
+      m_tokens(0),
+      m_time(0, 0)
+  {
+  }
+
   void TokenBucket ::
     setReplenishInterval(
         U32 replenishInterval
@@ -108,7 +118,9 @@ namespace Utils {
   {
     // attempt replenishing
     if (this->m_replenishRate > 0) {
-      Fw::Time replenishInterval = Fw::Time(this->m_replenishInterval / 1000000, this->m_replenishInterval % 1000000);
+      // the interval takes the time base and context of the bucket, as times can only be added within one
+      Fw::Time replenishInterval = Fw::Time(this->m_time.getTimeBase(), this->m_time.getContext(),
+                                            this->m_replenishInterval / 1000000, this->m_replenishInterval % 1000000);
       Fw::Time nextTime = Fw::Time::add(this->m_time, replenishInterval);
       while (this->m_tokens < this->m_maxTokens && nextTime <= time) {
         // replenish by replenish rate, or up to maxTokens
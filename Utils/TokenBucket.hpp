@@ -35,6 +35,10 @@ namespace Utils {
       // replenishRate=1, startTokens=maxTokens, startTime=0
       TokenBucket(U32 replenishInterval, U32 maxTokens);
 
+      // Empty bucket that never replenishes, for use in arrays before
+      // assigning a configured bucket
+      TokenBucket();
+
     public:
 
       // Adjust settings at runtime
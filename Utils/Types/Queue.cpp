@@ -12,7 +12,7 @@
 
 namespace Types {
 
-Queue::Queue() : m_internal(), m_message_size(0) {}
+Queue::Queue() : m_internal(), m_message_size(0), m_variable(false), m_depth(0), m_count(0), m_high_water(0) {}
 
 void Queue::setup(U8* const storage, const FwSizeType storage_size, const FwSizeType depth, const FwSizeType message_size) {
     // Ensure that enough storage was supplied
@@ -20,16 +20,53 @@ void Queue::setup(U8* const storage, const FwSizeType storage_size, const FwSize
     FW_ASSERT(storage_size >= total_needed_size, storage_size, depth, message_size);
     m_internal.setup(storage, total_needed_size);
     m_message_size = message_size;
+    m_variable = false;
+}
+
+void Queue::setup_variable(U8* const storage,
+                           const FwSizeType storage_size,
+                           const FwSizeType depth,
+                           const FwSizeType max_message_size) {
+    // Ensure at least one maximum size message may be stored
+    FW_ASSERT(max_message_size > 0, max_message_size);
+    FW_ASSERT(storage_size >= (max_message_size + VARIABLE_HEADER_SIZE), storage_size, max_message_size);
+    m_internal.setup(storage, storage_size);
+    m_message_size = max_message_size;
+    m_variable = true;
+    m_depth = depth;
+    m_count = 0;
+    m_high_water = 0;
 }
 
 Fw::SerializeStatus Queue::enqueue(const U8* const message, const FwSizeType size) {
     FW_ASSERT(m_message_size > 0, m_message_size); // Ensure initialization
-    FW_ASSERT(m_message_size == size, size, m_message_size); // Message size is as expected
-    return m_internal.serialize(message, static_cast<NATIVE_UINT_TYPE>(m_message_size));
+    if (!m_variable) {
+        FW_ASSERT(m_message_size == size, size, m_message_size); // Message size is as expected
+        return m_internal.serialize(message, static_cast<NATIVE_UINT_TYPE>(m_message_size));
+    }
+    FW_ASSERT(size <= m_message_size, size, m_message_size); // Message fits the largest allowed size
+    if ((m_count >= m_depth) || (m_internal.get_free_size() < (size + VARIABLE_HEADER_SIZE))) {
+        return Fw::FW_SERIALIZE_NO_ROOM_LEFT;
+    }
+    // Length header is stored in network order for reading back with CircularBuffer::peek
+    U8 header[VARIABLE_HEADER_SIZE];
+    for (FwSizeType i = 0; i < VARIABLE_HEADER_SIZE; i++) {
+        header[i] = static_cast<U8>(size >> (8 * (VARIABLE_HEADER_SIZE - 1 - i)));
+    }
+    Fw::SerializeStatus status = m_internal.serialize(header, static_cast<NATIVE_UINT_TYPE>(VARIABLE_HEADER_SIZE));
+    FW_ASSERT(status == Fw::FW_SERIALIZE_OK, status);
+    if (size > 0) {
+        status = m_internal.serialize(message, static_cast<NATIVE_UINT_TYPE>(size));
+        FW_ASSERT(status == Fw::FW_SERIALIZE_OK, status);
+    }
+    m_count++;
+    m_high_water = (m_count > m_high_water) ? m_count : m_high_water;
+    return Fw::FW_SERIALIZE_OK;
 }
 
 Fw::SerializeStatus Queue::dequeue(U8* const message, const FwSizeType size) {
     FW_ASSERT(m_message_size > 0); // Ensure initialization
+    FW_ASSERT(!m_variable); // Variable size messages must return their size
     FW_ASSERT(m_message_size <= size, size, m_message_size); // Sufficient storage space for read message
     Fw::SerializeStatus result = m_internal.peek(message, static_cast<NATIVE_UINT_TYPE>(m_message_size), 0);
     if (result != Fw::FW_SERIALIZE_OK) {
@@ -38,17 +75,69 @@ Fw::SerializeStatus Queue::dequeue(U8* const message, const FwSizeType size) {
     return m_internal.rotate(m_message_size);
 }
 
+Fw::SerializeStatus Queue::dequeue(U8* const message, const FwSizeType capacity, FwSizeType& size) {
+    FW_ASSERT(m_message_size > 0); // Ensure initialization
+    if (!m_variable) {
+        size = m_message_size;
+        return dequeue(message, capacity);
+    }
+    U32 length = 0;
+    Fw::SerializeStatus result = m_internal.peek(length, 0);
+    if (result != Fw::FW_SERIALIZE_OK) {
+        return result;
+    }
+    FW_ASSERT(length <= capacity, length, capacity); // Sufficient storage space for read message
+    if (length > 0) {
+        result = m_internal.peek(message, length, static_cast<NATIVE_UINT_TYPE>(VARIABLE_HEADER_SIZE));
+        FW_ASSERT(result == Fw::FW_SERIALIZE_OK, result);
+    }
+    result = m_internal.rotate(static_cast<NATIVE_UINT_TYPE>(length + VARIABLE_HEADER_SIZE));
+    FW_ASSERT(result == Fw::FW_SERIALIZE_OK, result);
+    FW_ASSERT(m_count > 0);
+    m_count--;
+    size = length;
+    return Fw::FW_SERIALIZE_OK;
+}
+
+Fw::SerializeStatus Queue::peek(U8* const message, const FwSizeType size) const {
+    FW_ASSERT(m_message_size > 0); // Ensure initialization
+    FW_ASSERT(!m_variable); // Variable size messages are only read by dequeue
+    FW_ASSERT(m_message_size <= size, size, m_message_size); // Sufficient storage space for read message
+    return m_internal.peek(message, static_cast<NATIVE_UINT_TYPE>(m_message_size), 0);
+}
+
+FwSizeType Queue::getHeadSize() const {
+    FW_ASSERT(m_message_size > 0, m_message_size);
+    if (getQueueSize() == 0) {
+        return 0;
+    }
+    if (!m_variable) {
+        return m_message_size;
+    }
+    U32 length = 0;
+    Fw::SerializeStatus result = m_internal.peek(length, 0);
+    FW_ASSERT(result == Fw::FW_SERIALIZE_OK, result);
+    return length;
+}
+
 NATIVE_UINT_TYPE Queue::get_high_water_mark() const {
     FW_ASSERT(m_message_size > 0, m_message_size);
+    if (m_variable) {
+        return m_high_water;
+    }
     return m_internal.get_high_water_mark() / m_message_size;
 }
 
 void Queue::clear_high_water_mark() {
     m_internal.clear_high_water_mark();
+    m_high_water = 0;
 }
 
 NATIVE_UINT_TYPE Queue::getQueueSize() const {
     FW_ASSERT(m_message_size > 0, m_message_size);
+    if (m_variable) {
+        return m_count;
+    }
     return m_internal.get_allocated_size()/m_message_size;
 }
 
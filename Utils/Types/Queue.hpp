@@ -6,6 +6,9 @@
  * size. Wraps circular buffer to perform actual storage of messages. This implementation is not thread safe and the
  * expectation is that the user will wrap it in concurrency constructs where necessary.
  *
+ * The queue may instead be set up to hold variable size messages up to a maximum size. Each message then occupies only
+ * its own length plus a small length header, so storage and copy costs follow the actual message sizes.
+ *
  *  Created on: July 5th, 2022
  *      Author: lestarch
  *
@@ -21,6 +24,9 @@ namespace Types {
 
 class Queue {
   public:
+    //! Storage used by the length header of each message in a variable size queue
+    static const FwSizeType VARIABLE_HEADER_SIZE = sizeof(U32);
+
     /**
      * \brief constructs an uninitialized queue
      */
@@ -39,6 +45,23 @@ class Queue {
      */
     void setup(U8* const storage, const FwSizeType storage_size, const FwSizeType depth, const FwSizeType message_size);
 
+    /**
+     * \brief setup the queue object to hold variable size messages
+     *
+     * Configures the queue to hold up to depth messages of any size up to max_message_size. All of the supplied storage
+     * is used, and each message consumes its size plus VARIABLE_HEADER_SIZE bytes of it. Storage size must be large
+     * enough to hold at least one maximum size message.
+     *
+     * \param storage: storage memory allocation
+     * \param storage_size: size of the provided allocation
+     * \param depth: maximum number of messages held by the queue
+     * \param max_message_size: size of the largest message that may be enqueued
+     */
+    void setup_variable(U8* const storage,
+                        const FwSizeType storage_size,
+                        const FwSizeType depth,
+                        const FwSizeType max_message_size);
+
     /**
      * \brief pushes a fixed-size message onto the back of the queue
      *
@@ -49,6 +72,8 @@ class Queue {
      *
      * This will return a non-Fw::SERIALIZE_OK status when the queue is full.
      *
+     * For a variable size queue, size may be anything up to the maximum message size and only size bytes are copied.
+     *
      * \param message: message of size m_message_size to enqueue
      * \param size: size of the message being sent. Must be equivalent to queue's message size.
      * \return: Fw::SERIALIZE_OK on success, something else on failure
@@ -70,6 +95,37 @@ class Queue {
      */
     Fw::SerializeStatus dequeue(U8* const message, const FwSizeType size);
 
+    /**
+     * \brief pops a message of either fixed or variable size off the front of the queue
+     *
+     * Pops a message off the front of the queue, copying it into the provided message buffer and returning the number
+     * of bytes copied. Capacity must be large enough to hold the message at the front of the queue.
+     *
+     * This will return a non-Fw::SERIALIZE_OK status when the queue is empty.
+     *
+     * \param message: buffer to copy the message into
+     * \param capacity: size of the buffer being supplied
+     * \param size: set to the size of the dequeued message
+     * \return: Fw::SERIALIZE_OK on success, something else on failure
+     */
+    Fw::SerializeStatus dequeue(U8* const message, const FwSizeType capacity, FwSizeType& size);
+
+    /**
+     * \brief copies the fixed-size message at the front of the queue without removing it
+     *
+     * \param message: message of size m_message_size to copy into
+     * \param size: size of the buffer being supplied. Must be at least the queue's message size.
+     * \return: Fw::SERIALIZE_OK on success, something else when the queue is empty
+     */
+    Fw::SerializeStatus peek(U8* const message, const FwSizeType size) const;
+
+    /**
+     * \brief size of the message at the front of the queue
+     *
+     * \return: size in bytes of the next message to be dequeued, 0 when the queue is empty
+     */
+    FwSizeType getHeadSize() const;
+
     /**
      * Return the largest tracked allocated size
      */
@@ -84,7 +140,11 @@ class Queue {
 
   private:
     CircularBuffer m_internal;
-    FwSizeType m_message_size;
+    FwSizeType m_message_size;  //!< Size of each message, or the largest message for a variable size queue
+    bool m_variable;            //!< Queue holds variable size messages
+    FwSizeType m_depth;         //!< Maximum count of messages in a variable size queue
+    FwSizeType m_count;         //!< Count of messages in a variable size queue
+    FwSizeType m_high_water;    //!< Largest count of messages seen in a variable size queue
 };
 }  // namespace Types
 #endif  // _UTILS_TYPES_QUEUE_HPP
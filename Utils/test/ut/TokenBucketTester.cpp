@@ -131,6 +131,25 @@ namespace Utils {
     ASSERT_FALSE(bucket.trigger(Fw::Time(0,0)));
   }
 
+  void TokenBucketTester ::
+    testTimeBase()
+  {
+    U32 interval = 1000000;
+    U32 maxTokens = 2;
+    Fw::Time startTime(TB_PROC_TIME, 3, 5, 0);
+
+    TokenBucket bucket(interval, maxTokens, 1, maxTokens, startTime);
+    ASSERT_TRUE(bucket.trigger(Fw::Time(TB_PROC_TIME, 3, 5, 0)));
+    ASSERT_TRUE(bucket.trigger(Fw::Time(TB_PROC_TIME, 3, 5, 0)));
+    ASSERT_FALSE(bucket.trigger(Fw::Time(TB_PROC_TIME, 3, 5, 500000)));
+
+    // replenishes in the time base and context of the bucket
+    ASSERT_TRUE(bucket.trigger(Fw::Time(TB_PROC_TIME, 3, 6, 0)));
+    ASSERT_FALSE(bucket.trigger(Fw::Time(TB_PROC_TIME, 3, 6, 0)));
+    ASSERT_TRUE(bucket.trigger(Fw::Time(TB_PROC_TIME, 3, 8, 0)));
+    ASSERT_EQ(bucket.getTokens(), 1);
+  }
+
 
   // ----------------------------------------------------------------------
   // Helper methods
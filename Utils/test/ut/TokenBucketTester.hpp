@@ -46,6 +46,7 @@ namespace Utils {
       void testTriggering();
       void testReconfiguring();
       void testInitialSettings();
+      void testTimeBase();
 
     private:
 
@@ -5,6 +5,7 @@
 #include "LockGuardTester.hpp"
 #include "RateLimiterTester.hpp"
 #include "TokenBucketTester.hpp"
+#include <Utils/Hash/Hash.hpp>
 
 TEST(LockGuardTest, TestLocking) {
     Utils::LockGuardTester tester;
@@ -41,6 +42,47 @@ TEST(TokenBucketTest, TestInitialSettings) {
     tester.testInitialSettings();
 }
 
+TEST(TokenBucketTest, TestTimeBase) {
+    Utils::TokenBucketTester tester;
+    tester.testTimeBase();
+}
+
+TEST(HashTest, TestIncrementalMatchesByteWise) {
+    U8 data[1000];
+    for (U32 i = 0; i < sizeof(data); i++) {
+        data[i] = static_cast<U8>(i * 7 + 3);
+    }
+    // Every length and alignment up to a few words, and updates split at every offset
+    for (U32 start = 0; start < 9; start++) {
+        for (U32 length = 0; length < 40; length++) {
+            unsigned long reference = 0xffffffffL;
+            for (U32 i = 0; i < length; i++) {
+                reference = update_crc_32(reference, static_cast<char>(data[start + i]));
+            }
+            U32 whole = 0;
+            Utils::Hash hash;
+            hash.update(&data[start], length);
+            hash.final(whole);
+            ASSERT_EQ(whole, static_cast<U32>(~reference));
+
+            for (U32 split = 0; split <= length; split++) {
+                U32 parts = 0;
+                hash.init();
+                hash.update(&data[start], split);
+                hash.update(&data[start + split], length - split);
+                hash.final(parts);
+                ASSERT_EQ(parts, whole);
+            }
+        }
+    }
+    // Known CRC-32 of "123456789"
+    Utils::HashBuffer buffer;
+    Utils::Hash::hash("123456789", 9, buffer);
+    U32 check = 0;
+    ASSERT_EQ(buffer.deserialize(check), Fw::FW_SERIALIZE_OK);
+    ASSERT_EQ(check, 0xCBF43926u);
+}
+
 int main(int argc, char **argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
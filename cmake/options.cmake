@@ -261,6 +261,22 @@ else()
 endif()
 include(CTest)
 
+####
+# `FPRIME_ENABLE_PROFILING`:
+#
+# Sets FW_PROFILING for the whole build, such that the framework records port call counts and the dispatch profile of
+# active components reported by `Svc::Profiler`. It cannot be set for a single unit test, as it changes the layout of
+# the framework classes the test links against. Configure a unit test build with it set to run the profiling checks of
+# the `Svc::Profiler` unit test; other unit tests then run against the profiled framework.
+#
+# **Values:**
+# - ON: set FW_PROFILING to 1
+# - OFF: (default) leave FW_PROFILING as set in FpConfig.h
+#
+# e.g. `-DFPRIME_ENABLE_PROFILING=ON`
+####
+option(FPRIME_ENABLE_PROFILING "Profile port calls and active component dispatches" OFF)
+
 ####
 # Locations `FPRIME_FRAMEWORK_PATH`, `FPRIME_PROJECT_ROOT`, `FPRIME_LIBRARY_LOCATIONS`, and `FPRIME_CONFIG_DIR`:
 #
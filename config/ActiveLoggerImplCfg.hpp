@@ -24,4 +24,13 @@ enum {
     TELEM_ID_FILTER_SIZE = 25, //!< Size of telemetry ID filter
 };
 
+// set event rate limiting
+
+enum {
+    ACTIVE_LOGGER_THROTTLE_LIMIT_DEFAULT = 0, //!< Events each ID may pass per interval. 0 disables rate limiting
+    ACTIVE_LOGGER_THROTTLE_INTERVAL = 1000000, //!< Interval in microseconds over which each ID may pass the limit
+    ACTIVE_LOGGER_THROTTLE_SLOTS = 64, //!< Number of event IDs that can be rate limited at once
+    ACTIVE_LOGGER_THROTTLE_PROBES = 8, //!< Number of slots searched for an event ID, bounding the cost of each event
+};
+
 #endif /* ACTIVELOGGER_ACTIVELOGGERIMPLCFG_HPP_ */
@@ -0,0 +1,18 @@
+/*
+ * ActiveTextLoggerCfg.hpp:
+ *
+ * Configuration settings for the active text logger component.
+ */
+
+#ifndef SVC_ACTIVETEXTLOGGER_ACTIVETEXTLOGGERCFG_HPP_
+#define SVC_ACTIVETEXTLOGGER_ACTIVETEXTLOGGERCFG_HPP_
+#include <FpConfig.hpp>
+
+namespace Svc {
+    // Size of the in-memory block that log text is gathered into before being written to the log
+    // file. The block is written out when the next line will not fit, when the schedIn port is
+    // called, and when a FATAL event is logged. Lines at least this large are written directly.
+    static const U32 ACTIVE_TEXT_LOGGER_BUFFER_SIZE = 4096;
+}
+
+#endif /* SVC_ACTIVETEXTLOGGER_ACTIVETEXTLOGGERCFG_HPP_ */
@@ -0,0 +1,17 @@
+/*
+ * CmdSequencerCfg.hpp:
+ *
+ * Configuration settings for the command sequencer component.
+ */
+
+#ifndef SVC_CMDSEQUENCER_CMDSEQUENCERCFG_HPP_
+#define SVC_CMDSEQUENCER_CMDSEQUENCERCFG_HPP_
+#include <FpConfig.hpp>
+
+namespace Svc {
+    // Maximum number of validated sequences the sequencer keeps in memory. The number actually kept is
+    // chosen when the cache memory is allocated, and is bounded by the memory the allocator provides.
+    static const NATIVE_UINT_TYPE CMD_SEQUENCER_MAX_CACHED_SEQUENCES = 4;
+}
+
+#endif /* SVC_CMDSEQUENCER_CMDSEQUENCERCFG_HPP_ */
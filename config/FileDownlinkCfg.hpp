@@ -21,6 +21,17 @@ namespace Svc {
     // Size of the internal file downlink buffer. This must now be static as
     // file down maintains its own internal buffer.
     static const U32 FILEDOWNLINK_INTERNAL_BUFFER_SIZE = FW_COM_BUFFER_MAX_SIZE-sizeof(FwPacketDescriptorType);
+    // Maximum number of file packet buffers that may be outstanding (sent but not yet returned) at
+    // once. File downlink reserves one internal buffer of FILEDOWNLINK_INTERNAL_BUFFER_SIZE per slot.
+    // The window size actually used is chosen at configure time and may not exceed this value.
+    static const U32 FILEDOWNLINK_MAX_WINDOW_SIZE = 4;
+    // Number of priority classes for queued downlinks. Class 0 is used by the SendFile and SendPartial
+    // commands and the SendFile port. Each class has its own file queue.
+    static const U8 FILEDOWNLINK_NUM_PRIORITIES = 3;
+    // Fair-share weight of each priority class. When several classes have files queued, the next file
+    // is taken from the class that has been sent the fewest bytes relative to its weight, so over time
+    // each busy class receives a share of the downlink proportional to its weight.
+    static const U32 FILEDOWNLINK_PRIORITY_WEIGHTS[FILEDOWNLINK_NUM_PRIORITIES] = { 1, 4, 16 };
 }
 
 #endif /* SVC_FILEDOWNLINK_FILEDOWNLINKCFG_HPP_ */
@@ -0,0 +1,26 @@
+/*
+ * FileUplinkCfg.hpp:
+ *
+ * Configuration settings for file uplink component.
+ */
+
+#ifndef SVC_FILEUPLINK_FILEUPLINKCFG_HPP_
+#define SVC_FILEUPLINK_FILEUPLINKCFG_HPP_
+#include <FpConfig.hpp>
+
+namespace Svc {
+    // Size of the write-behind buffer used to coalesce data packets into larger writes. Packets
+    // falling within one buffer-sized window of the file are gathered and written together, so this
+    // should be a multiple of the storage block size.
+    static const U32 FILEUPLINK_WRITE_BUFFER_SIZE = 4096;
+    // Maximum number of separate byte ranges held in the write-behind buffer. Packets arriving out of
+    // order leave gaps in the buffer; once this many ranges are held, the buffer is written out.
+    static const U32 FILEUPLINK_MAX_EXTENTS = 8;
+    // Block size, in bytes, that writes are aligned to while a file is being received. When the buffer
+    // must make room for new data, only whole aligned blocks are written and partly filled blocks stay
+    // buffered until later packets fill them; END and CANCEL packets write out everything. Must divide
+    // FILEUPLINK_WRITE_BUFFER_SIZE. Set to 1 to write every buffered range in full.
+    static const U32 FILEUPLINK_WRITE_ALIGNMENT = 512;
+}
+
+#endif /* SVC_FILEUPLINK_FILEUPLINKCFG_HPP_ */
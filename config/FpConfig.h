@@ -178,6 +178,34 @@ typedef FwIndexType FwQueueSizeType;
 #define FW_PORT_TRACING 1  //!< Indicates whether port calls are traced (more code, more visibility into execution)
 #endif
 
+// Traced port calls may be recorded into binary per-thread trace rings, viewed through Svc::Profiler. The rings and
+// the table naming ports take static memory, so recording is only compiled in when enabled here.
+#ifndef FW_PORT_TRACE_RECORDING
+#define FW_PORT_TRACE_RECORDING 0  //!< Indicates whether traced port calls are recorded in trace rings
+#endif
+
+// Text tracing through Fw::Logger is far slower than recording and is only compiled in when enabled here.
+#ifndef FW_PORT_TRACE_TEXT
+#define FW_PORT_TRACE_TEXT 0  //!< Indicates whether traced port calls may also be logged as text
+#endif
+
+#ifndef FW_PORT_TRACE_RINGS
+#define FW_PORT_TRACE_RINGS 8  //!< Number of threads whose port calls are recorded, one ring per thread
+#endif
+
+#ifndef FW_PORT_TRACE_RING_SIZE
+#define FW_PORT_TRACE_RING_SIZE 512  //!< Number of port calls kept in each trace ring
+#endif
+
+#ifndef FW_PORT_TRACE_MAX_PORTS
+#define FW_PORT_TRACE_MAX_PORTS 1024  //!< Number of ports whose names can be looked up from trace records
+#endif
+
+// This records call counts of ports, and the handler execution time and queue latency of active component messages
+#ifndef FW_PROFILING
+#define FW_PROFILING 0  //!< Indicates whether dispatches are profiled (more code and time per call, visibility into load)
+#endif
+
 // This generates code to connect to serialized ports
 #ifndef FW_PORT_SERIALIZATION
 #define FW_PORT_SERIALIZATION \
@@ -0,0 +1,22 @@
+/*
+ * SystemResourcesCfg.hpp:
+ *
+ * Configuration settings for Os::SystemResources snapshots.
+ */
+
+#ifndef OS_SYSTEMRESOURCESCFG_HPP_
+#define OS_SYSTEMRESOURCESCFG_HPP_
+#include <FpConfig.hpp>
+
+namespace Os {
+    namespace SystemResourcesCfg {
+        //! Number of per-CPU entries held by a snapshot. CPUs beyond this count are only part of the aggregate.
+        static const U32 MAX_CPUS = 64;
+        //! Number of per-thread entries held by a snapshot. Must be at least SystemResourcesThreads in AcConstants.fpp.
+        static const U32 MAX_THREADS = 32;
+        //! Size of a thread name, including the terminating null. Linux limits thread names to 15 characters.
+        static const U32 THREAD_NAME_SIZE = 16;
+    }
+}
+
+#endif /* OS_SYSTEMRESOURCESCFG_HPP_ */